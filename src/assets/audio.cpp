@@ -27,6 +27,7 @@
 
 #include "../core/core.h"
 #include "../config/config.h"
+#include "../ui/profiler.h"
 #include "audio.h"
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
@@ -340,6 +341,8 @@ unsigned int PlayVoicePhrase(eVoicePhrase VoicePhrase, float LocalVolume)
  */
 void AudioLoop()
 {
+    PROFILER_ZONE("AudioLoop");
+
     // update buffers
     vw_UpdateSound(SDL_GetTicks());
     vw_UpdateMusic(SDL_GetTicks());
@@ -250,13 +250,24 @@ unsigned GetModel3DAssetsLoadValue()
  */
 void ForEachModel3DAssetLoad(std::function<void (unsigned AssetValue)> function)
 {
+    std::vector<std::pair<const std::string, sModel3DAsset>*> Assets{};
+    Assets.reserve(Model3DMap.size());
     for (auto &tmpAsset : Model3DMap) {
-        tmpAsset.second.PreloadedModel3D =
-            vw_LoadModel3D(tmpAsset.first,
-                           tmpAsset.second.TriangleSizeLimit,
-                           tmpAsset.second.NeedTangentAndBinormal && GameConfig().UseGLSL120);
-        function(Model3DLoadValue);
+        Assets.push_back(&tmpAsset);
     }
+    std::vector<std::shared_ptr<sModel3D>> PreparedModels(Assets.size());
+
+    // models parsing and vertex arrays generation in worker threads, OpenGL buffers creation in main thread
+    vw_ParallelPrepare(static_cast<unsigned>(Assets.size()),
+                       [&] (unsigned i) {
+        PreparedModels[i] = vw_PrepareModel3D(Assets[i]->first,
+                                              Assets[i]->second.TriangleSizeLimit,
+                                              Assets[i]->second.NeedTangentAndBinormal && GameConfig().UseGLSL120);
+    }, [&] (unsigned i) {
+        Assets[i]->second.PreloadedModel3D = vw_LoadModel3D(Assets[i]->first, PreparedModels[i]);
+        PreparedModels[i].reset();
+        function(Model3DLoadValue);
+    });
 }
 
 /*
@@ -39,6 +39,7 @@ namespace astromenace {
 // Get all model3d assets load value.
 unsigned GetModel3DAssetsLoadValue();
 // Cycle with function callback on each model3d asset load.
+// Note, models are parsed in worker threads, but function is called in caller's thread.
 void ForEachModel3DAssetLoad(std::function<void (unsigned AssetValue)> function);
 // Get preloaded model3d asset (preloaded by ForEachModel3DAssetLoad() call).
 std::weak_ptr<sModel3D> GetPreloadedModel3DAsset(const std::string &FileName);
@@ -386,6 +386,9 @@ std::unordered_map<std::string, sTextureAsset> TextureMap{
     {"skybox/2/skybox_top3.tga",        sTextureAsset{false, eAlphaCreateMode::GREYSC, eTextureWrapMode::CLAMP_TO_EDGE}},
 };
 
+// headless mode, see DisableTextureAssets()
+bool TextureAssetsDisabled{false};
+
 } // unnamed namespace
 
 
@@ -404,14 +407,25 @@ void ForEachTextureAssetLoad(std::function<void (unsigned AssetValue)> function)
 {
     vw_SetTextureAlpha(0, 0, 0);
 
+    std::vector<std::pair<const std::string, sTextureAsset>*> Assets{};
+    Assets.reserve(TextureMap.size());
     for (auto &tmpAsset : TextureMap) {
-        vw_SetTextureProp(sTextureFilter{tmpAsset.second.TextFilter},
-                          tmpAsset.second.NeedAnisotropy ? GameConfig().AnisotropyLevel : 1,
-                          sTextureWrap{tmpAsset.second.TextWrap}, tmpAsset.second.Alpha,
-                          tmpAsset.second.AlphaMode, tmpAsset.second.MipMap);
-        tmpAsset.second.PreloadedTexture = vw_LoadTexture(tmpAsset.first);
-        function(TextureLoadValue);
+        Assets.push_back(&tmpAsset);
     }
+    std::vector<sTextureImage> Images(Assets.size());
+
+    // images decode and preprocess in worker threads, textures creation (OpenGL) in main thread
+    vw_ParallelPrepare(static_cast<unsigned>(Assets.size()),
+                       [&] (unsigned i) {
+        vw_LoadTextureImage(Assets[i]->first, Images[i], Assets[i]->second.Alpha, Assets[i]->second.AlphaMode);
+    }, [&] (unsigned i) {
+        vw_SetTextureProp(sTextureFilter{Assets[i]->second.TextFilter},
+                          Assets[i]->second.NeedAnisotropy ? GameConfig().AnisotropyLevel : 1,
+                          sTextureWrap{Assets[i]->second.TextWrap}, Assets[i]->second.Alpha,
+                          Assets[i]->second.AlphaMode, Assets[i]->second.MipMap);
+        Assets[i]->second.PreloadedTexture = vw_CreateTextureFromImage(Assets[i]->first, Images[i]);
+        function(TextureLoadValue);
+    });
 }
 
 /*
@@ -435,6 +449,10 @@ void ChangeTexturesAnisotropyLevel()
  */
 GLtexture GetPreloadedTextureAsset(const std::string &FileName)
 {
+    if (TextureAssetsDisabled) {
+        return 0;
+    }
+
     auto tmpAsset = TextureMap.find(FileName);
     if (tmpAsset != TextureMap.end() && tmpAsset->second.PreloadedTexture) {
         return tmpAsset->second.PreloadedTexture;
@@ -444,5 +462,14 @@ GLtexture GetPreloadedTextureAsset(const std::string &FileName)
     return 0;
 }
 
+/*
+ * Disable texture assets (headless mode without OpenGL context),
+ * GetPreloadedTextureAsset() will return 0 without error.
+ */
+void DisableTextureAssets()
+{
+    TextureAssetsDisabled = true;
+}
+
 } // astromenace namespace
 } // viewizard namespace
@@ -38,6 +38,7 @@ namespace astromenace {
 // Get all texture assets load value.
 unsigned GetTextureAssetsLoadValue();
 // Cycle with function callback on each texture asset load.
+// Note, images are decoded in worker threads, but function is called in caller's thread.
 void ForEachTextureAssetLoad(std::function<void (unsigned AssetValue)> function);
 // Change anisotropy level for all textures that was loaded with anisotropy.
 void ChangeTexturesAnisotropyLevel();
@@ -45,6 +46,9 @@ void ChangeTexturesAnisotropyLevel();
 // Note, we don't validate textures, caller should care about call
 // ForEachTextureAssetLoad() each time, when this need.
 GLtexture GetPreloadedTextureAsset(const std::string &FileName);
+// Disable texture assets (headless mode without OpenGL context),
+// GetPreloadedTextureAsset() will return 0 without error.
+void DisableTextureAssets();
 
 } // astromenace namespace
 } // viewizard namespace
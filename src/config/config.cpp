@@ -179,6 +179,7 @@ void SaveXMLConfigFile()
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "WeaponPanelView"),
                               "value", static_cast<int>(Config.WeaponPanelView));
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "GameSpeed"), "value", Config.GameSpeed);
+    XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "SimulationTickRate"), "value", Config.SimulationTickRate);
 
     XMLdoc->AddComment(*RootXMLEntry, " Control settings ");
     XMLdoc->AddEntryAttribute(XMLdoc->AddEntry(*RootXMLEntry, "KeyBoardLeft"), "value",
@@ -269,6 +270,9 @@ static void CheckConfig()
     if (Config.JoystickDeadZone > 10) { // NOTE use std::clamp here (since C++17)
         Config.JoystickDeadZone = 10;
     }
+    if (Config.SimulationTickRate < 0 || Config.SimulationTickRate > 1000) {
+        Config.SimulationTickRate = 60;
+    }
 }
 
 /*
@@ -445,6 +449,10 @@ bool LoadXMLConfigFile(bool NeedResetConfig)
         XMLdoc->fGetEntryAttribute(*XMLdoc->FindEntryByName(*RootXMLEntry, "GameSpeed"), "value",
                                    Config.GameSpeed);
     }
+    if (XMLdoc->FindEntryByName(*RootXMLEntry, "SimulationTickRate")) {
+        XMLdoc->iGetEntryAttribute(*XMLdoc->FindEntryByName(*RootXMLEntry, "SimulationTickRate"), "value",
+                                   Config.SimulationTickRate);
+    }
 
     if (XMLdoc->FindEntryByName(*RootXMLEntry, "KeyBoardLeft")) {
         std::string tmpKeyBoardLeft{};
@@ -207,6 +207,7 @@ struct sGameConfig {
     int JoystickDeadZone{2};
 
     float GameSpeed{1.5f};
+    int SimulationTickRate{60};     // fixed simulation update rate (ticks per game second), 0 - update once per frame
     bool ShowFPS{false};
     eWeaponPanelView WeaponPanelView{eWeaponPanelView::full};
 
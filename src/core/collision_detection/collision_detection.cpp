@@ -30,6 +30,14 @@
 
 namespace viewizard {
 
+namespace {
+
+// buffers for BVH traversal (reused, in order to avoid memory allocation on each call)
+std::vector<unsigned> BVHStack{};
+std::vector<unsigned> BVHTriangles{};
+
+} // unnamed namespace
+
 /*
  * Check, is point belong triangle.
  */
@@ -262,6 +270,25 @@ bool vw_SphereSphereCollision(float Object1Radius, const sVECTOR3D &Object1Locat
     return false;
 }
 
+/*
+ * Calculate interval along Z axis, that covers all vw_SphereSphereCollision() checks for object.
+ */
+void vw_SphereSphereIntervalZ(float Radius, const sVECTOR3D &Location, const sVECTOR3D &PrevLocation,
+                              float &Min, float &Max)
+{
+    // object could be checked by sphere in current location, or by collision point inside
+    // the sphere, that built on line segment between previous and current location (as diameter),
+    // pad both parts by radius, since object could be checked as first or as second object
+    float Mid{(Location.z + PrevLocation.z) / 2.0f};
+    float HalfLength{(Location - PrevLocation).Length() / 2.0f};
+
+    // small safety margin for floating point rounding
+    Radius += 1.0f;
+
+    Min = std::min(Location.z, Mid - HalfLength) - Radius;
+    Max = std::max(Location.z, Mid + HalfLength) + Radius;
+}
+
 /*
  * Sphere-AABB collision detection.
  */
@@ -400,163 +427,242 @@ bool vw_SphereOBBCollision(const bounding_box &Object1OBB, const sVECTOR3D &Obje
 }
 
 /*
- * Sphere-Mesh collision detection.
+ * Sphere-Triangle collision detection for mesh triangle, started from vertex number i.
  */
-bool vw_SphereMeshCollision(const sVECTOR3D &Object1Location, const sChunk3D &Object1Chunks,
-                            const float (&Object1RotationMatrix)[9], float Object2Radius, const sVECTOR3D &Object2Location,
-                            const sVECTOR3D &Object2PrevLocation, sVECTOR3D &CollisionLocation)
+static bool SphereTriangleCollision(const sChunk3D &Object1Chunks, const float (&TransMat)[16], unsigned int i,
+                                    float Object2Radius, const sVECTOR3D &Object2Location,
+                                    const sVECTOR3D &Object2PrevLocation, sVECTOR3D &CollisionLocation)
 {
-    // translation matrix
-    float TransMat[16]{Object1RotationMatrix[0], Object1RotationMatrix[1], Object1RotationMatrix[2], 0.0f,
-                       Object1RotationMatrix[3], Object1RotationMatrix[4], Object1RotationMatrix[5], 0.0f,
-                       Object1RotationMatrix[6], Object1RotationMatrix[7], Object1RotationMatrix[8], 0.0f,
-                       Object1Location.x,        Object1Location.y,        Object1Location.z,        1.0f};
+    // we use index buffer here in order to find triangle's vertices in mesh
+    unsigned int IndexPos = Object1Chunks.RangeStart + i; // index buffer position
+    unsigned int VertexPos{0}; // vertex buffer position
+    if (Object1Chunks.IndexArray) {
+        VertexPos = Object1Chunks.IndexArray.get()[IndexPos] * Object1Chunks.VertexStride;
+    } else {
+        VertexPos = (IndexPos) * Object1Chunks.VertexStride;
+    }
 
-    float TransMatTMP[16];
-    vw_Matrix44Identity(TransMatTMP);
+    // translate triangle's vertices in proper coordinates for collision detection
+    sVECTOR3D Point1{Object1Chunks.VertexArray.get()[VertexPos],
+                     Object1Chunks.VertexArray.get()[VertexPos + 1],
+                     Object1Chunks.VertexArray.get()[VertexPos + 2]};
+    vw_Matrix44CalcPoint(Point1, TransMat);
 
-    // care about rotation
-    if (Object1Chunks.Rotation.x != 0.0f
-        || Object1Chunks.Rotation.y != 0.0f
-        || Object1Chunks.Rotation.z != 0.0f) {
-        vw_Matrix44CreateRotate(TransMatTMP, Object1Chunks.Rotation);
+    if (Object1Chunks.IndexArray) {
+        VertexPos = Object1Chunks.IndexArray.get()[IndexPos + 1] * Object1Chunks.VertexStride;
+    } else {
+        VertexPos = (IndexPos + 1) * Object1Chunks.VertexStride;
     }
 
-    // don't care about GeometryAnimation here, for more speed
+    sVECTOR3D Point2{Object1Chunks.VertexArray.get()[VertexPos],
+                     Object1Chunks.VertexArray.get()[VertexPos + 1],
+                     Object1Chunks.VertexArray.get()[VertexPos + 2]};
+    vw_Matrix44CalcPoint(Point2, TransMat);
 
-    // generate final translation matrix
-    vw_Matrix44Translate(TransMatTMP, Object1Chunks.Location);
-    vw_Matrix44Mult(TransMat, TransMatTMP);
+    if (Object1Chunks.IndexArray) {
+        VertexPos = Object1Chunks.IndexArray.get()[IndexPos + 2] * Object1Chunks.VertexStride;
+    } else {
+        VertexPos = (IndexPos + 2) * Object1Chunks.VertexStride;
+    }
 
-    // detect collision with mesh triangles
-    for (unsigned int i = 0; i < Object1Chunks.VertexQuantity; i += 3) {
-        // we use index buffer here in order to find triangle's vertices in mesh
-        unsigned int IndexPos = Object1Chunks.RangeStart + i; // index buffer position
-        unsigned int VertexPos{0}; // vertex buffer position
-        if (Object1Chunks.IndexArray) {
-            VertexPos = Object1Chunks.IndexArray.get()[IndexPos] * Object1Chunks.VertexStride;
-        } else {
-            VertexPos = (IndexPos) * Object1Chunks.VertexStride;
-        }
+    sVECTOR3D Point3{Object1Chunks.VertexArray.get()[VertexPos],
+                     Object1Chunks.VertexArray.get()[VertexPos + 1],
+                     Object1Chunks.VertexArray.get()[VertexPos + 2]};
+    vw_Matrix44CalcPoint(Point3, TransMat);
 
-        // translate triangle's vertices in proper coordinates for collision detection
-        sVECTOR3D Point1{Object1Chunks.VertexArray.get()[VertexPos],
-                         Object1Chunks.VertexArray.get()[VertexPos + 1],
-                         Object1Chunks.VertexArray.get()[VertexPos + 2]};
-        vw_Matrix44CalcPoint(Point1, TransMat);
+    // calculate 2 vectors for plane
+    sVECTOR3D PlaneVector1{Point2 - Point1};
+    sVECTOR3D PlaneVector2{Point3 - Point1};
 
-        if (Object1Chunks.IndexArray) {
-            VertexPos = Object1Chunks.IndexArray.get()[IndexPos + 1] * Object1Chunks.VertexStride;
-        } else {
-            VertexPos = (IndexPos + 1) * Object1Chunks.VertexStride;
-        }
+    // calculate normal for plane
+    sVECTOR3D NormalVector{PlaneVector1};
+    NormalVector.Multiply(PlaneVector2);
+    NormalVector.Normalize();
 
-        sVECTOR3D Point2{Object1Chunks.VertexArray.get()[VertexPos],
-                         Object1Chunks.VertexArray.get()[VertexPos + 1],
-                         Object1Chunks.VertexArray.get()[VertexPos + 2]};
-        vw_Matrix44CalcPoint(Point2, TransMat);
+    // calculate distance from point to plane
+    float Distance{(Object2Location - Point1) * NormalVector};
 
-        if (Object1Chunks.IndexArray) {
-            VertexPos = Object1Chunks.IndexArray.get()[IndexPos + 2] * Object1Chunks.VertexStride;
-        } else {
-            VertexPos = (IndexPos + 2) * Object1Chunks.VertexStride;
+    // point close enough to plane for check collision with plane (triangle)
+    if (fabsf(Distance) <= Object2Radius) {
+        // calculate collision point on plane for ray
+        sVECTOR3D IntercPoint{Object2Location - (NormalVector ^ Distance)};
+
+        // return the point data if point belongs to triangle (not just plane)
+        if (PointInTriangle(IntercPoint, Point1, Point2, Point3)) {
+            CollisionLocation = IntercPoint;
+            return true;
         }
+    }
+
+    // check for distance, do we really close enough
+    // note, we use ^2 and don't calculate the real distance
+    float Object2Radius2{Object2Radius * Object2Radius};
+
+    // check distance to point1
+    sVECTOR3D DistancePoint1{Object2Location - Point1};
+    float Distance2Point1{DistancePoint1.x * DistancePoint1.x +
+                          DistancePoint1.y * DistancePoint1.y +
+                          DistancePoint1.z * DistancePoint1.z};
+    if (Distance2Point1 <= Object2Radius2) {
+        CollisionLocation = Point1;
+        return true;
+    }
 
-        sVECTOR3D Point3{Object1Chunks.VertexArray.get()[VertexPos],
-                         Object1Chunks.VertexArray.get()[VertexPos + 1],
-                         Object1Chunks.VertexArray.get()[VertexPos + 2]};
-        vw_Matrix44CalcPoint(Point3, TransMat);
+    // check distance to point2
+    sVECTOR3D DistancePoint2{Object2Location - Point2};
+    float Distance2Point2{DistancePoint2.x * DistancePoint2.x +
+                          DistancePoint2.y * DistancePoint2.y +
+                          DistancePoint2.z * DistancePoint2.z};
+    if (Distance2Point2 <= Object2Radius2) {
+        CollisionLocation = Point2;
+        return true;
+    }
 
-        // calculate 2 vectors for plane
-        sVECTOR3D PlaneVector1{Point2 - Point1};
-        sVECTOR3D PlaneVector2{Point3 - Point1};
+    // check distance to point3
+    sVECTOR3D DistancePoint3{Object2Location - Point3};
+    float Distance2Point3{DistancePoint3.x * DistancePoint3.x +
+                          DistancePoint3.y * DistancePoint3.y +
+                          DistancePoint3.z * DistancePoint3.z};
+    if (Distance2Point3 <= Object2Radius2) {
+        CollisionLocation = Point3;
+        return true;
+    }
 
-        // calculate normal for plane
-        sVECTOR3D NormalVector{PlaneVector1};
-        NormalVector.Multiply(PlaneVector2);
-        NormalVector.Normalize();
+    // check for ray, old object location - current object location
+    // make sure we don't slipped through object (low FPS, fast object, etc)
 
+    // check that this is "front" for triangle, and skip triangles with "back" sided to ray start point
+    sVECTOR3D vDir1{Point1 - Object2PrevLocation};
+    float d1{vDir1 * NormalVector};
+    if (d1 <= 0.001f /* allowable deviation */) {
         // calculate distance from point to plane
-        float Distance{(Object2Location - Point1) * NormalVector};
+        float originDistance{NormalVector * Point1};
+
+        sVECTOR3D vLineDir{Object2Location - Object2PrevLocation};
+
+        // Use the plane equation with the normal and the ray
+        float Numerator{ -(NormalVector.x * Object2PrevLocation.x +
+                           NormalVector.y * Object2PrevLocation.y +
+                           NormalVector.z * Object2PrevLocation.z - originDistance)};
+
+        float Denominator{NormalVector * vLineDir};
+        if (Denominator != 0.0f) {
+            float dist{Numerator / Denominator};
 
-        // point close enough to plane for check collision with plane (triangle)
-        if (fabsf(Distance) <= Object2Radius) {
             // calculate collision point on plane for ray
-            sVECTOR3D IntercPoint{Object2Location - (NormalVector ^ Distance)};
+            sVECTOR3D IntercPoint{Object2PrevLocation + (vLineDir ^ dist)};
 
-            // return the point data if point belongs to triangle (not just plane)
-            if (PointInTriangle(IntercPoint, Point1, Point2, Point3)) {
+            // check, do line (not ray here) cross the plane
+            if ((Object2PrevLocation - IntercPoint) * (Object2Location - IntercPoint) < 0.0f
+                && PointInTriangle(IntercPoint, Point1, Point2, Point3)) {
                 CollisionLocation = IntercPoint;
                 return true;
             }
         }
+    }
 
-        // check for distance, do we really close enough
-        // note, we use ^2 and don't calculate the real distance
-        float Object2Radius2{Object2Radius * Object2Radius};
-
-        // check distance to point1
-        sVECTOR3D DistancePoint1{Object2Location - Point1};
-        float Distance2Point1{DistancePoint1.x * DistancePoint1.x +
-                              DistancePoint1.y * DistancePoint1.y +
-                              DistancePoint1.z * DistancePoint1.z};
-        if (Distance2Point1 <= Object2Radius2) {
-            CollisionLocation = Point1;
-            return true;
-        }
+    return false;
+}
 
-        // check distance to point2
-        sVECTOR3D DistancePoint2{Object2Location - Point2};
-        float Distance2Point2{DistancePoint2.x * DistancePoint2.x +
-                              DistancePoint2.y * DistancePoint2.y +
-                              DistancePoint2.z * DistancePoint2.z};
-        if (Distance2Point2 <= Object2Radius2) {
-            CollisionLocation = Point2;
-            return true;
+/*
+ * Find all BVH triangles with boxes, that overlap provided box (in chunk's vertex array coordinates).
+ * Result sorted in ascending order, so, triangles will be checked in mesh order.
+ */
+static void FindBVHTriangles(const sTriangleBVH &BVH, const sVECTOR3D &Min, const sVECTOR3D &Max,
+                             std::vector<unsigned> &Result)
+{
+    Result.clear();
+    BVHStack.clear();
+    BVHStack.push_back(0);
+    while (!BVHStack.empty()) {
+        const sTriangleBVH::sNode &Node = BVH.Nodes[BVHStack.back()];
+        BVHStack.pop_back();
+
+        if (Node.Min.x > Max.x || Node.Max.x < Min.x ||
+            Node.Min.y > Max.y || Node.Max.y < Min.y ||
+            Node.Min.z > Max.z || Node.Max.z < Min.z) {
+            continue;
         }
 
-        // check distance to point3
-        sVECTOR3D DistancePoint3{Object2Location - Point3};
-        float Distance2Point3{DistancePoint3.x * DistancePoint3.x +
-                              DistancePoint3.y * DistancePoint3.y +
-                              DistancePoint3.z * DistancePoint3.z};
-        if (Distance2Point3 <= Object2Radius2) {
-            CollisionLocation = Point3;
-            return true;
+        if (Node.Count) {
+            Result.insert(Result.end(), BVH.Triangles.begin() + Node.First,
+                          BVH.Triangles.begin() + Node.First + Node.Count);
+        } else {
+            BVHStack.push_back(Node.First + 1);
+            BVHStack.push_back(Node.First);
         }
+    }
 
-        // check for ray, old object location - current object location
-        // make sure we don't slipped through object (low FPS, fast object, etc)
+    std::sort(Result.begin(), Result.end());
+}
 
-        // check that this is "front" for triangle, and skip triangles with "back" sided to ray start point
-        sVECTOR3D vDir1{Point1 - Object2PrevLocation};
-        float d1{vDir1 * NormalVector};
-        if (d1 <= 0.001f /* allowable deviation */) {
-            // calculate distance from point to plane
-            float originDistance{NormalVector * Point1};
+/*
+ * Sphere-Mesh collision detection.
+ */
+bool vw_SphereMeshCollision(const sVECTOR3D &Object1Location, const sChunk3D &Object1Chunks,
+                            const sVECTOR3D &Object1ChunkLocation, const sVECTOR3D &Object1ChunkRotation,
+                            const float (&Object1RotationMatrix)[9], float Object2Radius, const sVECTOR3D &Object2Location,
+                            const sVECTOR3D &Object2PrevLocation, sVECTOR3D &CollisionLocation)
+{
+    // translation matrix
+    float TransMat[16]{Object1RotationMatrix[0], Object1RotationMatrix[1], Object1RotationMatrix[2], 0.0f,
+                       Object1RotationMatrix[3], Object1RotationMatrix[4], Object1RotationMatrix[5], 0.0f,
+                       Object1RotationMatrix[6], Object1RotationMatrix[7], Object1RotationMatrix[8], 0.0f,
+                       Object1Location.x,        Object1Location.y,        Object1Location.z,        1.0f};
 
-            sVECTOR3D vLineDir{Object2Location - Object2PrevLocation};
+    float TransMatTMP[16];
+    vw_Matrix44Identity(TransMatTMP);
 
-            // Use the plane equation with the normal and the ray
-            float Numerator{ -(NormalVector.x * Object2PrevLocation.x +
-                               NormalVector.y * Object2PrevLocation.y +
-                               NormalVector.z * Object2PrevLocation.z - originDistance)};
+    // care about rotation
+    if (Object1ChunkRotation.x != 0.0f
+        || Object1ChunkRotation.y != 0.0f
+        || Object1ChunkRotation.z != 0.0f) {
+        vw_Matrix44CreateRotate(TransMatTMP, Object1ChunkRotation);
+    }
 
-            float Denominator{NormalVector * vLineDir};
-            if (Denominator != 0.0f) {
-                float dist{Numerator / Denominator};
+    // don't care about GeometryAnimation here, for more speed
 
-                // calculate collision point on plane for ray
-                sVECTOR3D IntercPoint{Object2PrevLocation + (vLineDir ^ dist)};
+    // generate final translation matrix
+    vw_Matrix44Translate(TransMatTMP, Object1ChunkLocation);
+    vw_Matrix44Mult(TransMat, TransMatTMP);
 
-                // check, do line (not ray here) cross the plane
-                if ((Object2PrevLocation - IntercPoint) * (Object2Location - IntercPoint) < 0.0f
-                    && PointInTriangle(IntercPoint, Point1, Point2, Point3)) {
-                    CollisionLocation = IntercPoint;
-                    return true;
-                }
+    // detect collision with mesh triangles, if chunk have BVH, check only triangles close to swept sphere
+    if (Object1Chunks.TriangleBVH
+        && Object1Chunks.TriangleBVH->Triangles.size() * 3 == Object1Chunks.VertexQuantity) {
+        // transform sphere's locations into chunk's vertex array coordinates (inverse of rigid TransMat)
+        auto ToChunkSpace = [&TransMat] (const sVECTOR3D &Point) {
+            sVECTOR3D tmpPoint{Point.x - TransMat[12], Point.y - TransMat[13], Point.z - TransMat[14]};
+            return sVECTOR3D{TransMat[0] * tmpPoint.x + TransMat[1] * tmpPoint.y + TransMat[2] * tmpPoint.z,
+                             TransMat[4] * tmpPoint.x + TransMat[5] * tmpPoint.y + TransMat[6] * tmpPoint.z,
+                             TransMat[8] * tmpPoint.x + TransMat[9] * tmpPoint.y + TransMat[10] * tmpPoint.z};
+        };
+        sVECTOR3D Location{ToChunkSpace(Object2Location)};
+        sVECTOR3D PrevLocation{ToChunkSpace(Object2PrevLocation)};
+
+        // swept sphere's box, with small gap for calculation errors
+        float Gap{Object2Radius + 0.01f};
+        sVECTOR3D Min{std::min(Location.x, PrevLocation.x) - Gap,
+                      std::min(Location.y, PrevLocation.y) - Gap,
+                      std::min(Location.z, PrevLocation.z) - Gap};
+        sVECTOR3D Max{std::max(Location.x, PrevLocation.x) + Gap,
+                      std::max(Location.y, PrevLocation.y) + Gap,
+                      std::max(Location.z, PrevLocation.z) + Gap};
+
+        FindBVHTriangles(*Object1Chunks.TriangleBVH, Min, Max, BVHTriangles);
+        for (unsigned Triangle : BVHTriangles) {
+            if (SphereTriangleCollision(Object1Chunks, TransMat, Triangle * 3, Object2Radius,
+                                        Object2Location, Object2PrevLocation, CollisionLocation)) {
+                return true;
             }
         }
+        return false;
+    }
+
+    for (unsigned int i = 0; i < Object1Chunks.VertexQuantity; i += 3) {
+        if (SphereTriangleCollision(Object1Chunks, TransMat, i, Object2Radius,
+                                    Object2Location, Object2PrevLocation, CollisionLocation)) {
+            return true;
+        }
     }
 
     return false;
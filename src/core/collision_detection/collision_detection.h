@@ -55,9 +55,128 @@ bool vw_SphereOBBCollision(const bounding_box &Object1OBB, const sVECTOR3D &Obje
                            const sVECTOR3D &Object1Location, const float (&Object1RotationMatrix)[9],
                            float Object2Radius, const sVECTOR3D &Object2Location, const sVECTOR3D &Object2PrevLocation);
 // Sphere-Mesh collision detection.
+// Note, chunk's location and rotation are provided separately, since chunk could be moved by object.
 bool vw_SphereMeshCollision(const sVECTOR3D &Object1Location, const sChunk3D &Object1Chunks,
+                            const sVECTOR3D &Object1ChunkLocation, const sVECTOR3D &Object1ChunkRotation,
                             const float (&Object1RotationMatrix)[9], float Object2Radius, const sVECTOR3D &Object2Location,
                             const sVECTOR3D &Object2PrevLocation, sVECTOR3D &CollisionLocation);
+// Calculate interval along Z axis, that covers all vw_SphereSphereCollision() checks for object.
+void vw_SphereSphereIntervalZ(float Radius, const sVECTOR3D &Location, const sVECTOR3D &PrevLocation,
+                              float &Min, float &Max);
+
+
+// Uniform grid query statistic.
+struct sUniformGridStatistic {
+    unsigned long long Queries{0};
+    unsigned long long CoarseQueries{0}; // served by coarse level
+    unsigned long long LinearQueries{0}; // too big boxes, all boxes were checked directly
+};
+
+// Uniform grid (spatial hash) for world space axis-aligned boxes, collision broad phase.
+// Boxes should be added between Clear() and Build() calls, Query() is valid after Build().
+// Grid could have second (coarse) level with cells CoarseCellFactor_ times bigger, in order
+// to serve big queries (for example, missile's targeting zone). Coarse level doubles build
+// cost, so, it should be enabled only for grids with big queries.
+// Note, all internal buffers are reused, no memory allocation after "warm up".
+class cUniformGrid {
+public:
+    explicit cUniformGrid(float CellSize, bool UseCoarseLevel = false) :
+        Levels_{{sLevel{CellSize}, sLevel{CellSize * CoarseCellFactor_}}},
+        LevelsCount_{UseCoarseLevel ? 2u : 1u}
+    {}
+
+    // Remove all boxes.
+    void Clear();
+    // Add box, return box index (boxes are indexed in order they were added, starting from 0).
+    unsigned Add(const sVECTOR3D &Min, const sVECTOR3D &Max);
+    // Distribute all added boxes into grid cells.
+    void Build();
+    // Find all boxes, that overlap provided box. Result sorted in ascending order, without duplicates.
+    void Query(const sVECTOR3D &Min, const sVECTOR3D &Max, std::vector<unsigned> &Result);
+
+    unsigned Size() const
+    {
+        return static_cast<unsigned>(Boxes_.size());
+    }
+
+    // Get query statistic, accumulated since last ResetStatistic() call.
+    const sUniformGridStatistic &Statistic() const
+    {
+        return Statistic_;
+    }
+    // Reset query statistic.
+    void ResetStatistic()
+    {
+        Statistic_ = sUniformGridStatistic{};
+    }
+
+private:
+    static constexpr float CoarseCellFactor_{8.0f};
+
+    struct sBox {
+        sVECTOR3D Min{};
+        sVECTOR3D Max{};
+    };
+
+    struct sLevel {
+        explicit sLevel(float CellSize) :
+            InvCellSize{1.0f / CellSize}
+        {}
+
+        float InvCellSize{1.0f};
+        // boxes, that cover too many cells of this level
+        std::vector<unsigned> OversizedBoxes{};
+        // cells are hashed into buckets, bucket's boxes are BucketItems[BucketStart[i], BucketStart[i + 1])
+        std::vector<unsigned> BucketStart{};
+        std::vector<unsigned> BucketItems{};
+    };
+
+    static bool CellsRange(float InvCellSize, const sVECTOR3D &Min, const sVECTOR3D &Max,
+                           int (&From)[3], int (&To)[3]);
+    void BuildLevel(sLevel &Level);
+
+    std::array<sLevel, 2> Levels_;
+    // used levels count (coarse level is optional)
+    unsigned LevelsCount_{1};
+    std::vector<sBox> Boxes_{};
+    sUniformGridStatistic Statistic_{};
+    // query stamps, in order to avoid duplicates in result
+    std::vector<unsigned> Stamps_{};
+    unsigned CurrentStamp_{0};
+};
+
+// Sort and sweep (sweep and prune) along one axis, collision broad phase for objects pairs.
+// Objects should be added between Begin() and End() calls, Pairs() is valid after End().
+// Objects order is kept between calls, so, for coherent scenes (objects move a bit between
+// calls) insertion sort is close to linear. Objects, that were not added, are removed on End().
+class cSortAndSweep {
+public:
+    // Start objects update.
+    void Begin();
+    // Add (or update) object's interval, Id should be unique and stable between calls (usually,
+    // object's address), Index - caller's object index, that will be used in Pairs() result.
+    void Add(const void *Id, unsigned Index, float Min, float Max);
+    // Remove objects, that were not added since Begin() call, and sort intervals.
+    void End();
+    // Find all pairs with overlapped intervals. Pair's first index is less than second index,
+    // result sorted in ascending order (same order as i<j cycles for caller's indexes have).
+    void Pairs(std::vector<std::pair<unsigned, unsigned>> &Result) const;
+
+private:
+    struct sEntry {
+        const void *Id{nullptr};
+        unsigned Index{0};
+        float Min{0.0f};
+        float Max{0.0f};
+        unsigned Stamp{0};
+    };
+
+    // entries sorted by Min (after End() call)
+    std::vector<sEntry> Entries_{};
+    // entry's position in Entries_ by Id
+    std::unordered_map<const void*, unsigned> Positions_{};
+    unsigned CurrentStamp_{0};
+};
 
 } // viewizard namespace
 
@@ -0,0 +1,112 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+#include "collision_detection.h"
+
+namespace viewizard {
+
+/*
+ * Start objects update.
+ */
+void cSortAndSweep::Begin()
+{
+    CurrentStamp_++;
+}
+
+/*
+ * Add (or update) object's interval.
+ */
+void cSortAndSweep::Add(const void *Id, unsigned Index, float Min, float Max)
+{
+    auto iter = Positions_.find(Id);
+    if (iter == Positions_.end()) {
+        Positions_.emplace(Id, static_cast<unsigned>(Entries_.size()));
+        Entries_.emplace_back();
+        Entries_.back().Id = Id;
+        iter = Positions_.find(Id);
+    }
+
+    sEntry &tmpEntry = Entries_[iter->second];
+    tmpEntry.Index = Index;
+    tmpEntry.Min = Min;
+    tmpEntry.Max = Max;
+    tmpEntry.Stamp = CurrentStamp_;
+}
+
+/*
+ * Remove objects, that were not added since Begin() call, and sort intervals.
+ */
+void cSortAndSweep::End()
+{
+    unsigned NewSize{0};
+    for (unsigned i = 0; i < Entries_.size(); i++) {
+        if (Entries_[i].Stamp != CurrentStamp_) {
+            Positions_.erase(Entries_[i].Id);
+            continue;
+        }
+        Entries_[NewSize++] = Entries_[i];
+    }
+    Entries_.resize(NewSize);
+
+    // insertion sort, objects order from previous call is almost sorted,
+    // new objects are added at the end
+    for (unsigned i = 1; i < Entries_.size(); i++) {
+        if (!(Entries_[i].Min < Entries_[i - 1].Min)) {
+            continue;
+        }
+        sEntry tmpEntry = Entries_[i];
+        unsigned j = i;
+        for (; j > 0 && tmpEntry.Min < Entries_[j - 1].Min; j--) {
+            Entries_[j] = Entries_[j - 1];
+        }
+        Entries_[j] = tmpEntry;
+    }
+
+    for (unsigned i = 0; i < Entries_.size(); i++) {
+        Positions_[Entries_[i].Id] = i;
+    }
+}
+
+/*
+ * Find all pairs with overlapped intervals.
+ */
+void cSortAndSweep::Pairs(std::vector<std::pair<unsigned, unsigned>> &Result) const
+{
+    Result.clear();
+
+    for (unsigned i = 0; i < Entries_.size(); i++) {
+        // since entries sorted by Min, all next entries have Max >= Entries_[i].Min
+        for (unsigned j = i + 1; j < Entries_.size() && Entries_[j].Min <= Entries_[i].Max; j++) {
+            Result.emplace_back(std::min(Entries_[i].Index, Entries_[j].Index),
+                                std::max(Entries_[i].Index, Entries_[j].Index));
+        }
+    }
+
+    std::sort(Result.begin(), Result.end());
+}
+
+} // viewizard namespace
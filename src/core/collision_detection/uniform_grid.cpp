@@ -0,0 +1,240 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+#include "collision_detection.h"
+
+namespace viewizard {
+
+namespace {
+
+// buckets quantity, should be power of 2
+constexpr unsigned BucketsCount{4096};
+// boxes, that cover more cells per axis, are not distributed into level's cells
+constexpr float MaxCellsPerAxis{8.0f};
+// limit for cells coordinates, in order to avoid integer overflow
+constexpr float MaxCellCoord{1000000.0f};
+
+} // unnamed namespace
+
+
+/*
+ * Calculate bucket for cell.
+ */
+static inline unsigned CellBucket(int x, int y, int z)
+{
+    return ((static_cast<unsigned>(x) * 73856093u)
+            ^ (static_cast<unsigned>(y) * 19349663u)
+            ^ (static_cast<unsigned>(z) * 83492791u)) & (BucketsCount - 1);
+}
+
+/*
+ * Check, are boxes overlap.
+ */
+static inline bool BoxesOverlap(const sVECTOR3D &Min1, const sVECTOR3D &Max1,
+                                const sVECTOR3D &Min2, const sVECTOR3D &Max2)
+{
+    return (Min1.x <= Max2.x) && (Max1.x >= Min2.x)
+           && (Min1.y <= Max2.y) && (Max1.y >= Min2.y)
+           && (Min1.z <= Max2.z) && (Max1.z >= Min2.z);
+}
+
+/*
+ * Calculate cells range for box.
+ * Return false, if box covers too many cells (or have NaN/too big coordinates).
+ */
+bool cUniformGrid::CellsRange(float InvCellSize, const sVECTOR3D &Min, const sVECTOR3D &Max,
+                              int (&From)[3], int (&To)[3])
+{
+    float tmpMin[3]{Min.x * InvCellSize, Min.y * InvCellSize, Min.z * InvCellSize};
+    float tmpMax[3]{Max.x * InvCellSize, Max.y * InvCellSize, Max.z * InvCellSize};
+
+    for (int i = 0; i < 3; i++) {
+        // note, NaN also will be rejected here
+        if (!(tmpMax[i] - tmpMin[i] <= MaxCellsPerAxis)
+            || !(fabsf(tmpMin[i]) < MaxCellCoord)
+            || !(fabsf(tmpMax[i]) < MaxCellCoord)) {
+            return false;
+        }
+        From[i] = static_cast<int>(floorf(tmpMin[i]));
+        To[i] = static_cast<int>(floorf(tmpMax[i]));
+    }
+
+    return true;
+}
+
+/*
+ * Remove all boxes.
+ */
+void cUniformGrid::Clear()
+{
+    Boxes_.clear();
+    for (unsigned i = 0; i < LevelsCount_; i++) {
+        Levels_[i].OversizedBoxes.clear();
+        Levels_[i].BucketItems.clear();
+    }
+}
+
+/*
+ * Add box, return box index.
+ */
+unsigned cUniformGrid::Add(const sVECTOR3D &Min, const sVECTOR3D &Max)
+{
+    Boxes_.emplace_back();
+    Boxes_.back().Min = Min;
+    Boxes_.back().Max = Max;
+    return static_cast<unsigned>(Boxes_.size() - 1);
+}
+
+/*
+ * Distribute all added boxes into level's cells.
+ */
+void cUniformGrid::BuildLevel(sLevel &Level)
+{
+    Level.BucketStart.assign(BucketsCount + 1, 0);
+
+    int From[3];
+    int To[3];
+
+    // count items per bucket, note, same box could be counted for one bucket few times
+    for (unsigned i = 0; i < Boxes_.size(); i++) {
+        if (!CellsRange(Level.InvCellSize, Boxes_[i].Min, Boxes_[i].Max, From, To)) {
+            Level.OversizedBoxes.push_back(i);
+            continue;
+        }
+        for (int x = From[0]; x <= To[0]; x++) {
+            for (int y = From[1]; y <= To[1]; y++) {
+                for (int z = From[2]; z <= To[2]; z++) {
+                    Level.BucketStart[CellBucket(x, y, z)]++;
+                }
+            }
+        }
+    }
+
+    // now, BucketStart[i] is the end of bucket 'i'
+    for (unsigned i = 1; i < BucketsCount; i++) {
+        Level.BucketStart[i] += Level.BucketStart[i - 1];
+    }
+    Level.BucketStart[BucketsCount] = Level.BucketStart[BucketsCount - 1];
+    Level.BucketItems.resize(Level.BucketStart[BucketsCount]);
+
+    // fill buckets from the end, as result, BucketStart[i] will be moved to the beginning of bucket 'i'
+    for (unsigned i = 0; i < Boxes_.size(); i++) {
+        if (!CellsRange(Level.InvCellSize, Boxes_[i].Min, Boxes_[i].Max, From, To)) {
+            continue;
+        }
+        for (int x = From[0]; x <= To[0]; x++) {
+            for (int y = From[1]; y <= To[1]; y++) {
+                for (int z = From[2]; z <= To[2]; z++) {
+                    Level.BucketItems[--Level.BucketStart[CellBucket(x, y, z)]] = i;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Distribute all added boxes into grid cells.
+ */
+void cUniformGrid::Build()
+{
+    if (Stamps_.size() < Boxes_.size()) {
+        Stamps_.resize(Boxes_.size(), 0);
+    }
+
+    for (unsigned i = 0; i < LevelsCount_; i++) {
+        BuildLevel(Levels_[i]);
+    }
+}
+
+/*
+ * Find all boxes, that overlap provided box.
+ */
+void cUniformGrid::Query(const sVECTOR3D &Min, const sVECTOR3D &Max, std::vector<unsigned> &Result)
+{
+    Result.clear();
+    Statistic_.Queries++;
+
+    // use first level, that could serve box
+    int From[3];
+    int To[3];
+    const sLevel *QueryLevel{nullptr};
+    for (unsigned i = 0; i < LevelsCount_; i++) {
+        if (CellsRange(Levels_[i].InvCellSize, Min, Max, From, To)) {
+            QueryLevel = &Levels_[i];
+            break;
+        }
+    }
+
+    if (!QueryLevel) {
+        // too big box, cheaper to check all boxes directly
+        Statistic_.LinearQueries++;
+        for (unsigned i = 0; i < Boxes_.size(); i++) {
+            if (BoxesOverlap(Min, Max, Boxes_[i].Min, Boxes_[i].Max)) {
+                Result.push_back(i);
+            }
+        }
+        return;
+    }
+    if (QueryLevel != &Levels_[0]) {
+        Statistic_.CoarseQueries++;
+    }
+
+    CurrentStamp_++;
+    if (CurrentStamp_ == 0) {
+        std::fill(Stamps_.begin(), Stamps_.end(), 0);
+        CurrentStamp_ = 1;
+    }
+
+    for (int x = From[0]; x <= To[0]; x++) {
+        for (int y = From[1]; y <= To[1]; y++) {
+            for (int z = From[2]; z <= To[2]; z++) {
+                unsigned Bucket = CellBucket(x, y, z);
+                for (unsigned i = QueryLevel->BucketStart[Bucket]; i < QueryLevel->BucketStart[Bucket + 1]; i++) {
+                    unsigned tmpBox = QueryLevel->BucketItems[i];
+                    // different cells could share the same bucket, and box could cover few cells
+                    if (Stamps_[tmpBox] == CurrentStamp_) {
+                        continue;
+                    }
+                    Stamps_[tmpBox] = CurrentStamp_;
+                    if (BoxesOverlap(Min, Max, Boxes_[tmpBox].Min, Boxes_[tmpBox].Max)) {
+                        Result.push_back(tmpBox);
+                    }
+                }
+            }
+        }
+    }
+
+    for (auto &tmpBox : QueryLevel->OversizedBoxes) {
+        if (BoxesOverlap(Min, Max, Boxes_[tmpBox].Min, Boxes_[tmpBox].Max)) {
+            Result.push_back(tmpBox);
+        }
+    }
+
+    std::sort(Result.begin(), Result.end());
+}
+
+} // viewizard namespace
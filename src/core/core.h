@@ -33,6 +33,7 @@
 #include "collision_detection/collision_detection.h"
 #include "font/font.h"
 #include "graphics/graphics.h"
+#include "job_system/job_system.h"
 #include "light/light.h"
 #include "math/math.h"
 #include "model3d/model3d.h"
@@ -28,13 +28,6 @@
 // TODO move to std::string, probably, we need move directly to std::u32string (utf32)
 //      for all text rendering and text input (profile names)
 
-// TODO provide static vw_DrawText(), dynamic realization we have now,
-//      static should create array with text blocks as key and VBO/VAO/IBO (and other data)
-//      as value for fast rendering.
-
-// TODO switch to std::unordered_multimap from std::forward_list
-//      that will allow fast access and we could manually check second key (FontSize)
-
 // TODO (?) add VBO (DYNAMIC) and VAO
 
 // NOTE in future, use make_unique() to make unique_ptr-s (since C++14)
@@ -65,17 +58,12 @@ sIF_dual_type<unsigned, float> InternalFontSize{0};
 constexpr float GlobalFontOffsetY{2.0f}; // FIXME 'fix' for legacy related code, since previously we are used texture instead of
                                          //       freetype, so, all vw_DrawText() calls have wrong Y position now in game code
 
+// texture's UV coordinates, origin is upper left corner
 struct sTexturePos {
-    float left, top, right, bottom;
-
-    explicit sTexturePos(const unsigned _left, const unsigned _top,
-                         const unsigned _right, const unsigned _bottom) :
-        /* we are safe with static_cast here, since size will not exceed 'float' */
-        left{static_cast<float>(_left)},
-        top{static_cast<float>(_top)},
-        right{static_cast<float>(_right)},
-        bottom{static_cast<float>(_bottom)}
-    {}
+    float left{0.0f};
+    float top{0.0f};
+    float right{0.0f};
+    float bottom{0.0f};
 };
 
 struct sFontMetrics {
@@ -100,27 +88,75 @@ struct sFontChar {
     char32_t UTF32; // key element 1 (UTF32 code)
     sIF_dual_type<unsigned, float> FontSize; // key element 2 (character generated size)
 
-    GLtexture Texture{0};
-    sTexturePos TexturePos;
+    GLtexture Texture{0}; // atlas page's texture, zero for characters without bitmap (space)
+    sTexturePos TexturePos{};
     sFontMetrics FontMetrics;
 
     explicit sFontChar(char32_t _UTF32, const sIF_dual_type<unsigned, float> &_FontSize,
-                       const sTexturePos &_TexturePos,
                        const sFontMetrics &_FontMetrics) :
         UTF32{_UTF32},
         FontSize{_FontSize},
-        TexturePos{_TexturePos},
         FontMetrics{_FontMetrics}
     {}
-    // trick for forward_list<unique_ptr<T>> work with iterator
-    bool CheckUTF32andSize(char32_t _UTF32)
-    {
-        return (UTF32 == _UTF32 && FontSize == InternalFontSize);
-    }
 };
 
-// List with connected font characters.
+// Open addressing (linear probing) hash table slot, key is (UTF32, FontSize).
+struct sFontCharSlot {
+    char32_t UTF32{0};
+    unsigned FontSize{0};
+    sFontChar *FontChar{nullptr}; // nullptr for empty slot
+};
+
+// Shelf (line with fixed height) in font atlas page.
+struct sFontAtlasShelf {
+    unsigned Y{0};
+    unsigned Height{0};
+    unsigned NextX{0};
+};
+
+// Text layout block, characters with same texture.
+struct sTextLayoutBlock {
+    GLtexture Texture{0};
+    unsigned Start{0}; // first vertex array element
+    unsigned Size{0}; // vertex array elements count
+};
+
+// Cached text layout, quads with origin in text's upper left corner.
+struct sTextLayout {
+    // key elements
+    std::u32string Text{};
+    unsigned FontSize{0};
+    float StrictWidth{0.0f};
+    float ExpandWidth{0.0f};
+    float FontScale{0.0f};
+
+    std::vector<float> Vertices{};
+    std::vector<sTextLayoutBlock> Blocks{};
+};
+
+// Font atlas page, characters for all font sizes are packed into pages by shelves.
+struct sFontAtlasPage {
+    GLtexture Texture{0};
+    unsigned Width{0};
+    unsigned Height{0};
+    unsigned ShelvesEnd{0}; // first free line after last shelf
+    std::vector<sFontAtlasShelf> Shelves{};
+};
+
+// All font characters, std::forward_list keep pointers valid on insertion.
 std::forward_list<std::unique_ptr<sFontChar>> FontCharsList;
+// Font characters hash table, should have power of 2 size.
+std::vector<sFontCharSlot> FontCharsTable{};
+unsigned FontCharsCount{0};
+constexpr unsigned FontCharsTableInitialSize{512};
+// Cached text layouts, key is hash for text and font size.
+std::unordered_multimap<std::size_t, sTextLayout> TextLayoutCache{};
+constexpr std::size_t TextLayoutCacheMaxSize{1024};
+// Font atlas pages.
+std::vector<sFontAtlasPage> FontAtlasPages{};
+constexpr unsigned FontAtlasPageSize{512};
+// space between characters in atlas page, in order to avoid bilinear filtering artifacts
+constexpr unsigned FontAtlasEdgingSpace{2};
 // Local vertex array, that dynamically allocate memory at maximum required
 // size only one time per game execution. Don't use std::vector here,
 // since it have poor performance compared to std::unique_ptr.
@@ -186,17 +222,68 @@ void vw_SetFontSize(int FontSize)
     InternalFontSize = FontSize;
 }
 
+/*
+ * Calculate font characters hash table start slot.
+ */
+static inline unsigned FontCharSlot(char32_t UTF32, unsigned FontSize)
+{
+    return ((static_cast<unsigned>(UTF32) * 2654435761u)
+            ^ (FontSize * 40503u)) & (static_cast<unsigned>(FontCharsTable.size()) - 1);
+}
+
+/*
+ * Add font character into hash table (without size check).
+ */
+static void InsertFontCharSlot(sFontChar *FontChar)
+{
+    unsigned Mask = static_cast<unsigned>(FontCharsTable.size()) - 1;
+    unsigned Slot = FontCharSlot(FontChar->UTF32, FontChar->FontSize.i());
+    while (FontCharsTable[Slot].FontChar) {
+        Slot = (Slot + 1) & Mask;
+    }
+    FontCharsTable[Slot].UTF32 = FontChar->UTF32;
+    FontCharsTable[Slot].FontSize = FontChar->FontSize.i();
+    FontCharsTable[Slot].FontChar = FontChar;
+}
+
+/*
+ * Add font character into hash table, grow table if load factor more than 0.5.
+ */
+static void AddFontCharToTable(sFontChar *FontChar)
+{
+    if ((FontCharsCount + 1) * 2 > FontCharsTable.size()) {
+        std::vector<sFontCharSlot> tmpTable{};
+        tmpTable.swap(FontCharsTable);
+        FontCharsTable.resize(std::max(FontCharsTableInitialSize,
+                                       static_cast<unsigned>(tmpTable.size()) * 2));
+        for (const auto &tmpSlot : tmpTable) {
+            if (tmpSlot.FontChar) {
+                InsertFontCharSlot(tmpSlot.FontChar);
+            }
+        }
+    }
+
+    InsertFontCharSlot(FontChar);
+    FontCharsCount++;
+}
+
 /*
  * Find font by UTF32 code.
  */
 static sFontChar *FindFontCharByUTF32(char32_t UTF32)
 {
-    // a bit tricky, since we can't work with iterator for
-    // forward_list<unique_ptr<T>> in usual way
-    for (const auto &tmpChar : FontCharsList) {
-        if (tmpChar->CheckUTF32andSize(UTF32)) {
-            return tmpChar.get();
+    if (FontCharsTable.empty()) {
+        return nullptr;
+    }
+
+    unsigned Mask = static_cast<unsigned>(FontCharsTable.size()) - 1;
+    unsigned Slot = FontCharSlot(UTF32, InternalFontSize.i());
+    // table always have empty slots, since load factor is limited
+    while (FontCharsTable[Slot].FontChar) {
+        if (FontCharsTable[Slot].UTF32 == UTF32 && FontCharsTable[Slot].FontSize == InternalFontSize.i()) {
+            return FontCharsTable[Slot].FontChar;
         }
+        Slot = (Slot + 1) & Mask;
     }
 
     return nullptr;
@@ -215,12 +302,18 @@ bool vw_CheckFontCharByUTF32(char32_t UTF32)
  */
 void vw_ReleaseAllFontChars()
 {
-    // release all font characters
-    while (!FontCharsList.empty()) {
-        vw_ReleaseTexture(FontCharsList.front()->Texture);
-        FontCharsList.pop_front();
+    // release all atlas pages
+    for (auto &tmpPage : FontAtlasPages) {
+        vw_ReleaseTexture(tmpPage.Texture);
     }
-    // reset list
+    FontAtlasPages.clear();
+
+    // layouts refer to released textures
+    TextLayoutCache.clear();
+
+    // release all font characters
+    FontCharsTable.clear();
+    FontCharsCount = 0;
     FontCharsList.clear();
 
     // FIXME probably, this part should be moved to separate method and call only on OpenGL context destroy
@@ -240,15 +333,132 @@ void vw_ShutdownFont()
 }
 
 /*
- * Load data and generate font character.
+ * Find place in atlas page's shelves for area with provided size.
  */
-static sFontChar *LoadFontChar(char32_t UTF32)
+static bool FindAtlasPagePlace(sFontAtlasPage &Page, unsigned Width, unsigned Height,
+                               unsigned &X, unsigned &Y)
 {
-    // setup parameters
-    if (FT_Set_Char_Size(InternalFace, InternalFontSize.i() << 6, InternalFontSize.i() << 6, 96, 96)) {
-        std::cerr << __func__ << "(): " << "Can't set char size " << InternalFontSize.i() << "\n";
+    // best fit by height, in order to waste less space
+    sFontAtlasShelf *BestShelf{nullptr};
+    for (auto &tmpShelf : Page.Shelves) {
+        if (tmpShelf.Height >= Height
+            && tmpShelf.NextX + Width <= Page.Width
+            && (!BestShelf || tmpShelf.Height < BestShelf->Height)) {
+            BestShelf = &tmpShelf;
+        }
+    }
+
+    // don't put small characters into too high shelf, if we could open new shelf
+    bool CanOpenShelf = (Page.ShelvesEnd + Height <= Page.Height) && (Width <= Page.Width);
+    if (!BestShelf || (CanOpenShelf && BestShelf->Height > Height + Height / 2)) {
+        if (!CanOpenShelf) {
+            return false;
+        }
+        Page.Shelves.emplace_back();
+        BestShelf = &Page.Shelves.back();
+        BestShelf->Y = Page.ShelvesEnd;
+        BestShelf->Height = Height;
+        Page.ShelvesEnd += Height;
+    }
+
+    X = BestShelf->NextX;
+    Y = BestShelf->Y;
+    BestShelf->NextX += Width;
+    return true;
+}
+
+/*
+ * Create new atlas page, page could be bigger than default size for really big characters.
+ */
+static sFontAtlasPage *CreateAtlasPage(unsigned MinWidth, unsigned MinHeight)
+{
+    unsigned Width{FontAtlasPageSize};
+    while (Width < MinWidth) {
+        Width *= 2;
+    }
+    unsigned Height{FontAtlasPageSize};
+    while (Height < MinHeight) {
+        Height *= 2;
+    }
+
+    // make sure, pixels filled by black and alpha set to zero (0),
+    // or we will have white borders on each character
+    std::unique_ptr<uint8_t[]> tmpPixels(new uint8_t[Width * Height * 4]);
+    memset(tmpPixels.get(), 0 /*black + transparent*/, Width * Height * 4);
+
+    vw_SetTextureProp(sTextureFilter{eTextureBasicFilter::BILINEAR}, 1,
+                      sTextureWrap{eTextureWrapMode::CLAMP_TO_EDGE},
+                      true, eAlphaCreateMode::GREYSC, false);
+    std::string tmpTextureName{"font_atlas_page_" + std::to_string(FontAtlasPages.size())};
+    GLtexture tmpTexture = vw_CreateTextureFromMemory(tmpTextureName, tmpPixels, Width, Height, 4);
+    if (!tmpTexture) {
+        std::cerr << __func__ << "(): " << "Can't create font atlas page texture.\n";
         return nullptr;
     }
+
+    FontAtlasPages.emplace_back();
+    FontAtlasPages.back().Texture = tmpTexture;
+    FontAtlasPages.back().Width = Width;
+    FontAtlasPages.back().Height = Height;
+    return &FontAtlasPages.back();
+}
+
+/*
+ * Put font character's bitmap (FreeType glyph) into atlas page.
+ */
+static void PutFontCharIntoAtlas(sFontChar &FontChar, const uint8_t *Bitmap)
+{
+    unsigned CharWidth = FontChar.FontMetrics.Width.i();
+    unsigned CharHeight = FontChar.FontMetrics.Height.i();
+    unsigned AreaWidth = CharWidth + FontAtlasEdgingSpace;
+    unsigned AreaHeight = CharHeight + FontAtlasEdgingSpace;
+
+    // last page usually have free space, check it first
+    unsigned X{0};
+    unsigned Y{0};
+    sFontAtlasPage *Page{nullptr};
+    for (auto iter = FontAtlasPages.rbegin(); iter != FontAtlasPages.rend(); ++iter) {
+        if (FindAtlasPagePlace(*iter, AreaWidth, AreaHeight, X, Y)) {
+            Page = &(*iter);
+            break;
+        }
+    }
+    if (!Page) {
+        Page = CreateAtlasPage(AreaWidth, AreaHeight);
+        if (!Page || !FindAtlasPagePlace(*Page, AreaWidth, AreaHeight, X, Y)) {
+            return;
+        }
+    }
+
+    // buffer for RGBA, initialize it with white color (255)
+    std::unique_ptr<uint8_t[]> tmpPixels(new uint8_t[CharWidth * CharHeight * 4]);
+    memset(tmpPixels.get(), 255 /*white*/, CharWidth * CharHeight * 4);
+    // convert greyscale to RGB+Alpha (32bits), now we need correct only alpha channel,
+    // since texture's origin is lower left corner, flip rows
+    for (unsigned j = 0; j < CharHeight; j++) {
+        unsigned StrideDst = j * CharWidth * 4;
+        unsigned StrideSrc = (CharHeight - j - 1) * CharWidth;
+        for (unsigned i = 0; i < CharWidth; i++) {
+            tmpPixels[StrideDst + i * 4 + 3] = Bitmap[StrideSrc + i];
+        }
+    }
+    // we are safe with static_cast here, since page size will not exceed 'GLint'
+    vw_UpdateTexture(Page->Texture, static_cast<GLint>(X), static_cast<GLint>(Page->Height - Y - CharHeight),
+                     static_cast<GLsizei>(CharWidth), static_cast<GLsizei>(CharHeight), 4, tmpPixels.get());
+
+    FontChar.Texture = Page->Texture;
+    // we are safe with static_cast here, since size will not exceed 'float'
+    FontChar.TexturePos.left = static_cast<float>(X) / static_cast<float>(Page->Width);
+    FontChar.TexturePos.right = static_cast<float>(X + CharWidth) / static_cast<float>(Page->Width);
+    FontChar.TexturePos.top = static_cast<float>(Y) / static_cast<float>(Page->Height);
+    FontChar.TexturePos.bottom = static_cast<float>(Y + CharHeight) / static_cast<float>(Page->Height);
+}
+
+/*
+ * Load glyph and generate font character, FreeType char size should be already set.
+ */
+static sFontChar *CreateFontChar(char32_t UTF32)
+{
     // load glyph
     if (FT_Load_Char(InternalFace, UTF32, FT_LOAD_RENDER | FT_LOAD_NO_HINTING | FT_LOAD_NO_AUTOHINT)) {
         std::cerr << __func__ << "(): " << "Can't load glyph: " << UTF32 << "\n";
@@ -257,42 +467,33 @@ static sFontChar *LoadFontChar(char32_t UTF32)
 
     // create new character
     FontCharsList.emplace_front(new sFontChar(UTF32, InternalFontSize,
-                                sTexturePos{0, 0, InternalFace->glyph->bitmap.width, InternalFace->glyph->bitmap.rows},
                                 sFontMetrics{InternalFace->glyph->bitmap_left, InternalFace->glyph->bitmap_top,
                                              InternalFace->glyph->bitmap.width, InternalFace->glyph->bitmap.rows,
                                              InternalFace->glyph->advance.x /* in 1/64th of points */}));
+    sFontChar *tmpChar = FontCharsList.front().get();
+    AddFontCharToTable(tmpChar);
 
-    if ((FontCharsList.front()->FontMetrics.Width.i() > 0) && (FontCharsList.front()->FontMetrics.Height.i() > 0)) {
-        // buffer for RGBA, data for font characters texture, initialize it with white color (255)
-        std::unique_ptr<uint8_t[]> tmpPixels(new uint8_t[FontCharsList.front()->FontMetrics.Width.i() *
-                                             FontCharsList.front()->FontMetrics.Height.i() * 4]);
-        memset(tmpPixels.get(), 255 /*white*/, FontCharsList.front()->FontMetrics.Width.i() *
-               FontCharsList.front()->FontMetrics.Height.i() * 4);
-        // convert greyscale to RGB+Alpha (32bits), now we need correct only alpha channel
-        for (unsigned j = 0; j < FontCharsList.front()->FontMetrics.Height.i(); j++) {
-            int StrideSrc = j * FontCharsList.front()->FontMetrics.Width.i() * 4;
-            int StrideDst = (FontCharsList.front()->FontMetrics.Height.i() - j - 1) *
-                            FontCharsList.front()->FontMetrics.Width.i();
-            for (unsigned i = 0; i < FontCharsList.front()->FontMetrics.Width.i(); i++) {
-                // alpha channel
-                memcpy(tmpPixels.get() + StrideSrc + i * 4 + 3,
-                       InternalFace->glyph->bitmap.buffer + StrideDst + i,
-                       1);
-            }
-        }
+    if ((tmpChar->FontMetrics.Width.i() > 0) && (tmpChar->FontMetrics.Height.i() > 0)) {
+        PutFontCharIntoAtlas(*tmpChar, InternalFace->glyph->bitmap.buffer);
+    }
 
-        // fake texture file name based on font's size and UTF32 code
-        std::string FakeTextureFileName{"fontsize_" + std::to_string(InternalFontSize.i()) +
-                                        "_character_" + std::to_string(UTF32)};
+    return tmpChar;
+}
 
-        vw_SetTextureProp(sTextureFilter{eTextureBasicFilter::BILINEAR}, 1,
-                          sTextureWrap{eTextureWrapMode::CLAMP_TO_EDGE},
-                          true, eAlphaCreateMode::GREYSC, false);
-        FontCharsList.front()->Texture = vw_CreateTextureFromMemory(FakeTextureFileName, tmpPixels,
-                                         FontCharsList.front()->FontMetrics.Width.i(),
-                                         FontCharsList.front()->FontMetrics.Height.i(),
-                                         4, eTextureCompressionType::NONE,
-                                         0, 0);
+/*
+ * Load data and generate font character.
+ */
+static sFontChar *LoadFontChar(char32_t UTF32)
+{
+    // setup parameters
+    if (FT_Set_Char_Size(InternalFace, InternalFontSize.i() << 6, InternalFontSize.i() << 6, 96, 96)) {
+        std::cerr << __func__ << "(): " << "Can't set char size " << InternalFontSize.i() << "\n";
+        return nullptr;
+    }
+
+    sFontChar *tmpChar = CreateFontChar(UTF32);
+    if (!tmpChar) {
+        return nullptr;
     }
 
     std::cout << "Font character was created for size: "
@@ -300,11 +501,12 @@ static sFontChar *LoadFontChar(char32_t UTF32)
               << ConvertUTF8.to_bytes(UTF32) << "',  code: "
               << "0x" << std::uppercase << std::hex << UTF32 << std::dec << "\n";
 
-    return FontCharsList.front().get();
+    return tmpChar;
 }
 
 /*
  * Generate font characters by list.
+ * Characters are packed into atlas pages, new pages will have at least provided size.
  */
 int vw_GenerateFontChars(unsigned FontTextureWidth, unsigned FontTextureHeight,
                          const std::unordered_set<char32_t> &CharsSetUTF32)
@@ -315,12 +517,6 @@ int vw_GenerateFontChars(unsigned FontTextureWidth, unsigned FontTextureHeight,
 
     std::cout << "Font characters generation start.\n";
 
-    // buffer for RGBA, data for font characters texture
-    // make sure, tmpPixels filled by black and alpha set to zero (0),
-    // or we will have white borders on each character
-    std::unique_ptr<uint8_t[]> tmpPixels(new uint8_t[FontTextureWidth * FontTextureHeight * 4]);
-    memset(tmpPixels.get(), 0 /*black + transparent*/, FontTextureWidth * FontTextureHeight * 4);
-
     // initial setup
     if (FT_Set_Char_Size(InternalFace /* handle to face object */,
                          InternalFontSize.i() << 6 /* char_width in 1/64th of points */,
@@ -331,85 +527,17 @@ int vw_GenerateFontChars(unsigned FontTextureWidth, unsigned FontTextureHeight,
         return ERR_EXT_RES;
     }
 
-    // create one large bitmap with all font characters from list
-    int CurrentPixelsX{0};
-    int CurrentPixelsY{0};
-    int EdgingSpace{2};
-    unsigned MaxHeightInCurrentLine{0};
-    for (const auto &CurrentChar : CharsSetUTF32) {
-        // load glyph
-        if (FT_Load_Char(InternalFace, CurrentChar, FT_LOAD_RENDER | FT_LOAD_NO_HINTING | FT_LOAD_NO_AUTOHINT)) {
-            std::cerr << __func__ << "(): " << "Can't load Char: " << CurrentChar << "\n";
-            return ERR_EXT_RES;
-        }
-
-        FontCharsList.emplace_front(new sFontChar(CurrentChar, InternalFontSize,
-                                    sTexturePos{0, 0, 0, 0},
-                                    sFontMetrics{InternalFace->glyph->bitmap_left, InternalFace->glyph->bitmap_top,
-                                                 InternalFace->glyph->bitmap.width, InternalFace->glyph->bitmap.rows,
-                                                 InternalFace->glyph->advance.x /* in 1/64th of points */}));
-
-        // move to next line in bitmap if not enough space
-        if (CurrentPixelsX + FontCharsList.front()->FontMetrics.Width.i() > FontTextureWidth) {
-            CurrentPixelsX = 0;
-            CurrentPixelsY += MaxHeightInCurrentLine + EdgingSpace;
-            MaxHeightInCurrentLine = 0;
-        }
-        // looks like no more space left at all, fail
-        if (CurrentPixelsY + FontCharsList.front()->FontMetrics.Height.i() > FontTextureHeight) {
-            std::cerr << __func__ << "(): " << "Can't generate all font chars in one texture.\n"
-                      << "Too many chars or too small texture size!\n";
-            break;
-        }
-
-        // copy glyph into bitmap
-        uint8_t ColorRGB[3]{255, 255, 255};
-        for (unsigned j = 0; j < FontCharsList.front()->FontMetrics.Height.i(); j++) {
-            unsigned int tmpOffset = (FontTextureHeight - CurrentPixelsY - j - 1) * FontTextureWidth * 4;
-            for (unsigned i = 0; i < FontCharsList.front()->FontMetrics.Width.i(); i++) {
-                memcpy(tmpPixels.get() + tmpOffset + (CurrentPixelsX + i) * 4,
-                       ColorRGB,
-                       3);
-                memcpy(tmpPixels.get() + tmpOffset + (CurrentPixelsX + i) * 4 + 3,
-                       InternalFace->glyph->bitmap.buffer + j * FontCharsList.front()->FontMetrics.Width.i() + i,
-                       1);
-            }
-        }
-
-        // setup new character
-        // we are safe with static_cast here, since size will not exceed 'float'
-        FontCharsList.front()->TexturePos.left = static_cast<float>(CurrentPixelsX);
-        FontCharsList.front()->TexturePos.right = static_cast<float>(CurrentPixelsX)
-                                                  + FontCharsList.front()->FontMetrics.Width.f();
-        FontCharsList.front()->TexturePos.top = static_cast<float>(CurrentPixelsY);
-        FontCharsList.front()->TexturePos.bottom = static_cast<float>(CurrentPixelsY)
-                                                   + FontCharsList.front()->FontMetrics.Height.f();
-
-        // detect new line position by height
-        if (MaxHeightInCurrentLine < FontCharsList.front()->FontMetrics.Height.i()) {
-            MaxHeightInCurrentLine = FontCharsList.front()->FontMetrics.Height.i();
-        }
-        CurrentPixelsX += FontCharsList.front()->FontMetrics.Width.i() + EdgingSpace;
-    }
-
-    // create texture from bitmap
-    vw_SetTextureProp(sTextureFilter{eTextureBasicFilter::BILINEAR}, 1,
-                      sTextureWrap{eTextureWrapMode::CLAMP_TO_EDGE},
-                      true, eAlphaCreateMode::GREYSC, false);
-    std::string tmpTextureName{"auto_generated_texture_for_fonts_" +
-                               std::to_string(SDL_GetTicks()) + "_" +
-                               std::to_string(InternalFontSize.i())};
-    GLtexture FontTexture = vw_CreateTextureFromMemory(tmpTextureName, tmpPixels, FontTextureWidth, FontTextureHeight, 4);
-    if (!FontTexture) {
-        std::cerr << __func__ << "(): " << "Can't create font texture.\n";
+    // open new page with requested size, so, all characters from list will be close to each other
+    if (!CreateAtlasPage(FontTextureWidth, FontTextureHeight)) {
         return ERR_MEM;
     }
 
-    // setup texture to all font characters from list
     for (const auto &CurrentChar : CharsSetUTF32) {
-        sFontChar *tmpChar = FindFontCharByUTF32(CurrentChar);
-        if (tmpChar) {
-            tmpChar->Texture = FontTexture;
+        if (FindFontCharByUTF32(CurrentChar)) {
+            continue;
+        }
+        if (!CreateFontChar(CurrentChar)) {
+            return ERR_EXT_RES;
         }
     }
 
@@ -576,34 +704,39 @@ static void DrawBuffersRoutine(unsigned TextSize)
 }
 
 /*
- * Draw text with current font. Origin is upper left corner.
- *
- * StrictWidth - strict text by width:
- *      if StrictWidth > 0, reduce space width only
- *      if StrictWidth < 0, reduce all font character's width
- * ExpandWidth - expand width to provided parameter
+ * Find cached text layout, create new one if not found.
  */
-int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float FontScale,
-                     const sRGBCOLOR &Color, float Transp, const std::u32string &Text)
+static sTextLayout &FindTextLayout(float StrictWidth, float ExpandWidth, float FontScale,
+                                   const std::u32string &Text)
 {
-    if (Text.empty()) {
-        return ERR_PARAMETERS;
-    }
-    if (Transp >= 1.0f) {
-        Transp = 1.0f;
+    std::size_t tmpHash = std::hash<std::u32string>{}(Text) ^ (InternalFontSize.i() * 2654435761u);
+    auto range = TextLayoutCache.equal_range(tmpHash);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if ((iter->second.FontSize == InternalFontSize.i())
+            && (iter->second.StrictWidth == StrictWidth)
+            && (iter->second.ExpandWidth == ExpandWidth)
+            && (iter->second.FontScale == FontScale)
+            && (iter->second.Text == Text)) {
+            return iter->second;
+        }
     }
 
-    // 1) we are safe with static_cast here, since InternalFontSize * FontScale
-    //    will not exceed 'int' in our case for sure (usually, <100)
-    // 2) preference for checking integers, so, we convert float to int
-    //    for best speed and accuracy
-    if (Y + static_cast<int>(InternalFontSize.f() * FontScale) < 0) {
-        return 0; // it's ok, we work in proper way here
+    // strings with changeable content (numbers, timers) could produce a lot of layouts
+    if (TextLayoutCache.size() >= TextLayoutCacheMaxSize) {
+        TextLayoutCache.clear();
     }
 
+    sTextLayout &Layout = TextLayoutCache.emplace(tmpHash, sTextLayout{})->second;
+    Layout.Text = Text;
+    Layout.FontSize = InternalFontSize.i();
+    Layout.StrictWidth = StrictWidth;
+    Layout.ExpandWidth = ExpandWidth;
+    Layout.FontScale = FontScale;
+    // triangles points (4) * (RI_2f_XYZ + RI_2f_TEX) * Text.size()
+    Layout.Vertices.reserve(4 * (2 + 2) * Text.size());
+
     // start position on X axis for character
-    // we are safe with static_cast here, since X will be less that screen resolution (usually, <10000)
-    float Xstart{static_cast<float>(X)};
+    float Xstart{0.0f};
     // calculate default space width
     float SpaceWidthFactor{0};
     CalculateDefaultSpaceWidth(SpaceWidthFactor, FontScale);
@@ -618,57 +751,52 @@ int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float F
     // calculate text width, all characters that we already rendered
     float LineWidth{0};
 
-    vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
-    vw_SetColor(Color.r, Color.g, Color.b, Transp);
-    GLtexture CurrentTexture{0};
-    float ImageHeight{0.0f};
-    float ImageWidth{0.0f};
-
     // combine calculated width factor and global width scale
     FontWidthFactor = FontScale*FontWidthFactor;
 
-    // we are safe with static_cast here, since text size will not exceed 'unsigned' in our case for sure
-    DrawBuffersRoutine(static_cast<unsigned>(Text.size()));
+    auto AddVertex = [&Layout] (float CoordX, float CoordY, float TextureU, float TextureV) {
+        Layout.Vertices.push_back(CoordX);
+        Layout.Vertices.push_back(CoordY);
+        Layout.Vertices.push_back(TextureU);
+        Layout.Vertices.push_back(TextureV);
+    };
 
-    // draw all characters in text by blocks grouped by texture id
+    // split all characters in text by blocks grouped by texture id
     for (const auto &UTF32 : Text) {
         // find current character
         sFontChar *DrawChar = FindFontCharByUTF32(UTF32);
         if (!DrawChar) {
             DrawChar = LoadFontChar(UTF32);
         }
-        // for first character in text - setup texture by first character
-        if (!CurrentTexture) {
-            CurrentTexture = DrawChar->Texture;
-            vw_FindTextureSizeByID(DrawChar->Texture, &ImageWidth, &ImageHeight);
-        }
 
-        // looks like texture should be changed
-        if (CurrentTexture != DrawChar->Texture) {
-            DrawBufferOnTextureChange(CurrentTexture, DrawChar);
-            vw_FindTextureSizeByID(DrawChar->Texture, &ImageWidth, &ImageHeight);
+        // looks like texture should be changed (atlas page switch),
+        // characters without bitmap (space) don't have texture and should not break current block
+        if (DrawChar->Texture
+            && (Layout.Blocks.empty() || Layout.Blocks.back().Texture != DrawChar->Texture)) {
+            Layout.Blocks.emplace_back();
+            Layout.Blocks.back().Texture = DrawChar->Texture;
+            // we are safe with static_cast here, since text size will not exceed 'unsigned'
+            Layout.Blocks.back().Start = static_cast<unsigned>(Layout.Vertices.size());
         }
 
-        // put into draw buffer all characters data, except spaces
+        // put into layout all characters data, except spaces
         if (UTF32 != SpaceUTF32) {
-            float DrawX{Xstart + DrawChar->FontMetrics.X.f() * FontWidthFactor};
-            // we are safe with static_cast here, since X will be less that screen resolution (usually, <10000)
-            float DrawY{static_cast<float>(Y) + GlobalFontOffsetY
-                        + (InternalFontSize.f() - DrawChar->FontMetrics.Y.f()) * FontScale};
-
-            // texture's UV coordinates
-            float U_Left{DrawChar->TexturePos.left / ImageWidth};
-            float V_Top{DrawChar->TexturePos.top / ImageHeight};
-            float U_Right{DrawChar->TexturePos.right / ImageWidth};
-            float V_Bottom{DrawChar->TexturePos.bottom / ImageHeight};
-
-            // triangle's points (index buffer will provide proper sequence)
-            AddToDrawBuffer(DrawX, DrawY, U_Left, V_Top);
-            AddToDrawBuffer(DrawX, DrawY + DrawChar->FontMetrics.Height.f() * FontScale, U_Left, V_Bottom);
-            AddToDrawBuffer(DrawX + DrawChar->FontMetrics.Width.f() * FontWidthFactor,
-                            DrawY + DrawChar->FontMetrics.Height.f() * FontScale,
-                            U_Right, V_Bottom);
-            AddToDrawBuffer(DrawX + DrawChar->FontMetrics.Width.f() * FontWidthFactor, DrawY, U_Right, V_Top);
+            // characters without bitmap don't have texture, nothing to draw
+            if (DrawChar->Texture) {
+                float DrawX{Xstart + DrawChar->FontMetrics.X.f() * FontWidthFactor};
+                float DrawY{GlobalFontOffsetY + (InternalFontSize.f() - DrawChar->FontMetrics.Y.f()) * FontScale};
+
+                // triangle's points (index buffer will provide proper sequence)
+                AddVertex(DrawX, DrawY, DrawChar->TexturePos.left, DrawChar->TexturePos.top);
+                AddVertex(DrawX, DrawY + DrawChar->FontMetrics.Height.f() * FontScale,
+                          DrawChar->TexturePos.left, DrawChar->TexturePos.bottom);
+                AddVertex(DrawX + DrawChar->FontMetrics.Width.f() * FontWidthFactor,
+                          DrawY + DrawChar->FontMetrics.Height.f() * FontScale,
+                          DrawChar->TexturePos.right, DrawChar->TexturePos.bottom);
+                AddVertex(DrawX + DrawChar->FontMetrics.Width.f() * FontWidthFactor, DrawY,
+                          DrawChar->TexturePos.right, DrawChar->TexturePos.top);
+                Layout.Blocks.back().Size += 4 * (2 + 2);
+            }
 
             Xstart += DrawChar->FontMetrics.AdvanceX * FontWidthFactor;
             LineWidth += DrawChar->FontMetrics.AdvanceX * FontWidthFactor;
@@ -683,10 +811,62 @@ int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float F
         }
     }
 
-    // text is over, draw all we have in buffer
-    DrawBufferOnTextEnd(CurrentTexture);
+    return Layout;
+}
+
+/*
+ * Draw text with current font. Origin is upper left corner.
+ *
+ * StrictWidth - strict text by width:
+ *      if StrictWidth > 0, reduce space width only
+ *      if StrictWidth < 0, reduce all font character's width
+ * ExpandWidth - expand width to provided parameter
+ */
+int vw_DrawTextUTF32(int X, int Y, float StrictWidth, float ExpandWidth, float FontScale,
+                     const sRGBCOLOR &Color, float Transp, const std::u32string &Text)
+{
+    if (Text.empty()) {
+        return ERR_PARAMETERS;
+    }
+    if (Transp >= 1.0f) {
+        Transp = 1.0f;
+    }
+
+    // 1) we are safe with static_cast here, since InternalFontSize * FontScale
+    //    will not exceed 'int' in our case for sure (usually, <100)
+    // 2) preference for checking integers, so, we convert float to int
+    //    for best speed and accuracy
+    if (Y + static_cast<int>(InternalFontSize.f() * FontScale) < 0) {
+        return 0; // it's ok, we work in proper way here
+    }
+
+    // layout calculated only once for same text and parameters, here we only care about position and color
+    sTextLayout &Layout = FindTextLayout(StrictWidth, ExpandWidth, FontScale, Text);
+    if (Layout.Blocks.empty()) {
+        return 0;
+    }
+
+    // we are safe with static_cast here, since text size will not exceed 'unsigned' in our case for sure
+    DrawBuffersRoutine(static_cast<unsigned>(Text.size()));
+
+    vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
+    vw_SetColor(Color.r, Color.g, Color.b, Transp);
+    vw_PushMatrix();
+    // we are safe with static_cast here, since X and Y will be less that screen resolution (usually, <10000)
+    vw_Translate(sVECTOR3D{static_cast<float>(X), static_cast<float>(Y), 0.0f});
+
+    for (const auto &Block : Layout.Blocks) {
+        if (!Block.Size) {
+            continue;
+        }
+        vw_BindTexture(0, Block.Texture);
+        vw_Draw3D(ePrimitiveType::TRIANGLES, Block.Size * 6 / 16, // index / vertex size factor
+                  RI_2f_XY | RI_1_TEX, Layout.Vertices.data() + Block.Start,
+                  4 * sizeof(Layout.Vertices[0]), 0, 0, IndexArray.get(), IndexBO);
+    }
 
     // reset rendering states
+    vw_PopMatrix();
     vw_SetColor(1.0f, 1.0f, 1.0f, 1.0f);
     vw_SetTextureBlend(false, eTextureBlendFactor::ONE, eTextureBlendFactor::ZERO);
     vw_BindTexture(0, 0);
@@ -752,8 +932,6 @@ int vw_DrawText3DUTF32(float X, float Y, float Z, const std::u32string &Text)
     CalculateDefaultSpaceWidth(SpaceWidth, 1.0f /* don't scale */);
 
     GLtexture CurrentTexture{0};
-    float ImageHeight{0.0f};
-    float ImageWidth{0.0f};
     vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
 
     vw_PushMatrix();
@@ -775,16 +953,10 @@ int vw_DrawText3DUTF32(float X, float Y, float Z, const std::u32string &Text)
         if (!DrawChar) {
             DrawChar = LoadFontChar(UTF32);
         }
-        // for first character in text - setup texture by first character
-        if (!CurrentTexture) {
-            CurrentTexture = DrawChar->Texture;
-            vw_FindTextureSizeByID(DrawChar->Texture, &ImageWidth, &ImageHeight);
-        }
-
-        // looks like texture should be changed
-        if (CurrentTexture != DrawChar->Texture) {
+        // looks like texture should be changed (atlas page switch),
+        // characters without bitmap (space) don't have texture and should not break current block
+        if (DrawChar->Texture && (CurrentTexture != DrawChar->Texture)) {
             DrawBufferOnTextureChange(CurrentTexture, DrawChar);
-            vw_FindTextureSizeByID(DrawChar->Texture, &ImageWidth, &ImageHeight);
         }
 
         // put into draw buffer all characters data, except spaces
@@ -794,10 +966,10 @@ int vw_DrawText3DUTF32(float X, float Y, float Z, const std::u32string &Text)
 
             // texture's UV coordinates
             // convert origin from bottom left to upper left corner
-            float U_Left{DrawChar->TexturePos.left / ImageWidth};
-            float V_Top{1.0f - DrawChar->TexturePos.top / ImageHeight};
-            float U_Right{DrawChar->TexturePos.right / ImageWidth};
-            float V_Bottom{1.0f - DrawChar->TexturePos.bottom / ImageHeight};
+            float U_Left{DrawChar->TexturePos.left};
+            float V_Top{1.0f - DrawChar->TexturePos.top};
+            float U_Right{DrawChar->TexturePos.right};
+            float V_Bottom{1.0f - DrawChar->TexturePos.bottom};
 
             // triangle's points (index buffer will provide proper sequence)
             AddToDrawBuffer(DrawX / 10.0f, (DrawY + DrawChar->FontMetrics.Height.f()) / 10.0f, U_Left,V_Top);
@@ -37,8 +37,17 @@ namespace viewizard {
 
 namespace {
 
-float DrawBuffer[16]; // RI_2f_XY | RI_2f_TEX = (2 + 2) * 4 vertices = 16
-unsigned int DrawBufferCurrentPosition{0};
+constexpr float DegToRad = 3.14159f / 180.0f; // convert degree to radian
+// RI_2f_XY | RI_4f_COLOR | RI_1_TEX = 2 + 4 + 2
+constexpr unsigned BatchVertexSize{8};
+// batched quads (2 triangles each) with same texture and blend mode
+std::vector<float> BatchBuffer{};
+// swap buffer for flush, since vw_Draw3D() call vw_Flush2D() too
+std::vector<float> FlushBuffer{};
+GLtexture BatchTexture{0};
+bool BatchAlpha{false};
+// quads are batched in 2D mode only
+bool Batch2DMode{false};
 
 } // unnamed namespace
 
@@ -86,6 +95,8 @@ void vw_Start2DMode(GLdouble zNear, GLdouble zFar)
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
     glLoadIdentity();
+
+    Batch2DMode = true;
 }
 
 /*
@@ -94,6 +105,9 @@ void vw_Start2DMode(GLdouble zNear, GLdouble zFar)
  */
 void vw_End2DMode()
 {
+    vw_Flush2D();
+    Batch2DMode = false;
+
     // we don't switch to 0 unit, in 2D mode only 0 unit should be used
     glMatrixMode(GL_TEXTURE);
     glPopMatrix();
@@ -108,18 +122,52 @@ void vw_End2DMode()
 }
 
 /*
- * Add data to local draw buffer.
+ * Add vertex data to batch buffer.
+ * Vertex rotated around origin, same as glRotatef(RotateAngle, 0, 0, 1) do.
  */
-static inline void AddToDrawBuffer(float CoordX, float CoordY, float TextureU, float TextureV)
+static void AddToBatchBuffer(float CoordX, float CoordY, float TextureU, float TextureV,
+                                    const sRGBCOLOR &Color, float Transp, float Sin, float Cos)
 {
-    DrawBuffer[DrawBufferCurrentPosition++] = CoordX;
-    DrawBuffer[DrawBufferCurrentPosition++] = CoordY;
-    DrawBuffer[DrawBufferCurrentPosition++] = TextureU;
-    DrawBuffer[DrawBufferCurrentPosition++] = TextureV;
+    BatchBuffer.push_back(CoordX * Cos - CoordY * Sin);
+    BatchBuffer.push_back(CoordX * Sin + CoordY * Cos);
+    BatchBuffer.push_back(Color.r);
+    BatchBuffer.push_back(Color.g);
+    BatchBuffer.push_back(Color.b);
+    BatchBuffer.push_back(Transp);
+    BatchBuffer.push_back(TextureU);
+    BatchBuffer.push_back(TextureV);
+}
+
+/*
+ * Draw all batched 2D quads.
+ */
+void vw_Flush2D()
+{
+    if (BatchBuffer.empty()) {
+        return;
+    }
+
+    // vw_Draw3D() call vw_Flush2D() too, so, move all data to flush buffer first
+    BatchBuffer.swap(FlushBuffer);
+
+    vw_BindTexture(0, BatchTexture);
+    vw_SetTextureBlend(BatchAlpha, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
+
+    // we are safe with static_cast here, since vertices count will not exceed 'GLsizei'
+    vw_Draw3D(ePrimitiveType::TRIANGLES, static_cast<GLsizei>(FlushBuffer.size() / BatchVertexSize),
+              RI_2f_XY | RI_4f_COLOR | RI_1_TEX, FlushBuffer.data(), BatchVertexSize * sizeof(FlushBuffer[0]));
+    FlushBuffer.clear();
+
+    // restore previous OpenGL states
+    vw_SetTextureBlend(false, eTextureBlendFactor::ONE, eTextureBlendFactor::ZERO);
+    vw_SetColor(1.0f, 1.0f, 1.0f, 1.0f);
+    vw_BindTexture(0, 0);
 }
 
 /*
  * Draw transparent. Origin is upper left corner.
+ * In 2D mode, quads are batched (merged by texture and blend mode in draw order)
+ * and drawn on texture/blend mode change, by vw_Flush2D() or on vw_End2DMode() call.
  */
 void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bool Alpha,
                float Transp, float RotateAngle, const sRGBCOLOR &Color)
@@ -128,24 +176,32 @@ void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bo
         return;
     }
 
-    // bind texture before glGetTexLevelParameterfv() call
-    vw_BindTexture(0, Texture);
-
     float ImageHeight{0.0f};
     float ImageWidth{0.0f};
     // if texture loaded via textures manager, get data from it
     if (!vw_FindTextureSizeByID(Texture, &ImageWidth, &ImageHeight)) {
+        // bind texture before glGetTexLevelParameterfv() call
+        vw_BindTexture(0, Texture);
         // get Width and Height for 0 mipmap level
         // call glGetTexLevelParameterfv() is generally not recommended,
         // since it could stall the OpenGL pipeline
         glGetTexLevelParameterfv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &ImageWidth);
         glGetTexLevelParameterfv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &ImageHeight);
+        vw_BindTexture(0, 0);
     }
     if (!ImageHeight || !ImageWidth) {
         std::cerr << __func__ << "(): " << "zero image height or width not allowed.\n";
         return;
     }
 
+    // quads with different texture or blend mode can't be merged,
+    // draw all we have first in order to preserve draw order
+    if (!BatchBuffer.empty() && (BatchTexture != Texture || BatchAlpha != Alpha)) {
+        vw_Flush2D();
+    }
+    BatchTexture = Texture;
+    BatchAlpha = Alpha;
+
     // texture's UV coordinates
     // WARNING performance issue, remove conversion (blocked by sRECT)
     float U_left = static_cast<float>(SrcRect.left) / ImageWidth;
@@ -153,30 +209,31 @@ void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bo
     float U_right = static_cast<float>(SrcRect.right) / ImageWidth;
     float V_bottom = static_cast<float>(SrcRect.bottom) / ImageHeight;
 
-    // 'reset' buffer
-    DrawBufferCurrentPosition = 0;
-
-    // TRIANGLE_STRIP (2 triangles)
-    // WARNING performance issue, remove conversion (blocked by sRECT)
-    AddToDrawBuffer(static_cast<float>(DstRect.left), static_cast<float>(DstRect.top), U_left, V_top);
-    AddToDrawBuffer(static_cast<float>(DstRect.left), static_cast<float>(DstRect.bottom), U_left, V_bottom);
-    AddToDrawBuffer(static_cast<float>(DstRect.right), static_cast<float>(DstRect.top), U_right, V_top);
-    AddToDrawBuffer(static_cast<float>(DstRect.right), static_cast<float>(DstRect.bottom), U_right, V_bottom);
-
-    // setup OpenGL
-    vw_SetTextureBlend(Alpha, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
     vw_Clamp(Transp, 0.0f, 1.0f);
-    vw_SetColor(Color.r, Color.g, Color.b, Transp);
-    glPushMatrix();
-    glRotatef(RotateAngle, 0, 0, 1);
-
-    vw_Draw3D(ePrimitiveType::TRIANGLE_STRIP, 4, RI_2f_XY | RI_1_TEX, DrawBuffer, 4 * sizeof(DrawBuffer[0]));
+    float Sin{0.0f};
+    float Cos{1.0f};
+    if (RotateAngle != 0.0f) {
+        Sin = sinf(RotateAngle * DegToRad);
+        Cos = cosf(RotateAngle * DegToRad);
+    }
 
-    // restore previous OpenGL states
-    glPopMatrix();
-    vw_SetTextureBlend(false, eTextureBlendFactor::ONE, eTextureBlendFactor::ZERO);
-    vw_SetColor(1.0f, 1.0f, 1.0f, 1.0f);
-    vw_BindTexture(0, 0);
+    // TRIANGLES (2 triangles), same vertices sequence as TRIANGLE_STRIP had
+    // WARNING performance issue, remove conversion (blocked by sRECT)
+    float Left = static_cast<float>(DstRect.left);
+    float Top = static_cast<float>(DstRect.top);
+    float Right = static_cast<float>(DstRect.right);
+    float Bottom = static_cast<float>(DstRect.bottom);
+    AddToBatchBuffer(Left, Top, U_left, V_top, Color, Transp, Sin, Cos);
+    AddToBatchBuffer(Left, Bottom, U_left, V_bottom, Color, Transp, Sin, Cos);
+    AddToBatchBuffer(Right, Top, U_right, V_top, Color, Transp, Sin, Cos);
+    AddToBatchBuffer(Right, Top, U_right, V_top, Color, Transp, Sin, Cos);
+    AddToBatchBuffer(Left, Bottom, U_left, V_bottom, Color, Transp, Sin, Cos);
+    AddToBatchBuffer(Right, Bottom, U_right, V_bottom, Color, Transp, Sin, Cos);
+
+    // out of 2D mode we don't know, what will be changed before next call, draw it now
+    if (!Batch2DMode) {
+        vw_Flush2D();
+    }
 }
 
 } // viewizard namespace
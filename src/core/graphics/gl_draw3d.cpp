@@ -154,6 +154,9 @@ void vw_Draw3D(ePrimitiveType mode, GLsizei count, int DataFormat, GLvoid *Verte
         return;
     }
 
+    // preserve draw order for 2D quads, that were batched before
+    vw_Flush2D();
+
     if (VAO && vw_DevCaps().OpenGL_3_0_supported) {
         vw_BindVAO(VAO);
     } else {
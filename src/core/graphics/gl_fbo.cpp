@@ -182,6 +182,7 @@ std::shared_ptr<sFBO> vw_BuildFBO(GLsizei Width, GLsizei Height, bool NeedColor,
  */
 void vw_BindFBO(std::shared_ptr<sFBO> &FBO)
 {
+    vw_Flush2D();
     if (!pfn_glBindFramebuffer
         || (FBO && !FBO->FrameBufferObject)) {
         return;
@@ -219,6 +220,7 @@ std::weak_ptr<sFBO> &vw_GetCurrentFBO()
  */
 void vw_BlitFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &TargetFBO)
 {
+    vw_Flush2D();
     if (!SourceFBO || !TargetFBO || !pfn_glBindFramebuffer || !pfn_glBlitFramebuffer
         || !SourceFBO->FrameBufferObject || !TargetFBO->FrameBufferObject) {
         return;
@@ -236,6 +238,7 @@ void vw_BlitFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &TargetF
  */
 void vw_DrawColorFBO(std::shared_ptr<sFBO> &SourceFBO, std::shared_ptr<sFBO> &TargetFBO)
 {
+    vw_Flush2D();
     if (!SourceFBO || !SourceFBO->ColorTexture) {
         return;
     }
@@ -348,6 +348,7 @@ bool vw_LinkShaderProgram(std::weak_ptr<cGLSL> &GLSL)
  */
 bool vw_UseShaderProgram(std::shared_ptr<cGLSL> &sharedGLSL)
 {
+    vw_Flush2D();
     if (!pfn_glUseProgram || !sharedGLSL) {
         return false;
     }
@@ -372,6 +373,7 @@ bool vw_UseShaderProgram(std::weak_ptr<cGLSL> &GLSL)
  */
 bool vw_StopShaderProgram()
 {
+    vw_Flush2D();
     if (!pfn_glUseProgram) {
         return false;
     }
@@ -411,6 +413,7 @@ GLint vw_GetUniformLocation(std::weak_ptr<cGLSL> &GLSL, const std::string &Name)
  */
 bool vw_Uniform1i(GLint UniformLocation, int data)
 {
+    vw_Flush2D();
     if (!pfn_glUniform1i) {
         return false;
     }
@@ -426,6 +429,7 @@ bool vw_Uniform1i(GLint UniformLocation, int data)
  */
 bool vw_Uniform1f(GLint UniformLocation, float data)
 {
+    vw_Flush2D();
     if (!pfn_glUniform1f) {
         return false;
     }
@@ -441,6 +445,7 @@ bool vw_Uniform1f(GLint UniformLocation, float data)
  */
 bool vw_Uniform3f(GLint UniformLocation, float data1, float data2, float data3)
 {
+    vw_Flush2D();
     if (!pfn_glUniform3f) {
         return false;
     }
@@ -34,6 +34,7 @@ namespace viewizard {
  */
 void vw_Lighting(bool param)
 {
+    vw_Flush2D();
     if (param) {
         glEnable(GL_LIGHTING);
     } else {
@@ -46,6 +47,7 @@ void vw_Lighting(bool param)
  */
 void vw_LightEnable(GLenum light, bool param)
 {
+    vw_Flush2D();
     if (param) {
         glEnable(GL_LIGHT0 + light);
     } else {
@@ -58,6 +60,7 @@ void vw_LightEnable(GLenum light, bool param)
  */
 void vw_SetLight(GLenum light, eLightParameter pname, GLfloat param)
 {
+    vw_Flush2D();
     glLightf(GL_LIGHT0 + light, static_cast<GLenum>(pname), param);
 }
 
@@ -66,6 +69,7 @@ void vw_SetLight(GLenum light, eLightParameter pname, GLfloat param)
  */
 void vw_SetLightV(GLenum light, eLightVParameter pname, const GLfloat *param)
 {
+    vw_Flush2D();
     glLightfv(GL_LIGHT0 + light, static_cast<GLenum>(pname), param);
 }
 
@@ -74,6 +78,7 @@ void vw_SetLightV(GLenum light, eLightVParameter pname, const GLfloat *param)
  */
 void vw_MaterialV(eMaterialParameter pname, const GLfloat *param)
 {
+    vw_Flush2D();
     glMaterialfv(GL_FRONT_AND_BACK, static_cast<GLenum>(pname), param);
 }
 
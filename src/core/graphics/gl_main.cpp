@@ -329,6 +329,7 @@ sDevCaps &ChangeDevCaps()
  */
 void vw_ResizeScene(float FieldOfViewAngle, float AspectRatio, float zNearClip, float zFarClip)
 {
+    vw_Flush2D();
     glMatrixMode(GL_PROJECTION);
     glLoadIdentity();
 
@@ -343,6 +344,7 @@ void vw_ResizeScene(float FieldOfViewAngle, float AspectRatio, float zNearClip,
  */
 void vw_Clear(int mask)
 {
+    vw_Flush2D();
     GLbitfield glmask{0};
 
     if (mask & 0x1000) {
@@ -379,6 +381,8 @@ void vw_BeginRendering(int mask)
  */
 void vw_EndRendering()
 {
+    vw_Flush2D();
+
     if (MainFBO) {
         std::shared_ptr<sFBO> tmpEmptyFBO{};
 
@@ -429,6 +433,7 @@ bool vw_GetInternalResolution(float *Width, float *Height)
  */
 void vw_DepthRange(GLdouble zNear, GLdouble zFar)
 {
+    vw_Flush2D();
     glDepthRange(zNear, zFar);
 }
 
@@ -438,6 +443,7 @@ void vw_DepthRange(GLdouble zNear, GLdouble zFar)
 void vw_SetViewport(GLint x, GLint y, GLsizei width, GLsizei height, eOrigin Origin)
 {
     assert(SDLWindow);
+    vw_Flush2D();
 
     if (Origin == eOrigin::upper_left) {
         int SDLWindowWidth, SDLWindowHeight;
@@ -497,6 +503,7 @@ void vw_GetViewport(int *x, int *y, int *width, int *height)
  */
 void vw_CullFace(eCullFace mode)
 {
+    vw_Flush2D();
     if (mode == eCullFace::NONE) {
         glDisable(GL_CULL_FACE);
         return;
@@ -511,6 +518,7 @@ void vw_CullFace(eCullFace mode)
  */
 void vw_PolygonOffset(bool status, GLfloat factor, GLfloat units)
 {
+    vw_Flush2D();
     if (status) {
         glEnable(GL_POLYGON_OFFSET_FILL);
     } else {
@@ -533,6 +541,8 @@ void vw_SetClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alph
  */
 void vw_SetColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    // batched 2D quads have own colors, but caller's draw should not affect them
+    vw_Flush2D();
     glColor4f(red, green, blue, alpha);
 }
 
@@ -541,6 +551,7 @@ void vw_SetColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
  */
 void vw_SetColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
+    vw_Flush2D();
     glColorMask(red, green, blue, alpha);
 }
 
@@ -549,6 +560,7 @@ void vw_SetColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean a
  */
 void vw_DepthTest(bool mode, eCompareFunc func)
 {
+    vw_Flush2D();
     if (mode) {
         glEnable(GL_DEPTH_TEST);
         glDepthFunc(static_cast<GLenum>(func));
@@ -44,6 +44,7 @@ namespace viewizard {
  */
 void vw_LoadIdentity()
 {
+    vw_Flush2D();
     glLoadIdentity();
 }
 
@@ -52,6 +53,7 @@ void vw_LoadIdentity()
  */
 void vw_Translate(sVECTOR3D Location)
 {
+    vw_Flush2D();
     glTranslatef(Location.x, Location.y, Location.z);
 }
 
@@ -60,6 +62,7 @@ void vw_Translate(sVECTOR3D Location)
  */
 void vw_Rotate(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 {
+    vw_Flush2D();
     glRotatef(angle, x, y, z);
 }
 
@@ -68,6 +71,7 @@ void vw_Rotate(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
  */
 void vw_Scale(GLfloat x, GLfloat y, GLfloat z)
 {
+    vw_Flush2D();
     glScalef(x, y, z);
 }
 
@@ -84,6 +88,7 @@ void vw_GetMatrix(eMatrixPname pname, GLfloat *params)
  */
 void vw_SetMatrix(const GLfloat *matrix)
 {
+    vw_Flush2D();
     glLoadMatrixf(matrix);
 }
 
@@ -92,6 +97,7 @@ void vw_SetMatrix(const GLfloat *matrix)
  */
 void vw_MatrixMode(eMatrixMode mode)
 {
+    vw_Flush2D();
     glMatrixMode(static_cast<GLenum>(mode));
 }
 
@@ -100,6 +106,7 @@ void vw_MatrixMode(eMatrixMode mode)
  */
 void vw_MultMatrix(const GLfloat *matrix)
 {
+    vw_Flush2D();
     glMultMatrixf(matrix);
 }
 
@@ -108,6 +115,8 @@ void vw_MultMatrix(const GLfloat *matrix)
  */
 void vw_PushMatrix()
 {
+    // batched 2D quads should be drawn with current matrix
+    vw_Flush2D();
     glPushMatrix();
 }
 
@@ -116,6 +125,7 @@ void vw_PushMatrix()
  */
 void vw_PopMatrix()
 {
+    vw_Flush2D();
     glPopMatrix();
 }
 
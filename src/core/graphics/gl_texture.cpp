@@ -132,11 +132,34 @@ GLtexture vw_BuildTexture(const std::unique_ptr<uint8_t[]> &PixelsArray,
     return TextureID;
 }
 
+/*
+ * Update texture's region (origin is lower left corner, as for glTexSubImage2D()).
+ * Note, texture should be created without compression and without mipmaps.
+ */
+void vw_UpdateTexture(GLtexture TextureID, GLint X, GLint Y, GLsizei Width, GLsizei Height,
+                      int Bytes, const uint8_t *PixelsArray)
+{
+    vw_Flush2D();
+    if (!TextureID || !PixelsArray) {
+        return;
+    }
+
+    GLenum Format{GL_RGB};
+    if (Bytes == 4) {
+        Format = GL_RGBA;
+    }
+
+    vw_BindTexture(0, TextureID);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, X, Y, Width, Height, Format, GL_UNSIGNED_BYTE, PixelsArray);
+    vw_BindTexture(0, 0);
+}
+
 /*
  * Select active texture unit (starts from 0, for GL_TEXTURE0 unit).
  */
 void vw_SelectActiveTextureUnit(GLenum Unit)
 {
+    vw_Flush2D();
     if (pfn_glActiveTexture) {
         pfn_glActiveTexture(GL_TEXTURE0 + Unit);
     }
@@ -147,6 +170,8 @@ void vw_SelectActiveTextureUnit(GLenum Unit)
  */
 void vw_BindTexture(GLenum Unit, GLtexture TextureID)
 {
+    // batched 2D quads should be drawn with own texture
+    vw_Flush2D();
     vw_SelectActiveTextureUnit(Unit);
 
     if (TextureID) {
@@ -163,6 +188,7 @@ void vw_BindTexture(GLenum Unit, GLtexture TextureID)
  */
 void vw_DeleteTexture(GLtexture TextureID)
 {
+    vw_Flush2D();
     glDeleteTextures(1, &TextureID);
 }
 
@@ -172,6 +198,7 @@ void vw_DeleteTexture(GLtexture TextureID)
  */
 void vw_SetTextureBlendMode(eTextureCombinerName name, eTextureCombinerOp param)
 {
+    vw_Flush2D();
     glTexEnvi(GL_TEXTURE_ENV, static_cast<GLenum>(name),  static_cast<GLint>(param));
 }
 
@@ -180,6 +207,7 @@ void vw_SetTextureBlendMode(eTextureCombinerName name, eTextureCombinerOp param)
  */
 void vw_SetTextureFiltering(eTextureMinFilter MinFilter, eTextureMagFilter MagFilter)
 {
+    vw_Flush2D();
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(MinFilter));
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(MagFilter));
 }
@@ -197,6 +225,7 @@ void vw_SetTextureFiltering(const sTextureFilter &Filter)
  */
 void vw_SetTextureAnisotropy(GLint AnisotropyLevel)
 {
+    vw_Flush2D();
     if (vw_DevCaps().MaxAnisotropyLevel > 0) {
         if (AnisotropyLevel < 1) {
             std::cerr << __func__ << "(): " << "anisotropy level " << AnisotropyLevel
@@ -217,6 +246,7 @@ void vw_SetTextureAnisotropy(GLint AnisotropyLevel)
  */
 void vw_SetTextureAddressMode(eTextureWrapCoord coord, eTextureWrapMode mode)
 {
+    vw_Flush2D();
     glTexParameteri(GL_TEXTURE_2D, static_cast<GLenum>(coord), static_cast<GLint>(mode));
 }
 
@@ -235,6 +265,7 @@ void vw_SetTextureAddressMode(const sTextureWrap &wrap)
  */
 void vw_SetTextureAlphaTest(bool flag, eCompareFunc func, GLclampf ref)
 {
+    vw_Flush2D();
     if (flag) {
         glAlphaFunc(static_cast<GLenum>(func), ref);
         glEnable(GL_ALPHA_TEST);
@@ -250,6 +281,8 @@ void vw_SetTextureAlphaTest(bool flag, eCompareFunc func, GLclampf ref)
  */
 void vw_SetTextureBlend(bool flag, eTextureBlendFactor sfactor, eTextureBlendFactor dfactor)
 {
+    // batched 2D quads should be drawn with own blend mode
+    vw_Flush2D();
     if (!flag) {
         glDisable(GL_BLEND);
         // ignore parameters and setup initial values
@@ -266,6 +299,7 @@ void vw_SetTextureBlend(bool flag, eTextureBlendFactor sfactor, eTextureBlendFac
  */
 void vw_SetTextureCompare(eTextureCompareMode mode, eCompareFunc func)
 {
+    vw_Flush2D();
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, static_cast<GLint>(mode));
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, static_cast<GLint>(func));
 }
@@ -275,6 +309,7 @@ void vw_SetTextureCompare(eTextureCompareMode mode, eCompareFunc func)
  */
 void vw_SetTextureDepthMode(eTextureDepthMode mode)
 {
+    vw_Flush2D();
     glTexParameteri(GL_TEXTURE_2D, GL_DEPTH_TEXTURE_MODE, static_cast<GLint>(mode));
 }
 
@@ -283,6 +318,7 @@ void vw_SetTextureDepthMode(eTextureDepthMode mode)
  */
 void vw_SetTextureEnvMode(eTextureEnvMode mode)
 {
+    vw_Flush2D();
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, static_cast<GLint>(mode));
 }
 
@@ -72,6 +72,7 @@ bool vw_BuildVAO(GLuint &VAO, int DataFormat, GLsizei Stride, GLuint VertexBO, G
  */
 void vw_BindVAO(GLuint VAO)
 {
+    vw_Flush2D();
     // don't call glIsVertexArray() here, for best speed
     if (!pfn_glBindVertexArray) {
         return;
@@ -73,6 +73,7 @@ bool vw_BuildBufferObject(eBufferObject target, GLsizeiptr size, const GLvoid *d
  */
 void vw_BindBufferObject(eBufferObject target, GLuint buffer)
 {
+    vw_Flush2D();
     if (!pfn_glBindBuffer) {
         return;
     }
@@ -453,6 +453,9 @@ void vw_PolygonOffset(bool status, GLfloat factor, GLfloat units);
 GLtexture vw_BuildTexture(const std::unique_ptr<uint8_t[]> &PixelsArray,
                           GLsizei Width, GLsizei Height, bool MipMap, int Bytes,
                           eTextureCompressionType CompressionType);
+// Update texture's region (origin is lower left corner, as for glTexSubImage2D()).
+void vw_UpdateTexture(GLtexture TextureID, GLint X, GLint Y, GLsizei Width, GLsizei Height,
+                      int Bytes, const uint8_t *PixelsArray);
 // Select active texture unit (starts from 0, for GL_TEXTURE0 unit).
 void vw_SelectActiveTextureUnit(GLenum Unit);
 // Bind texture for particular texture unit (starts from 0, for GL_TEXTURE0 unit).
@@ -639,6 +642,10 @@ void vw_End2DMode();
 // Draw transparent. Origin is upper left corner.
 void vw_Draw2D(const sRECT &DstRect, const sRECT &SrcRect, GLtexture Texture, bool Alpha, float Transp = 1.0f,
                float RotateAngle = 0.0f, const sRGBCOLOR &Color = sRGBCOLOR{eRGBCOLOR::white});
+// Draw all batched by vw_Draw2D() quads.
+// Note, called by all matrix stack and render state changes, so, batch is always
+// drawn with states, that were current on vw_Draw2D() call.
+void vw_Flush2D();
 
 /*
  * misc
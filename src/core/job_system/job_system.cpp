@@ -0,0 +1,301 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+/*
+Simple job system for "parallel for" only. Worker threads sleep on condition variable,
+vw_ParallelFor() wake them up, all threads (including caller's thread) take chunks by
+atomic counter, so, chunks distribution is not fixed, but caller should not care about
+this, since chunks should be independent. Caller's thread wait till all workers finish.
+
+vw_ParallelPrepare() use same workers, but caller's thread don't take chunks, it wait for
+prepared items in ready queue instead, and finish them (for example, upload data into OpenGL).
+
+Note, we use libSDL threads and synchronization primitives, since libSDL is already
+used by all other core code.
+*/
+
+#include "../base.h"
+#include "job_system.h"
+
+namespace viewizard {
+
+namespace {
+
+// we don't need more, objects update is not so heavy
+constexpr unsigned MaxWorkersCount{7};
+
+std::vector<SDL_Thread*> Workers{};
+SDL_mutex *JobMutex{nullptr};
+SDL_cond *JobStartCond{nullptr};
+SDL_cond *JobDoneCond{nullptr};
+SDL_cond *JobReadyCond{nullptr};
+
+// current job, protected by JobMutex (except NextChunk)
+std::function<void (unsigned Begin, unsigned End)> JobFunction{};
+unsigned JobCount{0};
+unsigned JobChunkSize{1};
+unsigned JobGeneration{0};
+unsigned ActiveWorkers{0};
+bool NeedQuit{false};
+SDL_atomic_t NextChunk;
+
+} // unnamed namespace
+
+
+/*
+ * Process current job's chunks, till all chunks are taken.
+ */
+static void ProcessChunks(const std::function<void (unsigned Begin, unsigned End)> &Function,
+                          unsigned Count, unsigned ChunkSize)
+{
+    for (;;) {
+        unsigned Begin = static_cast<unsigned>(SDL_AtomicAdd(&NextChunk, 1)) * ChunkSize;
+        if (Begin >= Count) {
+            return;
+        }
+        Function(Begin, std::min(Begin + ChunkSize, Count));
+    }
+}
+
+/*
+ * Worker thread.
+ */
+static int WorkerThread(void *UNUSED(Data))
+{
+    unsigned SeenGeneration{0};
+
+    SDL_LockMutex(JobMutex);
+    for (;;) {
+        while (!NeedQuit && SeenGeneration == JobGeneration) {
+            SDL_CondWait(JobStartCond, JobMutex);
+        }
+        if (NeedQuit) {
+            break;
+        }
+        SeenGeneration = JobGeneration;
+        const std::function<void (unsigned Begin, unsigned End)> &Function = JobFunction;
+        unsigned Count = JobCount;
+        unsigned ChunkSize = JobChunkSize;
+        SDL_UnlockMutex(JobMutex);
+
+        ProcessChunks(Function, Count, ChunkSize);
+
+        SDL_LockMutex(JobMutex);
+        ActiveWorkers--;
+        if (!ActiveWorkers) {
+            SDL_CondSignal(JobDoneCond);
+        }
+    }
+    SDL_UnlockMutex(JobMutex);
+
+    return 0;
+}
+
+/*
+ * Initialize job system, create worker threads (by CPU cores count).
+ */
+void vw_InitJobSystem()
+{
+    vw_ReleaseJobSystem();
+
+    int CPUCount = SDL_GetCPUCount();
+    if (CPUCount <= 1) {
+        return;
+    }
+
+    JobMutex = SDL_CreateMutex();
+    JobStartCond = SDL_CreateCond();
+    JobDoneCond = SDL_CreateCond();
+    JobReadyCond = SDL_CreateCond();
+    if (!JobMutex || !JobStartCond || !JobDoneCond || !JobReadyCond) {
+        std::cerr << __func__ << "(): " << "SDL_CreateMutex() or SDL_CreateCond() failed: " << SDL_GetError() << "\n";
+        vw_ReleaseJobSystem();
+        return;
+    }
+
+    NeedQuit = false;
+    unsigned WorkersCount = std::min(static_cast<unsigned>(CPUCount - 1), MaxWorkersCount);
+    for (unsigned i = 0; i < WorkersCount; i++) {
+        SDL_Thread *tmpThread = SDL_CreateThread(WorkerThread, "JobWorker", nullptr);
+        if (!tmpThread) {
+            std::cerr << __func__ << "(): " << "SDL_CreateThread() failed: " << SDL_GetError() << "\n";
+            break;
+        }
+        Workers.push_back(tmpThread);
+    }
+}
+
+/*
+ * Stop and release all worker threads.
+ */
+void vw_ReleaseJobSystem()
+{
+    if (JobMutex) {
+        SDL_LockMutex(JobMutex);
+        NeedQuit = true;
+        if (JobStartCond) {
+            SDL_CondBroadcast(JobStartCond);
+        }
+        SDL_UnlockMutex(JobMutex);
+    }
+
+    for (auto &tmpThread : Workers) {
+        SDL_WaitThread(tmpThread, nullptr);
+    }
+    Workers.clear();
+
+    if (JobReadyCond) {
+        SDL_DestroyCond(JobReadyCond);
+        JobReadyCond = nullptr;
+    }
+    if (JobDoneCond) {
+        SDL_DestroyCond(JobDoneCond);
+        JobDoneCond = nullptr;
+    }
+    if (JobStartCond) {
+        SDL_DestroyCond(JobStartCond);
+        JobStartCond = nullptr;
+    }
+    if (JobMutex) {
+        SDL_DestroyMutex(JobMutex);
+        JobMutex = nullptr;
+    }
+}
+
+/*
+ * Get worker threads count (caller's thread is not included).
+ */
+unsigned vw_GetJobSystemWorkersCount()
+{
+    return static_cast<unsigned>(Workers.size());
+}
+
+/*
+ * Wake up workers for new job.
+ */
+static void StartJob(unsigned Count, unsigned ChunkSize,
+                     const std::function<void (unsigned Begin, unsigned End)> &Function)
+{
+    SDL_LockMutex(JobMutex);
+    assert(!ActiveWorkers);
+    JobFunction = Function;
+    JobCount = Count;
+    JobChunkSize = ChunkSize;
+    SDL_AtomicSet(&NextChunk, 0);
+    ActiveWorkers = static_cast<unsigned>(Workers.size());
+    JobGeneration++;
+    SDL_CondBroadcast(JobStartCond);
+    SDL_UnlockMutex(JobMutex);
+}
+
+/*
+ * Wait till all workers finish current job.
+ */
+static void WaitJob()
+{
+    SDL_LockMutex(JobMutex);
+    while (ActiveWorkers) {
+        SDL_CondWait(JobDoneCond, JobMutex);
+    }
+    JobFunction = nullptr;
+    SDL_UnlockMutex(JobMutex);
+}
+
+/*
+ * Call Function for all [Begin, End) chunks of [0, Count) range in parallel.
+ */
+void vw_ParallelFor(unsigned Count, unsigned ChunkSize,
+                    const std::function<void (unsigned Begin, unsigned End)> &Function)
+{
+    if (!Count) {
+        return;
+    }
+    if (!ChunkSize) {
+        ChunkSize = 1;
+    }
+
+    // nothing to share with workers
+    if (Workers.empty() || Count <= ChunkSize) {
+        Function(0, Count);
+        return;
+    }
+
+    StartJob(Count, ChunkSize, Function);
+    ProcessChunks(Function, Count, ChunkSize);
+    WaitJob();
+}
+
+/*
+ * Prepare all items in worker threads, finish prepared items in caller's thread.
+ */
+void vw_ParallelPrepare(unsigned Count, const std::function<void (unsigned Item)> &Prepare,
+                        const std::function<void (unsigned Item)> &Finish)
+{
+    if (Workers.empty()) {
+        for (unsigned i = 0; i < Count; i++) {
+            Prepare(i);
+            Finish(i);
+        }
+        return;
+    }
+
+    // ready queue, protected by JobMutex
+    std::vector<unsigned> ReadyItems{};
+    ReadyItems.reserve(Count);
+
+    StartJob(Count, 1, [&] (unsigned Begin, unsigned End) {
+        for (unsigned i = Begin; i < End; i++) {
+            Prepare(i);
+
+            SDL_LockMutex(JobMutex);
+            ReadyItems.push_back(i);
+            SDL_CondSignal(JobReadyCond);
+            SDL_UnlockMutex(JobMutex);
+        }
+    });
+
+    std::vector<unsigned> FinishItems{};
+    FinishItems.reserve(Count);
+    for (unsigned FinishedCount = 0; FinishedCount < Count;) {
+        SDL_LockMutex(JobMutex);
+        while (ReadyItems.empty()) {
+            SDL_CondWait(JobReadyCond, JobMutex);
+        }
+        FinishItems.swap(ReadyItems);
+        SDL_UnlockMutex(JobMutex);
+
+        for (auto tmpItem : FinishItems) {
+            Finish(tmpItem);
+            FinishedCount++;
+        }
+        FinishItems.clear();
+    }
+
+    WaitJob();
+}
+
+} // viewizard namespace
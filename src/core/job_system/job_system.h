@@ -0,0 +1,53 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+#ifndef CORE_JOBSYSTEM_JOBSYSTEM_H
+#define CORE_JOBSYSTEM_JOBSYSTEM_H
+
+#include "../base.h"
+
+namespace viewizard {
+
+// Initialize job system, create worker threads (by CPU cores count).
+void vw_InitJobSystem();
+// Stop and release all worker threads.
+void vw_ReleaseJobSystem();
+// Get worker threads count (caller's thread is not included).
+unsigned vw_GetJobSystemWorkersCount();
+// Call Function for all [Begin, End) chunks of [0, Count) range in parallel, return when all chunks are done.
+// Caller's thread also process chunks. Note, nested vw_ParallelFor() calls are not allowed.
+void vw_ParallelFor(unsigned Count, unsigned ChunkSize,
+                    const std::function<void (unsigned Begin, unsigned End)> &Function);
+// Call Prepare for all items of [0, Count) range in worker threads, and Finish for each prepared
+// item in caller's thread (in order items were prepared), return when all items are finished.
+// Caller's thread don't prepare items, since it should be free for Finish calls (OpenGL, etc).
+void vw_ParallelPrepare(unsigned Count, const std::function<void (unsigned Item)> &Prepare,
+                        const std::function<void (unsigned Item)> &Finish);
+
+} // viewizard namespace
+
+#endif // CORE_JOBSYSTEM_JOBSYSTEM_H
@@ -27,7 +27,9 @@
 
 #include "../graphics/graphics.h"
 #include "../math/math.h"
+#include "../collision_detection/collision_detection.h"
 #include "light.h"
+#include <limits> // need this one for std::numeric_limits only
 
 namespace viewizard {
 
@@ -38,50 +40,168 @@ constexpr float AttenuationLimit{10.0f};
 // all lights, indexed by light's type
 std::unordered_multimap<eLightType, std::shared_ptr<cLight>, sEnumHash> LightsMap;
 
+// point lights spatial bins, see BuildPointLightsBins()
+cUniformGrid PointLightsBins{25.0f};
+// bins' box index -> point light
+std::vector<cLight*> BinnedPointLights{};
+bool PointLightsBinsValid{false};
+std::vector<unsigned> BinsCandidates{};
+// affected point lights with attenuation, sorted by attenuation (reused buffer)
+std::vector<std::pair<float, cLight*>> AffectedLights{};
+
 } // unnamed namespace
 
 
 /*
- * Calculate affected lights counter and create sorted map with affected lights.
- * Note, all attenuation-related calculations not involved in real rendering by OpenGL,
- * and need for internal use only in order to activate (via OpenGL) proper lights.
+ * Calculate square of the point light's reach (distance^2 from light's location to
+ * object's sphere, see CalculatePointLightAttenuation() for "Dist2 -= Radius2").
+ * Return negative value, if light can't affect objects, or infinity, if reach is not limited.
+ */
+static float CalculatePointLightReach2(const cLight &Light)
+{
+    if (Light.ConstantAttenuation > AttenuationLimit) {
+        return -1.0f;
+    }
+
+    // particle systems change attenuation, but not below base value (see cParticleSystem::UpdateLight())
+    float Quadratic = Light.QuadraticAttenuation;
+    if (Light.QuadraticAttenuationBase > 0.0f) {
+        Quadratic = std::min(Quadratic, Light.QuadraticAttenuationBase);
+    }
+    float Linear = Light.LinearAttenuation;
+    if (Light.LinearAttenuationBase > 0.0f) {
+        Linear = std::min(Linear, Light.LinearAttenuationBase);
+    }
+
+    // note, linear attenuation is not used, if constant and quadratic already reach the limit
+    if (Quadratic > 0.0f) {
+        return (AttenuationLimit - Light.ConstantAttenuation) / Quadratic;
+    }
+    if (Quadratic == 0.0f && Linear > 0.0f && Light.ConstantAttenuation < AttenuationLimit) {
+        float tmpReach = (AttenuationLimit - Light.ConstantAttenuation) / Linear;
+        return tmpReach * tmpReach;
+    }
+
+    return std::numeric_limits<float>::infinity();
+}
+
+/*
+ * Distribute all point lights into spatial bins by light's reach.
  */
-int vw_CalculateAllPointLightsAttenuation(const sVECTOR3D &Location, float Radius2,
-                                          std::multimap<float, cLight*> *AffectedLightsMap)
+static void BuildPointLightsBins()
 {
-    int AffectedLightsCount{0};
+    PointLightsBins.Clear();
+    BinnedPointLights.clear();
 
+    // note, lights are added in LightsMap's order, bins' query provide sorted result, so,
+    // we have same lights order, as we have in LightsMap for equal attenuation
     auto range = LightsMap.equal_range(eLightType::Point);
     for (; range.first != range.second; ++range.first) {
-        auto &tmpLight = *range.first;
-        if (tmpLight.second->On) {
-            float tmpAttenuation = tmpLight.second->ConstantAttenuation;
-
-            // care about distance to object
-            sVECTOR3D DistV{Location.x - tmpLight.second->Location.x,
-                            Location.y - tmpLight.second->Location.y,
-                            Location.z - tmpLight.second->Location.z};
-            float Dist2 = DistV.x * DistV.x + DistV.y * DistV.y + DistV.z * DistV.z;
-            if (Dist2 > Radius2) {
-                Dist2 -= Radius2;
-                // Constant and Quadratic first (this is all about sqrt(), that we need for Linear)
-                tmpAttenuation += tmpLight.second->QuadraticAttenuation * Dist2;
-
-                if (tmpAttenuation < AttenuationLimit && tmpLight.second->LinearAttenuation > 0.0f) {
-                    tmpAttenuation += tmpLight.second->LinearAttenuation * vw_sqrtf(Dist2);
-                }
-            }
+        cLight *tmpLight = range.first->second.get();
 
-            if (tmpAttenuation <= AttenuationLimit) {
-                AffectedLightsCount++;
-                if (AffectedLightsMap) {
-                    AffectedLightsMap->emplace(tmpAttenuation, tmpLight.second.get());
-                }
-            }
+        float Reach2 = CalculatePointLightReach2(*tmpLight);
+        if (Reach2 < 0.0f) {
+            continue;
+        }
+        float Reach = (Reach2 == std::numeric_limits<float>::infinity()) ? Reach2 : vw_sqrtf(Reach2);
+
+        // oversized and infinity boxes are not distributed into cells, but checked for all queries
+        PointLightsBins.Add(sVECTOR3D{tmpLight->Location.x - Reach,
+                                      tmpLight->Location.y - Reach,
+                                      tmpLight->Location.z - Reach},
+                            sVECTOR3D{tmpLight->Location.x + Reach,
+                                      tmpLight->Location.y + Reach,
+                                      tmpLight->Location.z + Reach});
+        BinnedPointLights.push_back(tmpLight);
+    }
+
+    PointLightsBins.Build();
+    PointLightsBinsValid = true;
+}
+
+/*
+ * Calculate point light attenuation for object (presented by location and radius^2).
+ */
+static float CalculatePointLightAttenuation(const cLight &Light, const sVECTOR3D &Location, float Radius2)
+{
+    float tmpAttenuation = Light.ConstantAttenuation;
+
+    // care about distance to object
+    sVECTOR3D DistV{Location.x - Light.Location.x,
+                    Location.y - Light.Location.y,
+                    Location.z - Light.Location.z};
+    float Dist2 = DistV.x * DistV.x + DistV.y * DistV.y + DistV.z * DistV.z;
+    if (Dist2 > Radius2) {
+        Dist2 -= Radius2;
+        // Constant and Quadratic first (this is all about sqrt(), that we need for Linear)
+        tmpAttenuation += Light.QuadraticAttenuation * Dist2;
+
+        if (tmpAttenuation < AttenuationLimit && Light.LinearAttenuation > 0.0f) {
+            tmpAttenuation += Light.LinearAttenuation * vw_sqrtf(Dist2);
+        }
+    }
+
+    return tmpAttenuation;
+}
+
+/*
+ * Find affected point lights for object (presented by location and radius^2).
+ * Note, result sorted by attenuation, and valid till next call.
+ */
+static const std::vector<std::pair<float, cLight*>> &FindAffectedPointLights(const sVECTOR3D &Location, float Radius2)
+{
+    if (!PointLightsBinsValid) {
+        BuildPointLightsBins();
+    }
+
+    AffectedLights.clear();
+
+    // if light affects object, distance between them is not more than light's reach plus object's radius
+    float Radius = vw_sqrtf(Radius2);
+    PointLightsBins.Query(sVECTOR3D{Location.x - Radius, Location.y - Radius, Location.z - Radius},
+                          sVECTOR3D{Location.x + Radius, Location.y + Radius, Location.z + Radius},
+                          BinsCandidates);
+
+    for (auto &tmpIndex : BinsCandidates) {
+        cLight *tmpLight = BinnedPointLights[tmpIndex];
+        if (!tmpLight->On) {
+            continue;
+        }
+
+        float tmpAttenuation = CalculatePointLightAttenuation(*tmpLight, Location, Radius2);
+        if (tmpAttenuation > AttenuationLimit) {
+            continue;
+        }
+
+        // insertion sort, usually, we have only few lights here, note, lights with
+        // equal attenuation should stay in order they were found
+        AffectedLights.emplace_back(tmpAttenuation, tmpLight);
+        for (size_t i = AffectedLights.size() - 1; i > 0 && AffectedLights[i - 1].first > tmpAttenuation; i--) {
+            std::swap(AffectedLights[i - 1], AffectedLights[i]);
         }
     }
 
-    return AffectedLightsCount;
+    return AffectedLights;
+}
+
+/*
+ * Rebuild point lights spatial bins.
+ * Note, lights' location could be changed in parallel update code, so, bins are
+ * rebuilt unconditionally once per frame (from main thread) before objects draw.
+ */
+void vw_UpdatePointLightsBins()
+{
+    BuildPointLightsBins();
+}
+
+/*
+ * Calculate affected lights counter.
+ * Note, all attenuation-related calculations not involved in real rendering by OpenGL,
+ * and need for internal use only in order to activate (via OpenGL) proper lights.
+ */
+int vw_CalculateAllPointLightsAttenuation(const sVECTOR3D &Location, float Radius2)
+{
+    return static_cast<int>(FindAffectedPointLights(Location, Radius2).size());
 }
 
 /*
@@ -107,12 +227,8 @@ void vw_CheckAndActivateAllLights(const sVECTOR3D &Location, float Radius2, int
 
     // point lights
     if (PointLimit > 0) {
-        std::multimap<float, cLight*> AffectedLightsMap;
-        // call for std::map calculation with sorted by attenuation affected lights
-        vw_CalculateAllPointLightsAttenuation(Location, Radius2, &AffectedLightsMap);
-
         // enable lights with less attenuation first
-        for (auto &tmpLight : AffectedLightsMap) {
+        for (auto &tmpLight : FindAffectedPointLights(Location, Radius2)) {
             if (countType2 >= PointLimit || countType1 + countType2 >= vw_DevCaps().MaxActiveLights) {
                 break;
             }
@@ -146,6 +262,7 @@ void vw_ReleaseLight(std::weak_ptr<cLight> &Light)
         for (auto iter = LightsMap.begin(); iter != LightsMap.end(); ++iter) {
             if (iter->second.get() == sharedLight.get()) {
                 LightsMap.erase(iter);
+                PointLightsBinsValid = false;
                 // current iterator invalidated by erase()
                 return;
             }
@@ -159,6 +276,7 @@ void vw_ReleaseLight(std::weak_ptr<cLight> &Light)
 void vw_ReleaseAllLights()
 {
     LightsMap.clear();
+    PointLightsBinsValid = false;
 }
 
 /*
@@ -168,6 +286,7 @@ std::weak_ptr<cLight> vw_CreateLight(eLightType Type)
 {
     auto Light = LightsMap.emplace(Type, std::shared_ptr<cLight>{new cLight, [](cLight *p) {delete p;}});
     Light->second->LightType = Type;
+    PointLightsBinsValid = false;
     return Light->second;
 }
 
@@ -273,7 +392,7 @@ void cLight::DeActivate()
  */
 void cLight::SetLocation(sVECTOR3D NewLocation)
 {
-    if (LightType != eLightType::Directional) {
+    if (LightType != eLightType::Directional && Location != NewLocation) {
         Location = NewLocation;
     }
 }
@@ -90,9 +90,11 @@ private:
 // Activate proper lights for particular object (presented by location and radius^2).
 void vw_CheckAndActivateAllLights(const sVECTOR3D &Location, float Radius2, int DirLimit,
                                   int PointLimit, const float (&Matrix)[16]);
-// Calculate affected lights counter and create sorted map with affected lights.
-int vw_CalculateAllPointLightsAttenuation(const sVECTOR3D &Location, float Radius2,
-                                          std::multimap<float, cLight*> *AffectedLightsMap);
+// Rebuild point lights spatial bins, should be called once per frame from main thread before draw.
+void vw_UpdatePointLightsBins();
+// Calculate affected lights counter.
+// Note, point lights are culled by spatial bins, see vw_UpdatePointLightsBins().
+int vw_CalculateAllPointLightsAttenuation(const sVECTOR3D &Location, float Radius2);
 // Deactivate all lights.
 void vw_DeActivateAllLights();
 // Release light.
@@ -0,0 +1,236 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+// NOTE all functions provide same results as scalar functions (same operations order),
+//      SSE version process 4 points per iteration, rest points processed by scalar code
+
+#include "math.h"
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif // __SSE__
+
+namespace viewizard {
+
+// we treat sVECTOR3D arrays as float arrays
+static_assert(sizeof(sVECTOR3D) == 3 * sizeof(float), "sVECTOR3D should contain 3 floats without padding.");
+
+#ifdef __SSE__
+/*
+ * Load 4 points (12 floats) and transpose them into X, Y, Z vectors.
+ */
+static inline void Load4Points(const sVECTOR3D *Points, __m128 &X, __m128 &Y, __m128 &Z)
+{
+    const float *tmpPoints = &Points->x;
+    __m128 A = _mm_loadu_ps(tmpPoints);     // x0 y0 z0 x1
+    __m128 B = _mm_loadu_ps(tmpPoints + 4); // y1 z1 x2 y2
+    __m128 C = _mm_loadu_ps(tmpPoints + 8); // z2 x3 y3 z3
+
+    X = _mm_shuffle_ps(A, _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    Y = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1)),
+                       _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    Z = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2)),
+                       _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+/*
+ * Transpose X, Y, Z vectors back and store 4 points (12 floats).
+ */
+static inline void Store4Points(sVECTOR3D *Points, __m128 X, __m128 Y, __m128 Z)
+{
+    __m128 XY01 = _mm_unpacklo_ps(X, Y); // x0 y0 x1 y1
+    __m128 XY23 = _mm_unpackhi_ps(X, Y); // x2 y2 x3 y3
+
+    float *tmpPoints = &Points->x;
+    _mm_storeu_ps(tmpPoints, _mm_shuffle_ps(XY01, _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0)),
+                                            _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(tmpPoints + 4, _mm_shuffle_ps(_mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)), XY23,
+                                                _MM_SHUFFLE(1, 0, 2, 0)));
+    _mm_storeu_ps(tmpPoints + 8, _mm_shuffle_ps(_mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2)),
+                                                _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)),
+                                                _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+/*
+ * Calculate 4 points positions by 3x3 matrix.
+ */
+static inline void Matrix33Calc4Points(const float (&Matrix33)[9], __m128 &X, __m128 &Y, __m128 &Z)
+{
+    __m128 tmpX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Matrix33[0]), X),
+                                        _mm_mul_ps(_mm_set1_ps(Matrix33[3]), Y)),
+                             _mm_mul_ps(_mm_set1_ps(Matrix33[6]), Z));
+    __m128 tmpY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Matrix33[1]), X),
+                                        _mm_mul_ps(_mm_set1_ps(Matrix33[4]), Y)),
+                             _mm_mul_ps(_mm_set1_ps(Matrix33[7]), Z));
+    __m128 tmpZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Matrix33[2]), X),
+                                        _mm_mul_ps(_mm_set1_ps(Matrix33[5]), Y)),
+                             _mm_mul_ps(_mm_set1_ps(Matrix33[8]), Z));
+    X = tmpX;
+    Y = tmpY;
+    Z = tmpZ;
+}
+#endif // __SSE__
+
+/*
+ * Calculate points positions by 3x3 transformation matrix.
+ * Same as vw_Matrix33CalcPoint() for each point, SrcPoints and DstPoints could be the same array.
+ */
+void vw_Matrix33CalcPoints(const float (&Matrix33)[9], const sVECTOR3D *SrcPoints,
+                           sVECTOR3D *DstPoints, unsigned Count)
+{
+    unsigned i{0};
+#ifdef __SSE__
+    for (; i + 4 <= Count; i += 4) {
+        __m128 X, Y, Z;
+        Load4Points(SrcPoints + i, X, Y, Z);
+        Matrix33Calc4Points(Matrix33, X, Y, Z);
+        Store4Points(DstPoints + i, X, Y, Z);
+    }
+#endif // __SSE__
+    for (; i < Count; i++) {
+        DstPoints[i] = SrcPoints[i];
+        vw_Matrix33CalcPoint(DstPoints[i], Matrix33);
+    }
+}
+
+/*
+ * Calculate points positions by 3x3 transformation matrix, points stored as separate coordinates arrays.
+ * Same as vw_Matrix33CalcPoint() for each point.
+ */
+void vw_Matrix33CalcPoints(const float (&Matrix33)[9], float *PointsX, float *PointsY, float *PointsZ,
+                           unsigned Count)
+{
+    unsigned i{0};
+#ifdef __SSE__
+    for (; i + 4 <= Count; i += 4) {
+        __m128 X = _mm_loadu_ps(PointsX + i);
+        __m128 Y = _mm_loadu_ps(PointsY + i);
+        __m128 Z = _mm_loadu_ps(PointsZ + i);
+        Matrix33Calc4Points(Matrix33, X, Y, Z);
+        _mm_storeu_ps(PointsX + i, X);
+        _mm_storeu_ps(PointsY + i, Y);
+        _mm_storeu_ps(PointsZ + i, Z);
+    }
+#endif // __SSE__
+    for (; i < Count; i++) {
+        sVECTOR3D tmpPoint{PointsX[i], PointsY[i], PointsZ[i]};
+        vw_Matrix33CalcPoint(tmpPoint, Matrix33);
+        PointsX[i] = tmpPoint.x;
+        PointsY[i] = tmpPoint.y;
+        PointsZ[i] = tmpPoint.z;
+    }
+}
+
+/*
+ * Calculate points positions by 4x4 transformation matrix.
+ * Same as vw_Matrix44CalcPoint() for each point, SrcPoints and DstPoints could be the same array.
+ */
+void vw_Matrix44CalcPoints(const float (&Matrix44)[16], const sVECTOR3D *SrcPoints,
+                           sVECTOR3D *DstPoints, unsigned Count)
+{
+    unsigned i{0};
+#ifdef __SSE__
+    for (; i + 4 <= Count; i += 4) {
+        __m128 X, Y, Z;
+        Load4Points(SrcPoints + i, X, Y, Z);
+        __m128 tmpX = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Matrix44[0]), X),
+                                                       _mm_mul_ps(_mm_set1_ps(Matrix44[4]), Y)),
+                                            _mm_mul_ps(_mm_set1_ps(Matrix44[8]), Z)),
+                                 _mm_set1_ps(Matrix44[12]));
+        __m128 tmpY = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Matrix44[1]), X),
+                                                       _mm_mul_ps(_mm_set1_ps(Matrix44[5]), Y)),
+                                            _mm_mul_ps(_mm_set1_ps(Matrix44[9]), Z)),
+                                 _mm_set1_ps(Matrix44[13]));
+        __m128 tmpZ = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Matrix44[2]), X),
+                                                       _mm_mul_ps(_mm_set1_ps(Matrix44[6]), Y)),
+                                            _mm_mul_ps(_mm_set1_ps(Matrix44[10]), Z)),
+                                 _mm_set1_ps(Matrix44[14]));
+        Store4Points(DstPoints + i, tmpX, tmpY, tmpZ);
+    }
+#endif // __SSE__
+    for (; i < Count; i++) {
+        DstPoints[i] = SrcPoints[i];
+        vw_Matrix44CalcPoint(DstPoints[i], Matrix44);
+    }
+}
+
+/*
+ * Calculate axis-aligned bounding box for points.
+ * Count should be greater than zero.
+ */
+void vw_PointsAABB(const sVECTOR3D *Points, unsigned Count, sVECTOR3D &Min, sVECTOR3D &Max)
+{
+    assert(Points && Count);
+
+    Min = Max = Points[0];
+    unsigned i{1};
+#ifdef __SSE__
+    if (Count >= 4) {
+        __m128 MinX, MinY, MinZ;
+        Load4Points(Points, MinX, MinY, MinZ);
+        __m128 MaxX{MinX};
+        __m128 MaxY{MinY};
+        __m128 MaxZ{MinZ};
+        for (i = 4; i + 4 <= Count; i += 4) {
+            __m128 X, Y, Z;
+            Load4Points(Points + i, X, Y, Z);
+            MinX = _mm_min_ps(MinX, X);
+            MinY = _mm_min_ps(MinY, Y);
+            MinZ = _mm_min_ps(MinZ, Z);
+            MaxX = _mm_max_ps(MaxX, X);
+            MaxY = _mm_max_ps(MaxY, Y);
+            MaxZ = _mm_max_ps(MaxZ, Z);
+        }
+
+        float tmpMin[3][4];
+        float tmpMax[3][4];
+        _mm_storeu_ps(tmpMin[0], MinX);
+        _mm_storeu_ps(tmpMin[1], MinY);
+        _mm_storeu_ps(tmpMin[2], MinZ);
+        _mm_storeu_ps(tmpMax[0], MaxX);
+        _mm_storeu_ps(tmpMax[1], MaxY);
+        _mm_storeu_ps(tmpMax[2], MaxZ);
+        for (int j = 0; j < 4; j++) {
+            Min.x = std::min(Min.x, tmpMin[0][j]);
+            Min.y = std::min(Min.y, tmpMin[1][j]);
+            Min.z = std::min(Min.z, tmpMin[2][j]);
+            Max.x = std::max(Max.x, tmpMax[0][j]);
+            Max.y = std::max(Max.y, tmpMax[1][j]);
+            Max.z = std::max(Max.z, tmpMax[2][j]);
+        }
+    }
+#endif // __SSE__
+    for (; i < Count; i++) {
+        Min.x = std::min(Min.x, Points[i].x);
+        Min.y = std::min(Min.y, Points[i].y);
+        Min.z = std::min(Min.z, Points[i].z);
+        Max.x = std::max(Max.x, Points[i].x);
+        Max.y = std::max(Max.y, Points[i].y);
+        Max.z = std::max(Max.z, Points[i].z);
+    }
+}
+
+} // viewizard namespace
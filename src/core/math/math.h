@@ -259,6 +259,22 @@ void vw_Matrix33InverseRotate(float (&Matrix33)[9]);
 // Calculate point position by transformation matrix.
 void vw_Matrix33CalcPoint(sVECTOR3D &Point, const float (&Matrix33)[9]);
 
+/*
+ * Batch operations for points arrays (SSE accelerated, if available).
+ */
+
+// Calculate points positions by 3x3 transformation matrix (SrcPoints and DstPoints could be the same array).
+void vw_Matrix33CalcPoints(const float (&Matrix33)[9], const sVECTOR3D *SrcPoints,
+                           sVECTOR3D *DstPoints, unsigned Count);
+// Calculate points positions by 3x3 transformation matrix, points stored as separate coordinates arrays.
+void vw_Matrix33CalcPoints(const float (&Matrix33)[9], float *PointsX, float *PointsY, float *PointsZ,
+                           unsigned Count);
+// Calculate points positions by 4x4 transformation matrix (SrcPoints and DstPoints could be the same array).
+void vw_Matrix44CalcPoints(const float (&Matrix44)[16], const sVECTOR3D *SrcPoints,
+                           sVECTOR3D *DstPoints, unsigned Count);
+// Calculate axis-aligned bounding box for points (Count should be greater than zero).
+void vw_PointsAABB(const sVECTOR3D *Points, unsigned Count, sVECTOR3D &Min, sVECTOR3D &Max);
+
 } // viewizard namespace
 
 #endif // CORE_MATH_MATH_H
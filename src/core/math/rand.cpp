@@ -32,8 +32,8 @@ namespace viewizard {
 
 namespace {
 
-std::random_device rd;
-std::default_random_engine gen(rd());
+// note, generator is thread local, since could be used by job system's workers (see vw_ParallelFor())
+thread_local std::default_random_engine gen(std::random_device{}());
 
 } // unnamed namespace
 
@@ -32,8 +32,8 @@
 namespace viewizard {
 
 class cModel3DWrapper : public sModel3D {
-    friend std::weak_ptr<sModel3D> vw_LoadModel3D(const std::string &FileName, float TriangleSizeLimit,
-                                                  bool NeedTangentAndBinormal);
+    friend std::shared_ptr<sModel3D> vw_PrepareModel3D(const std::string &FileName, float TriangleSizeLimit,
+                                                       bool NeedTangentAndBinormal);
 
 public:
     // Load VW3D 3D models format.
@@ -42,17 +42,38 @@ public:
     bool SaveVW3D(const std::string &FileName);
 
 private:
-    // Don't allow direct new/delete usage in code, only vw_LoadModel3D()
+    // Don't allow direct new/delete usage in code, only vw_PrepareModel3D()
     // allowed for cModel3DWrapper creation and release setup (deleter must be provided).
     cModel3DWrapper() = default;
     ~cModel3DWrapper();
 };
 
+class cGeneratedModel3D : public sModel3D {
+    friend std::shared_ptr<sModel3D> vw_CreateModel3D();
+
+private:
+    // Don't allow direct new/delete usage in code, only vw_CreateModel3D()
+    // allowed for cGeneratedModel3D creation and release setup (deleter must be provided).
+    cGeneratedModel3D() = default;
+    ~cGeneratedModel3D() = default;
+};
+
 namespace {
 
 // All loaded models.
 std::unordered_map<std::string, std::shared_ptr<cModel3DWrapper>> ModelsMap;
 
+// Triangle's data for BVH build.
+struct sBVHTriangle {
+    sVECTOR3D Min{0.0f, 0.0f, 0.0f};
+    sVECTOR3D Max{0.0f, 0.0f, 0.0f};
+    sVECTOR3D Center{0.0f, 0.0f, 0.0f};
+    unsigned Num{0};
+};
+
+// Max triangles in BVH leaf.
+constexpr unsigned BVHLeafSize{4};
+
 } // unnamed namespace
 
 
@@ -218,6 +239,125 @@ static void CreateChunkBuffers(cModel3DWrapper *Model)
     }
 }
 
+/*
+ * Get vector's component by axis number (0 - x, 1 - y, 2 - z).
+ */
+static float AxisComponent(const sVECTOR3D &Vector, unsigned Axis)
+{
+    return Axis == 0 ? Vector.x : (Axis == 1 ? Vector.y : Vector.z);
+}
+
+/*
+ * Recursively build BVH node for Triangles[First, First + Count).
+ * Triangles are split by median of their centers along the longest axis.
+ */
+static void BuildBVHNode(sTriangleBVH &BVH, std::vector<sBVHTriangle> &Triangles,
+                         unsigned NodeNum, unsigned First, unsigned Count)
+{
+    sVECTOR3D Min{Triangles[First].Min};
+    sVECTOR3D Max{Triangles[First].Max};
+    sVECTOR3D CenterMin{Triangles[First].Center};
+    sVECTOR3D CenterMax{Triangles[First].Center};
+    for (unsigned i = First + 1; i < First + Count; i++) {
+        Min(std::min(Min.x, Triangles[i].Min.x), std::min(Min.y, Triangles[i].Min.y), std::min(Min.z, Triangles[i].Min.z));
+        Max(std::max(Max.x, Triangles[i].Max.x), std::max(Max.y, Triangles[i].Max.y), std::max(Max.z, Triangles[i].Max.z));
+        CenterMin(std::min(CenterMin.x, Triangles[i].Center.x),
+                  std::min(CenterMin.y, Triangles[i].Center.y),
+                  std::min(CenterMin.z, Triangles[i].Center.z));
+        CenterMax(std::max(CenterMax.x, Triangles[i].Center.x),
+                  std::max(CenterMax.y, Triangles[i].Center.y),
+                  std::max(CenterMax.z, Triangles[i].Center.z));
+    }
+    BVH.Nodes[NodeNum].Min = Min;
+    BVH.Nodes[NodeNum].Max = Max;
+
+    sVECTOR3D Extent{CenterMax - CenterMin};
+    unsigned Axis{0};
+    if (Extent.y > Extent.x) {
+        Axis = 1;
+    }
+    if (Extent.z > AxisComponent(Extent, Axis)) {
+        Axis = 2;
+    }
+
+    // leaf, or all centers at the same point (can't be split)
+    if (Count <= BVHLeafSize || AxisComponent(Extent, Axis) <= 0.0f) {
+        BVH.Nodes[NodeNum].First = First;
+        BVH.Nodes[NodeNum].Count = Count;
+        return;
+    }
+
+    unsigned Half{Count / 2};
+    std::nth_element(Triangles.begin() + First, Triangles.begin() + First + Half, Triangles.begin() + First + Count,
+                     [Axis] (const sBVHTriangle &A, const sBVHTriangle &B) {
+        return AxisComponent(A.Center, Axis) < AxisComponent(B.Center, Axis);
+    });
+
+    // note, Nodes could be reallocated, don't hold references
+    unsigned ChildNum{static_cast<unsigned>(BVH.Nodes.size())};
+    BVH.Nodes[NodeNum].First = ChildNum;
+    BVH.Nodes[NodeNum].Count = 0;
+    BVH.Nodes.resize(ChildNum + 2);
+    BuildBVHNode(BVH, Triangles, ChildNum, First, Half);
+    BuildBVHNode(BVH, Triangles, ChildNum + 1, First + Half, Count - Half);
+}
+
+/*
+ * Create triangles BVH for all chunks (mesh collision detection).
+ */
+static void CreateChunksBVH(cModel3DWrapper *Model)
+{
+    for (auto &tmpChunk : Model->Chunks) {
+        unsigned TrianglesCount{tmpChunk.VertexQuantity / 3};
+        if (!TrianglesCount) {
+            continue;
+        }
+
+        std::vector<sBVHTriangle> Triangles(TrianglesCount);
+        for (unsigned i = 0; i < TrianglesCount; i++) {
+            sVECTOR3D Point[3];
+            for (unsigned j = 0; j < 3; j++) {
+                unsigned IndexPos{tmpChunk.RangeStart + i * 3 + j};
+                unsigned VertexPos{0};
+                if (tmpChunk.IndexArray) {
+                    VertexPos = tmpChunk.IndexArray.get()[IndexPos] * tmpChunk.VertexStride;
+                } else {
+                    VertexPos = IndexPos * tmpChunk.VertexStride;
+                }
+                Point[j](tmpChunk.VertexArray.get()[VertexPos],
+                         tmpChunk.VertexArray.get()[VertexPos + 1],
+                         tmpChunk.VertexArray.get()[VertexPos + 2]);
+            }
+
+            sVECTOR3D Min{Point[0]};
+            sVECTOR3D Max{Point[0]};
+            for (unsigned j = 1; j < 3; j++) {
+                Min(std::min(Min.x, Point[j].x), std::min(Min.y, Point[j].y), std::min(Min.z, Point[j].z));
+                Max(std::max(Max.x, Point[j].x), std::max(Max.y, Point[j].y), std::max(Max.z, Point[j].z));
+            }
+
+            // point in triangle check have allowable deviation, make sure we cover it
+            sVECTOR3D Size{Max - Min};
+            float Gap{std::max(std::max(Size.x, Size.y), Size.z) * 0.01f + 0.001f};
+            Triangles[i].Min = Min - sVECTOR3D{Gap, Gap, Gap};
+            Triangles[i].Max = Max + sVECTOR3D{Gap, Gap, Gap};
+            Triangles[i].Center = (Min + Max) / 2.0f;
+            Triangles[i].Num = i;
+        }
+
+        std::shared_ptr<sTriangleBVH> BVH{new sTriangleBVH};
+        BVH->Nodes.reserve(TrianglesCount * 2 / BVHLeafSize + 1);
+        BVH->Nodes.resize(1);
+        BuildBVHNode(*BVH, Triangles, 0, 0, TrianglesCount);
+
+        BVH->Triangles.resize(TrianglesCount);
+        for (unsigned i = 0; i < TrianglesCount; i++) {
+            BVH->Triangles[i] = Triangles[i].Num;
+        }
+        tmpChunk.TriangleBVH = BVH;
+    }
+}
+
 /*
  * Create all OpenGL-related hardware buffers.
  */
@@ -492,31 +632,73 @@ std::weak_ptr<sModel3D> vw_LoadModel3D(const std::string &FileName, float Triang
         return FoundModel->second;
     }
 
-    ModelsMap.emplace(FileName, std::shared_ptr<cModel3DWrapper>{new cModel3DWrapper, [](cModel3DWrapper *p) {delete p;}});
+    return vw_LoadModel3D(FileName, vw_PrepareModel3D(FileName, TriangleSizeLimit, NeedTangentAndBinormal));
+}
+
+/*
+ * Load 3D model's data and prepare all vertex arrays, without OpenGL calls.
+ */
+std::shared_ptr<sModel3D> vw_PrepareModel3D(const std::string &FileName, float TriangleSizeLimit,
+                                            bool NeedTangentAndBinormal)
+{
+    if (FileName.empty()) {
+        return std::shared_ptr<sModel3D>{};
+    }
+
+    std::shared_ptr<cModel3DWrapper> Model{new cModel3DWrapper, [](cModel3DWrapper *p) {delete p;}};
 
     // check extension
     if (vw_CheckFileExtension(FileName, ".vw3d")) {
-        if (!ModelsMap[FileName]->LoadVW3D(FileName)) {
+        if (!Model->LoadVW3D(FileName)) {
             std::cout << "Can't load file ... " << FileName << "\n";
-            ModelsMap.erase(FileName);
-            return std::weak_ptr<sModel3D>{};
+            return std::shared_ptr<sModel3D>{};
         }
     } else {
         std::cerr << __func__ << "(): " << "Format not supported " << FileName << "\n";
-        ModelsMap.erase(FileName);
-        return std::weak_ptr<sModel3D> {};
+        return std::shared_ptr<sModel3D>{};
     }
 
     if (NeedTangentAndBinormal) {
-        CreateTangentAndBinormal(ModelsMap[FileName].get());
+        CreateTangentAndBinormal(Model.get());
     }
-    CreateChunkBuffers(ModelsMap[FileName].get());
-    CreateHardwareBuffers(ModelsMap[FileName].get());
-    CreateVertexArrayLimitedBySizeTriangles(ModelsMap[FileName].get(), TriangleSizeLimit);
+    CreateChunkBuffers(Model.get());
+    CreateChunksBVH(Model.get());
+    CreateVertexArrayLimitedBySizeTriangles(Model.get(), TriangleSizeLimit);
+
+    return Model;
+}
+
+/*
+ * Load 3D model, prepared by vw_PrepareModel3D() (create OpenGL buffers).
+ */
+std::weak_ptr<sModel3D> vw_LoadModel3D(const std::string &FileName, const std::shared_ptr<sModel3D> &PreparedModel)
+{
+    if (FileName.empty() || !PreparedModel) {
+        return std::weak_ptr<sModel3D>{};
+    }
+
+    // if we already have it, just return previously loaded, we can't use same key twice
+    auto FoundModel = ModelsMap.find(FileName);
+    if (FoundModel != ModelsMap.end()) {
+        return FoundModel->second;
+    }
+
+    // only vw_PrepareModel3D() could create sModel3D, so, this is cModel3DWrapper for sure
+    std::shared_ptr<cModel3DWrapper> Model{std::static_pointer_cast<cModel3DWrapper>(PreparedModel)};
+    CreateHardwareBuffers(Model.get());
+    ModelsMap.emplace(FileName, Model);
 
     std::cout << "Loaded ... " << FileName << "\n";
 
-    return ModelsMap[FileName];
+    return Model;
+}
+
+/*
+ * Create empty 3D model for generated geometry, that is owned by caller (not stored with loaded models).
+ */
+std::shared_ptr<sModel3D> vw_CreateModel3D()
+{
+    return std::shared_ptr<sModel3D>{new cGeneratedModel3D, [](cGeneratedModel3D *p) {delete p;}};
 }
 
 /*
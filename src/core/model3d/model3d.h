@@ -50,6 +50,22 @@ struct sHitBB {
     sVECTOR3D Size{0.0f, 0.0f, 0.0f}; // HitBB's size
 };
 
+// Bounding volume hierarchy over chunk's triangles (in chunk's vertex array coordinates),
+// for mesh collision detection. Triangle's boxes are slightly enlarged, in order to cover
+// allowable deviation of mesh collision detection.
+struct sTriangleBVH {
+    struct sNode {
+        sVECTOR3D Min{0.0f, 0.0f, 0.0f};
+        sVECTOR3D Max{0.0f, 0.0f, 0.0f};
+        // leaf - Triangles[First, First + Count), node - children are Nodes[First] and Nodes[First + 1]
+        unsigned First{0};
+        unsigned Count{0};
+    };
+
+    std::vector<sNode> Nodes{}; // root is Nodes[0]
+    std::vector<unsigned> Triangles{}; // triangle's number (first vertex is Triangle * 3)
+};
+
 enum class eModel3DDrawType {
     Normal,
     Blend // with blend (for planet's sky)
@@ -90,6 +106,8 @@ struct sChunk3D {
     GLuint IBO{0};
     // vao-related
     GLuint VAO{0};
+    // collision-related, built on model load, should be reset if vertex or index array changed
+    std::shared_ptr<const sTriangleBVH> TriangleBVH{};
 
     // for explosion we need pre-generated vertex array with small triangles,
     // in this case, we could create cool looking effects, when enemies disintegrate
@@ -142,6 +160,15 @@ public:
 // Note, FileName used as a key in ModelsMap, and should not be used with different
 // TriangleSizeLimit or NeedTangentAndBinormal.
 std::weak_ptr<sModel3D> vw_LoadModel3D(const std::string &FileName, float TriangleSizeLimit, bool NeedTangentAndBinormal);
+// Load 3D model's data and prepare all vertex arrays, without OpenGL calls.
+// Could be called from any thread, result should be provided to vw_LoadModel3D().
+std::shared_ptr<sModel3D> vw_PrepareModel3D(const std::string &FileName, float TriangleSizeLimit,
+                                            bool NeedTangentAndBinormal);
+// Load 3D model, prepared by vw_PrepareModel3D() (create OpenGL buffers).
+std::weak_ptr<sModel3D> vw_LoadModel3D(const std::string &FileName, const std::shared_ptr<sModel3D> &PreparedModel);
+// Create empty 3D model for generated geometry, that is owned by caller (not stored with loaded models).
+// Note, chunk's OpenGL buffers are released only if chunk's NeedReleaseOpenGLBuffers is set.
+std::shared_ptr<sModel3D> vw_CreateModel3D();
 // Release all 3D models.
 void vw_ReleaseAllModel3D();
 
@@ -36,6 +36,9 @@
 #include "../camera/camera.h"
 #include "../light/light.h"
 #include "particle_system.h"
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif // __SSE__
 
 namespace viewizard {
 
@@ -64,68 +67,301 @@ GLint UniformLocationCameraPoint{0};
 // All particle systems.
 std::forward_list<std::shared_ptr<cParticleSystem>> ParticleSystemsList{};
 
+// Draw batch, adjacent (in draw order) visible particle systems with same texture
+// and blend mode, all particles will be rendered by one draw call.
+struct sDrawBatch {
+    GLtexture Texture{0};
+    bool TextureBlend{false};
+    unsigned ParticlesCount{0};
+    std::vector<cParticleSystem*> ParticleSystems{};
+};
+
+// Draw batches, reused each frame in order to avoid memory allocation,
+// only first DrawBatchesCount elements are used for current frame.
+std::vector<sDrawBatch> DrawBatches{};
+unsigned DrawBatchesCount{0};
+
 } // unnamed namespace
 
 
 /*
- * Update particle.
+ * Get all particle's fields, note, Age is the last one.
  */
-bool cParticle::Update(float TimeDelta, const sVECTOR3D &ParentLocation,
-                       bool Magnet, float MagnetFactor)
+std::array<std::vector<float>*, 21> cParticlesBuffer::Fields()
 {
-    if (Age + TimeDelta >= Lifetime) {
-        Age = -1.0f;
-        return false;
-    } else {
-        Age += TimeDelta;
+    return std::array<std::vector<float>*, 21>{{&LocationX, &LocationY, &LocationZ,
+                                                &VelocityX, &VelocityY, &VelocityZ,
+                                                &NeedStop,
+                                                &ColorR, &ColorG, &ColorB,
+                                                &ColorDeltaR, &ColorDeltaG, &ColorDeltaB,
+                                                &Lifetime,
+                                                &Size, &SizeDelta,
+                                                &Alpha, &AlphaDelta, &AlphaShowHide, &Show,
+                                                &Age}};
+}
+
+/*
+ * Add particle.
+ */
+void cParticlesBuffer::PushBack(const cParticle &NewParticle)
+{
+    LocationX.push_back(NewParticle.Location.x);
+    LocationY.push_back(NewParticle.Location.y);
+    LocationZ.push_back(NewParticle.Location.z);
+    VelocityX.push_back(NewParticle.Velocity.x);
+    VelocityY.push_back(NewParticle.Velocity.y);
+    VelocityZ.push_back(NewParticle.Velocity.z);
+    NeedStop.push_back(NewParticle.NeedStop ? 1.0f : 0.0f);
+    ColorR.push_back(NewParticle.Color.r);
+    ColorG.push_back(NewParticle.Color.g);
+    ColorB.push_back(NewParticle.Color.b);
+    ColorDeltaR.push_back(NewParticle.ColorDelta.r);
+    ColorDeltaG.push_back(NewParticle.ColorDelta.g);
+    ColorDeltaB.push_back(NewParticle.ColorDelta.b);
+    Lifetime.push_back(NewParticle.Lifetime);
+    Size.push_back(NewParticle.Size);
+    SizeDelta.push_back(NewParticle.SizeDelta);
+    Alpha.push_back(NewParticle.Alpha);
+    AlphaDelta.push_back(NewParticle.AlphaDelta);
+    AlphaShowHide.push_back(NewParticle.AlphaShowHide ? 1.0f : 0.0f);
+    Show.push_back(NewParticle.Show ? 1.0f : 0.0f);
+    Age.push_back(NewParticle.Age);
+}
 
-        Location += Velocity ^ TimeDelta;
+/*
+ * Remove the last particle.
+ */
+void cParticlesBuffer::PopBack()
+{
+    for (auto tmpField : Fields()) {
+        tmpField->pop_back();
+    }
+}
 
-        if (NeedStop) {
-            Velocity -= Velocity ^ TimeDelta;
+/*
+ * Remove dead particles (marked with negative age), keep particles order.
+ */
+void cParticlesBuffer::RemoveDead()
+{
+    unsigned NewCount{0};
+    // note, Age is the last one, so, it will be changed after all other fields
+    for (auto tmpField : Fields()) {
+        std::vector<float> &Field = *tmpField;
+        NewCount = 0;
+        for (unsigned i = 0; i < Field.size(); i++) {
+            if (Age[i] >= 0.0f) {
+                Field[NewCount++] = Field[i];
+            }
         }
+    }
 
-        if (Magnet) {
-            sVECTOR3D MagnetDir = ParentLocation;
-            MagnetDir -= Location;
-            MagnetDir.Normalize();
+    for (auto tmpField : Fields()) {
+        tmpField->resize(NewCount);
+    }
+}
 
-            if (NeedStop) {
-                MagnetFactor -= MagnetFactor * TimeDelta;
-            }
+/*
+ * Move all particles by offset.
+ */
+void cParticlesBuffer::Move(const sVECTOR3D &Offset)
+{
+    for (unsigned i = 0; i < Count(); i++) {
+        LocationX[i] += Offset.x;
+        LocationY[i] += Offset.y;
+        LocationZ[i] += Offset.z;
+    }
+}
+
+/*
+ * Update particle (scalar), return false if particle is dead.
+ */
+bool cParticlesBuffer::Update(unsigned i, float TimeDelta, const sVECTOR3D &ParentLocation,
+                              bool Magnet, float MagnetFactor)
+{
+    if (Age[i] + TimeDelta >= Lifetime[i]) {
+        Age[i] = -1.0f;
+        return false;
+    }
+
+    Age[i] += TimeDelta;
+
+    LocationX[i] += VelocityX[i] * TimeDelta;
+    LocationY[i] += VelocityY[i] * TimeDelta;
+    LocationZ[i] += VelocityZ[i] * TimeDelta;
 
-            Velocity += MagnetDir ^ (MagnetFactor * TimeDelta);
+    if (NeedStop[i] != 0.0f) {
+        VelocityX[i] -= VelocityX[i] * TimeDelta;
+        VelocityY[i] -= VelocityY[i] * TimeDelta;
+        VelocityZ[i] -= VelocityZ[i] * TimeDelta;
+    }
+
+    if (Magnet) {
+        sVECTOR3D MagnetDir{ParentLocation.x - LocationX[i],
+                            ParentLocation.y - LocationY[i],
+                            ParentLocation.z - LocationZ[i]};
+        MagnetDir.Normalize();
+
+        if (NeedStop[i] != 0.0f) {
+            MagnetFactor -= MagnetFactor * TimeDelta;
         }
 
-        Color.r += ColorDelta.r * TimeDelta;
-        vw_Clamp(Color.r, 0.0f, 1.0f);
-        Color.g += ColorDelta.g * TimeDelta;
-        vw_Clamp(Color.g, 0.0f, 1.0f);
-        Color.b += ColorDelta.b * TimeDelta;
-        vw_Clamp(Color.b, 0.0f, 1.0f);
+        VelocityX[i] += MagnetDir.x * (MagnetFactor * TimeDelta);
+        VelocityY[i] += MagnetDir.y * (MagnetFactor * TimeDelta);
+        VelocityZ[i] += MagnetDir.z * (MagnetFactor * TimeDelta);
+    }
 
-        if (!AlphaShowHide) {
-            Alpha += AlphaDelta * TimeDelta;
-        } else {
-            if (Show) {
-                Alpha += AlphaDelta * TimeDelta;
-                if (Alpha >= 1.0f) {
-                    Alpha = 1.0f;
-                    Show = false;
-                }
-            } else {
-                Alpha -= AlphaDelta * TimeDelta;
-            }
+    ColorR[i] += ColorDeltaR[i] * TimeDelta;
+    vw_Clamp(ColorR[i], 0.0f, 1.0f);
+    ColorG[i] += ColorDeltaG[i] * TimeDelta;
+    vw_Clamp(ColorG[i], 0.0f, 1.0f);
+    ColorB[i] += ColorDeltaB[i] * TimeDelta;
+    vw_Clamp(ColorB[i], 0.0f, 1.0f);
 
-            vw_Clamp(Alpha, 0.0f, 1.0f);
+    if (AlphaShowHide[i] == 0.0f) {
+        Alpha[i] += AlphaDelta[i] * TimeDelta;
+    } else {
+        if (Show[i] != 0.0f) {
+            Alpha[i] += AlphaDelta[i] * TimeDelta;
+            if (Alpha[i] >= 1.0f) {
+                Alpha[i] = 1.0f;
+                Show[i] = 0.0f;
+            }
+        } else {
+            Alpha[i] -= AlphaDelta[i] * TimeDelta;
         }
 
-        Size += SizeDelta * TimeDelta;
+        vw_Clamp(Alpha[i], 0.0f, 1.0f);
     }
 
+    Size[i] += SizeDelta[i] * TimeDelta;
+
     return true;
 }
 
+#ifdef __SSE__
+/*
+ * Select 'a' or 'b' by mask (SSE).
+ */
+static inline __m128 Select(__m128 Mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+}
+
+/*
+ * Clamp to [0.0f, 1.0f] (SSE).
+ */
+static inline __m128 Clamp01(__m128 Value)
+{
+    return _mm_min_ps(_mm_max_ps(Value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+}
+
+/*
+ * Update 4 particles starting from 'i' (SSE), return false if any particle is dead.
+ * Note, same calculations as scalar Update() have, but without branches.
+ */
+bool cParticlesBuffer::Update4(unsigned i, float TimeDelta, const sVECTOR3D &ParentLocation,
+                               bool Magnet, float MagnetFactor)
+{
+    const __m128 Zero = _mm_setzero_ps();
+    const __m128 One = _mm_set1_ps(1.0f);
+    const __m128 Delta = _mm_set1_ps(TimeDelta);
+
+    __m128 tmpAge = _mm_loadu_ps(&Age[i]);
+    __m128 NewAge = _mm_add_ps(tmpAge, Delta);
+    __m128 Dead = _mm_cmpge_ps(NewAge, _mm_loadu_ps(&Lifetime[i]));
+    _mm_storeu_ps(&Age[i], Select(Dead, _mm_set1_ps(-1.0f), NewAge));
+
+    __m128 LocX = _mm_add_ps(_mm_loadu_ps(&LocationX[i]), _mm_mul_ps(_mm_loadu_ps(&VelocityX[i]), Delta));
+    __m128 LocY = _mm_add_ps(_mm_loadu_ps(&LocationY[i]), _mm_mul_ps(_mm_loadu_ps(&VelocityY[i]), Delta));
+    __m128 LocZ = _mm_add_ps(_mm_loadu_ps(&LocationZ[i]), _mm_mul_ps(_mm_loadu_ps(&VelocityZ[i]), Delta));
+    _mm_storeu_ps(&LocationX[i], LocX);
+    _mm_storeu_ps(&LocationY[i], LocY);
+    _mm_storeu_ps(&LocationZ[i], LocZ);
+
+    // NeedStop is 1.0f or 0.0f, so, it could be used as factor
+    __m128 Stop = _mm_loadu_ps(&NeedStop[i]);
+    __m128 StopDelta = _mm_mul_ps(Delta, Stop);
+    __m128 VelX = _mm_loadu_ps(&VelocityX[i]);
+    __m128 VelY = _mm_loadu_ps(&VelocityY[i]);
+    __m128 VelZ = _mm_loadu_ps(&VelocityZ[i]);
+    VelX = _mm_sub_ps(VelX, _mm_mul_ps(VelX, StopDelta));
+    VelY = _mm_sub_ps(VelY, _mm_mul_ps(VelY, StopDelta));
+    VelZ = _mm_sub_ps(VelZ, _mm_mul_ps(VelZ, StopDelta));
+
+    if (Magnet) {
+        __m128 DirX = _mm_sub_ps(_mm_set1_ps(ParentLocation.x), LocX);
+        __m128 DirY = _mm_sub_ps(_mm_set1_ps(ParentLocation.y), LocY);
+        __m128 DirZ = _mm_sub_ps(_mm_set1_ps(ParentLocation.z), LocZ);
+        __m128 LengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(DirX, DirX), _mm_mul_ps(DirY, DirY)),
+                                          _mm_mul_ps(DirZ, DirZ));
+        // same as sVECTOR3D::Normalize(), approximate inverse square root, avoid 0 * inf for zero vector
+        __m128 InvLength = _mm_rsqrt_ps(_mm_max_ps(LengthSquared, _mm_set1_ps(1e-30f)));
+
+        __m128 Factor = _mm_set1_ps(MagnetFactor);
+        Factor = _mm_sub_ps(Factor, _mm_mul_ps(Factor, StopDelta));
+        Factor = _mm_mul_ps(_mm_mul_ps(Factor, Delta), InvLength);
+
+        VelX = _mm_add_ps(VelX, _mm_mul_ps(DirX, Factor));
+        VelY = _mm_add_ps(VelY, _mm_mul_ps(DirY, Factor));
+        VelZ = _mm_add_ps(VelZ, _mm_mul_ps(DirZ, Factor));
+    }
+
+    _mm_storeu_ps(&VelocityX[i], VelX);
+    _mm_storeu_ps(&VelocityY[i], VelY);
+    _mm_storeu_ps(&VelocityZ[i], VelZ);
+
+    _mm_storeu_ps(&ColorR[i], Clamp01(_mm_add_ps(_mm_loadu_ps(&ColorR[i]),
+                                                 _mm_mul_ps(_mm_loadu_ps(&ColorDeltaR[i]), Delta))));
+    _mm_storeu_ps(&ColorG[i], Clamp01(_mm_add_ps(_mm_loadu_ps(&ColorG[i]),
+                                                 _mm_mul_ps(_mm_loadu_ps(&ColorDeltaG[i]), Delta))));
+    _mm_storeu_ps(&ColorB[i], Clamp01(_mm_add_ps(_mm_loadu_ps(&ColorB[i]),
+                                                 _mm_mul_ps(_mm_loadu_ps(&ColorDeltaB[i]), Delta))));
+
+    __m128 tmpAlpha = _mm_loadu_ps(&Alpha[i]);
+    __m128 tmpAlphaDelta = _mm_mul_ps(_mm_loadu_ps(&AlphaDelta[i]), Delta);
+    __m128 ShowHide = _mm_cmpneq_ps(_mm_loadu_ps(&AlphaShowHide[i]), Zero);
+    __m128 tmpShow = _mm_loadu_ps(&Show[i]);
+    __m128 IsShow = _mm_cmpneq_ps(tmpShow, Zero);
+    __m128 AlphaUp = _mm_add_ps(tmpAlpha, tmpAlphaDelta);
+    __m128 AlphaDown = _mm_sub_ps(tmpAlpha, tmpAlphaDelta);
+    // show partition reach maximum, switch to hide partition
+    __m128 ShowEnd = _mm_and_ps(_mm_and_ps(ShowHide, IsShow), _mm_cmpge_ps(AlphaUp, One));
+    __m128 ShowHideAlpha = Clamp01(Select(IsShow, AlphaUp, AlphaDown));
+    _mm_storeu_ps(&Alpha[i], Select(ShowHide, ShowHideAlpha, AlphaUp));
+    _mm_storeu_ps(&Show[i], _mm_andnot_ps(ShowEnd, tmpShow));
+
+    _mm_storeu_ps(&Size[i], _mm_add_ps(_mm_loadu_ps(&Size[i]),
+                                       _mm_mul_ps(_mm_loadu_ps(&SizeDelta[i]), Delta)));
+
+    return !_mm_movemask_ps(Dead);
+}
+#endif // __SSE__
+
+/*
+ * Update all particles and remove dead particles.
+ */
+void cParticlesBuffer::Update(float TimeDelta, const sVECTOR3D &ParentLocation, bool Magnet, float MagnetFactor)
+{
+    bool NeedRemoveDead{false};
+    unsigned i{0};
+#ifdef __SSE__
+    for (; i + 4 <= Count(); i += 4) {
+        if (!Update4(i, TimeDelta, ParentLocation, Magnet, MagnetFactor)) {
+            NeedRemoveDead = true;
+        }
+    }
+#endif // __SSE__
+    for (; i < Count(); i++) {
+        if (!Update(i, TimeDelta, ParentLocation, Magnet, MagnetFactor)) {
+            NeedRemoveDead = true;
+        }
+    }
+
+    if (NeedRemoveDead) {
+        RemoveDead();
+    }
+}
+
 /*
  * Destructor.
  */
@@ -152,18 +388,8 @@ bool cParticleSystem::Update(float Time)
 
     TimeLastUpdate = Time;
 
-    // NOTE (?) use std::erase_if here (since C++20)
-    // update and remove (erase) dead particles
-    auto prev_iter = ParticlesList.before_begin();
-    for (auto iter = ParticlesList.begin(); iter != ParticlesList.end();) {
-        if (!iter->Update(TimeDelta, Location, IsMagnet, MagnetFactor)) {
-            iter = ParticlesList.erase_after(prev_iter);
-            ParticlesCountInList--;
-        } else {
-            prev_iter = iter;
-            ++iter;
-        }
-    }
+    // update and remove dead particles
+    Particles.Update(TimeDelta, Location, IsMagnet, MagnetFactor);
 
     // calculate, how many particles we should emit
     float ParticlesNeeded = (static_cast<float>(ParticlesPerSec) / ParticleSystemQuality) * TimeDelta + EmissionResidue;
@@ -184,7 +410,7 @@ bool cParticleSystem::Update(float Time)
         EmitParticles(ParticlesCreated, TimeDelta);
     }
 
-    if (DestroyIfNoParticles && ParticlesList.empty()) {
+    if (DestroyIfNoParticles && Particles.Empty()) {
         return false;
     }
 
@@ -215,12 +441,7 @@ void cParticleSystem::EmitParticles(unsigned int Quantity, float TimeDelta)
 
     while (Quantity > 0) {
         // create new particle
-        ParticlesList.emplace_front();
-        // NOTE emplace_front() return reference to the inserted element (since C++17)
-        //      this line could be combined with previous line, we could use
-        //      ParticlesList.front() directly, but "NewParticle" usage make code more clear
-        cParticle &NewParticle = ParticlesList.front();
-        ParticlesCountInList++;
+        cParticle NewParticle;
 
         // setup lifetime and age
         NewParticle.Age = 0.0f;
@@ -305,10 +526,14 @@ void cParticleSystem::EmitParticles(unsigned int Quantity, float TimeDelta)
         // don't change the last one, it should be created in current location and current time
         if (Quantity > 0) {
             NewParticle.Location += (LocationCorrection ^ static_cast<float>(Quantity));
-            if (!NewParticle.Update(TimeDeltaCorrection * static_cast<float>(Quantity), Location, IsMagnet, MagnetFactor)) {
-                ParticlesList.pop_front();
-                ParticlesCountInList--;
-            }
+        }
+
+        Particles.PushBack(NewParticle);
+
+        if (Quantity > 0
+            && !Particles.Update(Particles.Count() - 1, TimeDeltaCorrection * static_cast<float>(Quantity),
+                                 Location, IsMagnet, MagnetFactor)) {
+            Particles.PopBack();
         }
     }
 }
@@ -475,7 +700,7 @@ void cParticleSystem::UpdateLight(float TimeDelta)
         }
 
         // if we don't have particles, turn off light
-        sharedLight->On = !ParticlesList.empty();
+        sharedLight->On = !Particles.Empty();
     }
 }
 
@@ -486,49 +711,26 @@ void cParticleSystem::CalculateAABB()
 {
     // initial setup
     float MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
-    if (ParticlesList.empty()) {
+    if (Particles.Empty()) {
         MinX = MaxX = Location.x;
         MinY = MaxY = Location.y;
         MinZ = MaxZ = Location.z;
     } else {
-        MinX = MaxX = ParticlesList.front().Location.x;
-        MinY = MaxY = ParticlesList.front().Location.y;
-        MinZ = MaxZ = ParticlesList.front().Location.z;
+        // the last emitted particle
+        MinX = MaxX = Particles.LocationX.back();
+        MinY = MaxY = Particles.LocationY.back();
+        MinZ = MaxZ = Particles.LocationZ.back();
     }
 
     // calculate AABB
-    for (auto &tmpParticle : ParticlesList) {
-        if (tmpParticle.Alpha > 0.0f && tmpParticle.Size > 0.0f) {
-            sVECTOR3D v;
-            v.x = tmpParticle.Location.x + tmpParticle.Size;
-            if (MaxX < v.x) {
-                MaxX = v.x;
-            }
-
-            v.y = tmpParticle.Location.y + tmpParticle.Size;
-            if (MaxY < v.y) {
-                MaxY = v.y;
-            }
-
-            v.z = tmpParticle.Location.z + tmpParticle.Size;
-            if (MaxZ < v.z) {
-                MaxZ = v.z;
-            }
-
-            v.x = tmpParticle.Location.x - tmpParticle.Size;
-            if (MinX > v.x) {
-                MinX = v.x;
-            }
-
-            v.y = tmpParticle.Location.y - tmpParticle.Size;
-            if (MinY > v.y) {
-                MinY = v.y;
-            }
-
-            v.z = tmpParticle.Location.z - tmpParticle.Size;
-            if (MinZ > v.z) {
-                MinZ = v.z;
-            }
+    for (unsigned i = 0; i < Particles.Count(); i++) {
+        if (Particles.Alpha[i] > 0.0f && Particles.Size[i] > 0.0f) {
+            MaxX = std::max(MaxX, Particles.LocationX[i] + Particles.Size[i]);
+            MaxY = std::max(MaxY, Particles.LocationY[i] + Particles.Size[i]);
+            MaxZ = std::max(MaxZ, Particles.LocationZ[i] + Particles.Size[i]);
+            MinX = std::min(MinX, Particles.LocationX[i] - Particles.Size[i]);
+            MinY = std::min(MinY, Particles.LocationY[i] - Particles.Size[i]);
+            MinZ = std::min(MinZ, Particles.LocationZ[i] - Particles.Size[i]);
         }
     }
 
@@ -563,28 +765,28 @@ static inline void AddToDrawBuffer(float CoordX, float CoordY, float CoordZ,
 }
 
 /*
- * Draw all particles.
+ * Check, is particle system visible (have particles and in camera frustum).
  */
-void cParticleSystem::Draw(GLtexture &CurrentTexture)
+bool cParticleSystem::IsVisible()
 {
-    if (!vw_BoxInFrustum(AABB[6], AABB[0]) || ParticlesList.empty()) {
-        return;
-    }
-
-    // TRIANGLES * (RI_3f_XYZ + RI_2f_TEX + RI_4f_COLOR) * ParticlesCount
-    unsigned int tmpDrawBufferSize = 6 * (3 + 2 + 4) * ParticlesCountInList;
-    if (tmpDrawBufferSize > DrawBufferSize) {
-        DrawBufferSize = tmpDrawBufferSize;
-        DrawBuffer.reset(new float[DrawBufferSize]);
-    }
-    DrawBufferCurrentPosition = 0;
+    return !Particles.Empty() && vw_BoxInFrustum(AABB[6], AABB[0]);
+}
 
+/*
+ * Add all particles into draw buffer, caller should care about draw buffer size.
+ */
+void cParticleSystem::AddParticlesToDrawBuffer(const sVECTOR3D &CameraLocation)
+{
+    // note, draw particles from the last emitted one
     // without shaders, we need manually rotate each particle to camera
     if (!ParticleSystemUseGLSL) {
-        sVECTOR3D CurrentCameraLocation{vw_GetCameraLocation(nullptr)};
+        for (unsigned i = Particles.Count(); i > 0; i--) {
+            sVECTOR3D tmpLocation{Particles.GetLocation(i - 1)};
+            sRGBCOLOR tmpColor{Particles.ColorR[i - 1], Particles.ColorG[i - 1], Particles.ColorB[i - 1]};
+            float tmpAlpha = Particles.Alpha[i - 1];
+            float tmpSize = Particles.Size[i - 1];
 
-        for (auto &tmpParticle : ParticlesList) {
-            sVECTOR3D nnTmp{CurrentCameraLocation - tmpParticle.Location};
+            sVECTOR3D nnTmp{CameraLocation - tmpLocation};
 
             // perpendicular to vector nnTmp
             sVECTOR3D nnTmp2{1.0f, 1.0f, -(nnTmp.x + nnTmp.y) / nnTmp.z};
@@ -597,90 +799,78 @@ void cParticleSystem::Draw(GLtexture &CurrentTexture)
                              nnTmp.x * nnTmp2.y - nnTmp2.x * nnTmp.y};
             nnTmp3.Normalize();
 
-            sVECTOR3D tmpAngle1 = nnTmp3 ^ (tmpParticle.Size * 1.5f);
-            sVECTOR3D tmpAngle3 = nnTmp3 ^ (-tmpParticle.Size * 1.5f);
-            sVECTOR3D tmpAngle2 = nnTmp2 ^ (tmpParticle.Size * 1.5f);
-            sVECTOR3D tmpAngle4 = nnTmp2 ^ (-tmpParticle.Size * 1.5f);
+            sVECTOR3D tmpAngle1 = nnTmp3 ^ (tmpSize * 1.5f);
+            sVECTOR3D tmpAngle3 = nnTmp3 ^ (-tmpSize * 1.5f);
+            sVECTOR3D tmpAngle2 = nnTmp2 ^ (tmpSize * 1.5f);
+            sVECTOR3D tmpAngle4 = nnTmp2 ^ (-tmpSize * 1.5f);
 
             // first triangle
-            AddToDrawBuffer(tmpParticle.Location.x + tmpAngle3.x,
-                            tmpParticle.Location.y + tmpAngle3.y,
-                            tmpParticle.Location.z + tmpAngle3.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
+            AddToDrawBuffer(tmpLocation.x + tmpAngle3.x,
+                            tmpLocation.y + tmpAngle3.y,
+                            tmpLocation.z + tmpAngle3.z,
+                            tmpColor, tmpAlpha,
                             0.0f, 1.0f);
-            AddToDrawBuffer(tmpParticle.Location.x + tmpAngle2.x,
-                            tmpParticle.Location.y + tmpAngle2.y,
-                            tmpParticle.Location.z + tmpAngle2.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
+            AddToDrawBuffer(tmpLocation.x + tmpAngle2.x,
+                            tmpLocation.y + tmpAngle2.y,
+                            tmpLocation.z + tmpAngle2.z,
+                            tmpColor, tmpAlpha,
                             0.0f, 0.0f);
-            AddToDrawBuffer(tmpParticle.Location.x + tmpAngle1.x,
-                            tmpParticle.Location.y + tmpAngle1.y,
-                            tmpParticle.Location.z + tmpAngle1.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
+            AddToDrawBuffer(tmpLocation.x + tmpAngle1.x,
+                            tmpLocation.y + tmpAngle1.y,
+                            tmpLocation.z + tmpAngle1.z,
+                            tmpColor, tmpAlpha,
                             1.0f, 0.0f);
 
             //second triangle
-            AddToDrawBuffer(tmpParticle.Location.x + tmpAngle1.x,
-                            tmpParticle.Location.y + tmpAngle1.y,
-                            tmpParticle.Location.z + tmpAngle1.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
+            AddToDrawBuffer(tmpLocation.x + tmpAngle1.x,
+                            tmpLocation.y + tmpAngle1.y,
+                            tmpLocation.z + tmpAngle1.z,
+                            tmpColor, tmpAlpha,
                             1.0f, 0.0f);
-            AddToDrawBuffer(tmpParticle.Location.x + tmpAngle4.x,
-                            tmpParticle.Location.y + tmpAngle4.y,
-                            tmpParticle.Location.z + tmpAngle4.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
+            AddToDrawBuffer(tmpLocation.x + tmpAngle4.x,
+                            tmpLocation.y + tmpAngle4.y,
+                            tmpLocation.z + tmpAngle4.z,
+                            tmpColor, tmpAlpha,
                             1.0f, 1.0f);
-            AddToDrawBuffer(tmpParticle.Location.x + tmpAngle3.x,
-                            tmpParticle.Location.y + tmpAngle3.y,
-                            tmpParticle.Location.z + tmpAngle3.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
+            AddToDrawBuffer(tmpLocation.x + tmpAngle3.x,
+                            tmpLocation.y + tmpAngle3.y,
+                            tmpLocation.z + tmpAngle3.z,
+                            tmpColor, tmpAlpha,
                             0.0f, 1.0f);
         }
     } else {
         // shader will care about particle rotation
         // instead of textures coordinates, provide to shader vertex number (in triangle)
         // and particle size, shader will care about rotation and proper texture's coordinates
-        for (auto &tmpParticle : ParticlesList) {
+        for (unsigned i = Particles.Count(); i > 0; i--) {
+            sVECTOR3D tmpLocation{Particles.GetLocation(i - 1)};
+            sRGBCOLOR tmpColor{Particles.ColorR[i - 1], Particles.ColorG[i - 1], Particles.ColorB[i - 1]};
+            float tmpAlpha = Particles.Alpha[i - 1];
+            float tmpSize = Particles.Size[i - 1];
+
             // first triangle
-            AddToDrawBuffer(tmpParticle.Location.x, tmpParticle.Location.y, tmpParticle.Location.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
-                            1.0f, tmpParticle.Size);
-            AddToDrawBuffer(tmpParticle.Location.x, tmpParticle.Location.y, tmpParticle.Location.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
-                            2.0f, tmpParticle.Size);
-            AddToDrawBuffer(tmpParticle.Location.x, tmpParticle.Location.y, tmpParticle.Location.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
-                            3.0f, tmpParticle.Size);
+            AddToDrawBuffer(tmpLocation.x, tmpLocation.y, tmpLocation.z,
+                            tmpColor, tmpAlpha,
+                            1.0f, tmpSize);
+            AddToDrawBuffer(tmpLocation.x, tmpLocation.y, tmpLocation.z,
+                            tmpColor, tmpAlpha,
+                            2.0f, tmpSize);
+            AddToDrawBuffer(tmpLocation.x, tmpLocation.y, tmpLocation.z,
+                            tmpColor, tmpAlpha,
+                            3.0f, tmpSize);
 
             //second triangle
-            AddToDrawBuffer(tmpParticle.Location.x, tmpParticle.Location.y, tmpParticle.Location.z,
-                            tmpParticle.Color,  tmpParticle.Alpha,
-                            3.0f, tmpParticle.Size);
-            AddToDrawBuffer(tmpParticle.Location.x, tmpParticle.Location.y, tmpParticle.Location.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
-                            4.0f, tmpParticle.Size);
-            AddToDrawBuffer(tmpParticle.Location.x, tmpParticle.Location.y, tmpParticle.Location.z,
-                            tmpParticle.Color, tmpParticle.Alpha,
-                            1.0f, tmpParticle.Size);
+            AddToDrawBuffer(tmpLocation.x, tmpLocation.y, tmpLocation.z,
+                            tmpColor, tmpAlpha,
+                            3.0f, tmpSize);
+            AddToDrawBuffer(tmpLocation.x, tmpLocation.y, tmpLocation.z,
+                            tmpColor, tmpAlpha,
+                            4.0f, tmpSize);
+            AddToDrawBuffer(tmpLocation.x, tmpLocation.y, tmpLocation.z,
+                            tmpColor, tmpAlpha,
+                            1.0f, tmpSize);
         }
     }
-
-    // if we already setup this texture in previous rendered particle system, no need to change it
-    if (CurrentTexture != Texture) {
-        vw_BindTexture(0, Texture);
-        CurrentTexture = Texture;
-    }
-
-    if (TextureBlend) {
-        vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
-    } else {
-        vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE);
-    }
-
-    vw_Draw3D(ePrimitiveType::TRIANGLES, 6 * ParticlesCountInList, RI_3f_XYZ | RI_4f_COLOR | RI_1_TEX,
-              DrawBuffer.get(), 9 * sizeof(DrawBuffer.get()[0]));
-
-    vw_SetTextureBlend(true, eTextureBlendFactor::ONE, eTextureBlendFactor::ZERO);
 }
 
 /*
@@ -709,8 +899,10 @@ void cParticleSystem::MoveSystem(const sVECTOR3D &NewLocation)
     Location = NewLocation;
     PrevLocation = Location;
 
-    for (auto &tmpParticle : ParticlesList) {
-        tmpParticle.Location += tmpLocation;
+    for (unsigned i = 0; i < Particles.Count(); i++) {
+        Particles.LocationX[i] += tmpLocation.x;
+        Particles.LocationY[i] += tmpLocation.y;
+        Particles.LocationZ[i] += tmpLocation.z;
     }
 
     if (auto sharedLight = Light.lock()) {
@@ -766,12 +958,12 @@ void cParticleSystem::RotateSystemAndParticlesByAngle(const sVECTOR3D &NewAngle)
     vw_Matrix33CalcPoint(Direction, OldInvRotationMat);
     vw_Matrix33CalcPoint(Direction, CurrentRotationMat);
 
-    for (auto &tmpParticle : ParticlesList) {
-        sVECTOR3D TMP = tmpParticle.Location - Location;
-        vw_Matrix33CalcPoint(TMP, OldInvRotationMat);
-        vw_Matrix33CalcPoint(TMP, CurrentRotationMat);
-        tmpParticle.Location = TMP + Location;
-    }
+    Particles.Move(Location ^ -1.0f);
+    vw_Matrix33CalcPoints(OldInvRotationMat, Particles.LocationX.data(), Particles.LocationY.data(),
+                          Particles.LocationZ.data(), Particles.Count());
+    vw_Matrix33CalcPoints(CurrentRotationMat, Particles.LocationX.data(), Particles.LocationY.data(),
+                          Particles.LocationZ.data(), Particles.Count());
+    Particles.Move(Location);
 }
 
 /*
@@ -788,14 +980,14 @@ void cParticleSystem::RotateParticlesByAngle(const sVECTOR3D &NewAngle)
     float TmpRotationMat[9];
     vw_Matrix33CreateRotate(TmpRotationMat, NewAngle);
 
-    for (auto &tmpParticle : ParticlesList) {
-        sVECTOR3D TMP = tmpParticle.Location - Location;
-        vw_Matrix33CalcPoint(TMP, TmpOldInvRotationMat);
-
-        vw_Matrix33CalcPoint(TMP, TmpRotationMat);
-        vw_Matrix33CalcPoint(TMP, CurrentRotationMat);
-        tmpParticle.Location = TMP + Location;
-    }
+    Particles.Move(Location ^ -1.0f);
+    vw_Matrix33CalcPoints(TmpOldInvRotationMat, Particles.LocationX.data(), Particles.LocationY.data(),
+                          Particles.LocationZ.data(), Particles.Count());
+    vw_Matrix33CalcPoints(TmpRotationMat, Particles.LocationX.data(), Particles.LocationY.data(),
+                          Particles.LocationZ.data(), Particles.Count());
+    vw_Matrix33CalcPoints(CurrentRotationMat, Particles.LocationX.data(), Particles.LocationY.data(),
+                          Particles.LocationZ.data(), Particles.Count());
+    Particles.Move(Location);
 }
 
 /*
@@ -806,9 +998,9 @@ void cParticleSystem::StopAllParticles()
     Speed = 0.0f;
     IsMagnet = false;
 
-    for (auto &tmpParticle : ParticlesList) {
-        tmpParticle.Velocity = sVECTOR3D{0.0f, 0.0f, 0.0f};
-    }
+    std::fill(Particles.VelocityX.begin(), Particles.VelocityX.end(), 0.0f);
+    std::fill(Particles.VelocityY.begin(), Particles.VelocityY.end(), 0.0f);
+    std::fill(Particles.VelocityZ.begin(), Particles.VelocityZ.end(), 0.0f);
 }
 
 /*
@@ -816,8 +1008,30 @@ void cParticleSystem::StopAllParticles()
  */
 void cParticleSystem::ChangeSpeed(const sVECTOR3D &Vel)
 {
-    for (auto &tmpParticle : ParticlesList) {
-        tmpParticle.Velocity += Vel;
+    for (unsigned i = 0; i < Particles.Count(); i++) {
+        Particles.VelocityX[i] += Vel.x;
+        Particles.VelocityY[i] += Vel.y;
+        Particles.VelocityZ[i] += Vel.z;
+    }
+}
+
+/*
+ * Cycle for each particle, for external manipulations directly with particles data.
+ */
+void cParticleSystem::ForEachParticle(std::function<void (sVECTOR3D &pLocation,
+                                      sVECTOR3D &pVelocity,
+                                      bool &pNeedStop)> function)
+{
+    for (unsigned i = Particles.Count(); i > 0; i--) {
+        sVECTOR3D tmpLocation{Particles.GetLocation(i - 1)};
+        sVECTOR3D tmpVelocity{Particles.GetVelocity(i - 1)};
+        bool tmpNeedStop = (Particles.NeedStop[i - 1] != 0.0f);
+
+        function(tmpLocation, tmpVelocity, tmpNeedStop);
+
+        Particles.SetLocation(i - 1, tmpLocation);
+        Particles.SetVelocity(i - 1, tmpVelocity);
+        Particles.NeedStop[i - 1] = tmpNeedStop ? 1.0f : 0.0f;
     }
 }
 
@@ -906,55 +1120,51 @@ void vw_ReleaseAllParticleSystems()
 }
 
 /*
- * Draw all particle systems.
+ * Add visible particle system into last draw batch, if it has same texture and blend mode.
+ * Note, we don't merge particle systems with non-adjacent batches, since this will change
+ * particle systems draw order (blending result).
  */
-void vw_DrawAllParticleSystems()
+static void AddToDrawBatch(cParticleSystem &ParticleSystem)
 {
-    // current texture
-    // we store current texture in order to minimize texture's states changes
-    GLtexture CurrentTexture{0};
-
-    // setup shaders
-    if (ParticleSystemUseGLSL && !ParticleSystemGLSL.expired()) {
-        sVECTOR3D CurrentCameraLocation;
-        vw_GetCameraLocation(&CurrentCameraLocation);
-
-        vw_UseShaderProgram(ParticleSystemGLSL);
-        vw_Uniform1i(UniformLocationParticleTexture, 0);
-        vw_Uniform3f(UniformLocationCameraPoint, CurrentCameraLocation.x, CurrentCameraLocation.y, CurrentCameraLocation.z);
+    if (!ParticleSystem.IsVisible()) {
+        return;
     }
-    glDepthMask(GL_FALSE);
 
-    for (auto &tmpParticleSystems : ParticleSystemsList) {
-        tmpParticleSystems->Draw(CurrentTexture);
+    if (DrawBatchesCount) {
+        sDrawBatch &LastDrawBatch = DrawBatches[DrawBatchesCount - 1];
+        if (LastDrawBatch.Texture == ParticleSystem.Texture
+            && LastDrawBatch.TextureBlend == ParticleSystem.TextureBlend) {
+            LastDrawBatch.ParticleSystems.push_back(&ParticleSystem);
+            LastDrawBatch.ParticlesCount += ParticleSystem.GetParticlesCount();
+            return;
+        }
     }
 
-    // reset rendering states
-    glDepthMask(GL_TRUE);
-    if (ParticleSystemUseGLSL) {
-        vw_StopShaderProgram();
+    if (DrawBatchesCount == DrawBatches.size()) {
+        DrawBatches.emplace_back();
     }
-    vw_BindTexture(0, 0);
+    sDrawBatch &tmpDrawBatch = DrawBatches[DrawBatchesCount++];
+    tmpDrawBatch.Texture = ParticleSystem.Texture;
+    tmpDrawBatch.TextureBlend = ParticleSystem.TextureBlend;
+    tmpDrawBatch.ParticlesCount = ParticleSystem.GetParticlesCount();
+    tmpDrawBatch.ParticleSystems.clear();
+    tmpDrawBatch.ParticleSystems.push_back(&ParticleSystem);
 }
 
 /*
- * Draw particle systems block, provided by caller.
+ * Draw all draw batches in particle systems order, one draw call per batch.
  */
-void vw_DrawParticleSystems(std::vector<std::weak_ptr<cParticleSystem>> &DrawParticleSystem)
+static void DrawAllDrawBatches()
 {
-    if (DrawParticleSystem.empty()) {
+    if (!DrawBatchesCount) {
         return;
     }
 
-    // current texture
-    // we store current texture in order to minimize texture's states changes
-    GLtexture CurrentTexture{0};
+    sVECTOR3D CurrentCameraLocation;
+    vw_GetCameraLocation(&CurrentCameraLocation);
 
     // setup shaders
     if (ParticleSystemUseGLSL && !ParticleSystemGLSL.expired()) {
-        sVECTOR3D CurrentCameraLocation;
-        vw_GetCameraLocation(&CurrentCameraLocation);
-
         vw_UseShaderProgram(ParticleSystemGLSL);
         vw_Uniform1i(UniformLocationParticleTexture, 0);
         vw_Uniform3f(UniformLocationCameraPoint,
@@ -962,18 +1172,75 @@ void vw_DrawParticleSystems(std::vector<std::weak_ptr<cParticleSystem>> &DrawPar
     }
     glDepthMask(GL_FALSE);
 
-    for (auto &tmpParticleSystem : DrawParticleSystem) {
-        if (auto sharedParticleSystem = tmpParticleSystem.lock()) {
-            sharedParticleSystem->Draw(CurrentTexture);
+    for (unsigned i = 0; i < DrawBatchesCount; i++) {
+        sDrawBatch &tmpDrawBatch = DrawBatches[i];
+
+        // TRIANGLES * (RI_3f_XYZ + RI_2f_TEX + RI_4f_COLOR) * ParticlesCount
+        unsigned int tmpDrawBufferSize = 6 * (3 + 2 + 4) * tmpDrawBatch.ParticlesCount;
+        if (tmpDrawBufferSize > DrawBufferSize) {
+            DrawBufferSize = tmpDrawBufferSize;
+            DrawBuffer.reset(new float[DrawBufferSize]);
         }
+        DrawBufferCurrentPosition = 0;
+
+        for (auto tmpParticleSystem : tmpDrawBatch.ParticleSystems) {
+            tmpParticleSystem->AddParticlesToDrawBuffer(CurrentCameraLocation);
+        }
+
+        vw_BindTexture(0, tmpDrawBatch.Texture);
+        if (tmpDrawBatch.TextureBlend) {
+            vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
+        } else {
+            vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE);
+        }
+
+        vw_Draw3D(ePrimitiveType::TRIANGLES, 6 * tmpDrawBatch.ParticlesCount, RI_3f_XYZ | RI_4f_COLOR | RI_1_TEX,
+                  DrawBuffer.get(), 9 * sizeof(DrawBuffer.get()[0]));
     }
 
     // reset rendering states
+    vw_SetTextureBlend(true, eTextureBlendFactor::ONE, eTextureBlendFactor::ZERO);
     glDepthMask(GL_TRUE);
     if (ParticleSystemUseGLSL) {
         vw_StopShaderProgram();
     }
     vw_BindTexture(0, 0);
+
+    // don't hold pointers to particle systems
+    for (unsigned i = 0; i < DrawBatchesCount; i++) {
+        DrawBatches[i].ParticleSystems.clear();
+    }
+    DrawBatchesCount = 0;
+}
+
+/*
+ * Draw all particle systems.
+ */
+void vw_DrawAllParticleSystems()
+{
+    for (auto &tmpParticleSystem : ParticleSystemsList) {
+        AddToDrawBatch(*tmpParticleSystem);
+    }
+
+    DrawAllDrawBatches();
+}
+
+/*
+ * Draw particle systems block, provided by caller.
+ */
+void vw_DrawParticleSystems(std::vector<std::weak_ptr<cParticleSystem>> &DrawParticleSystem)
+{
+    if (DrawParticleSystem.empty()) {
+        return;
+    }
+
+    for (auto &tmpParticleSystem : DrawParticleSystem) {
+        if (auto sharedParticleSystem = tmpParticleSystem.lock()) {
+            AddToDrawBatch(*sharedParticleSystem);
+        }
+    }
+
+    DrawAllDrawBatches();
 }
 
 /*
@@ -46,14 +46,12 @@ enum class eParticleCreationType {
     Sphere
 };
 
+// New particle's data, see cParticlesBuffer for particles storage.
 class cParticle {
     friend class cParticleSystem;
+    friend class cParticlesBuffer;
 
 private:
-    // Update particle.
-    bool Update(float TimeDelta, const sVECTOR3D &ParentLocation = sVECTOR3D{0.0f, 0.0f, 0.0f},
-                bool Magnet = false, float MagnetFactor = 25.0f);
-
     sVECTOR3D Location{0.0f, 0.0f, 0.0f};
     sVECTOR3D Velocity{0.0f, 0.0f, 0.0f};
 
@@ -80,14 +78,99 @@ private:
     bool Show{true};
 };
 
+// Particles storage in SoA layout (separate array for each particle's field), in order
+// to update particles in vectorized way. Particles are stored in emission order (the oldest first).
+class cParticlesBuffer {
+    friend class cParticleSystem;
+
+private:
+    // Add particle.
+    void PushBack(const cParticle &NewParticle);
+    // Remove the last particle.
+    void PopBack();
+    // Update all particles and remove dead particles.
+    void Update(float TimeDelta, const sVECTOR3D &ParentLocation, bool Magnet, float MagnetFactor);
+    // Update particle (scalar), return false if particle is dead.
+    bool Update(unsigned i, float TimeDelta, const sVECTOR3D &ParentLocation, bool Magnet, float MagnetFactor);
+#ifdef __SSE__
+    // Update 4 particles starting from 'i' (SSE), return false if any particle is dead.
+    bool Update4(unsigned i, float TimeDelta, const sVECTOR3D &ParentLocation, bool Magnet, float MagnetFactor);
+#endif // __SSE__
+    // Remove dead particles (marked with negative age), keep particles order.
+    void RemoveDead();
+    // Move all particles by offset.
+    void Move(const sVECTOR3D &Offset);
+    // Get all particle's fields, note, Age is the last one.
+    std::array<std::vector<float>*, 21> Fields();
+
+    unsigned Count() const
+    {
+        return static_cast<unsigned>(Age.size());
+    }
+    bool Empty() const
+    {
+        return Age.empty();
+    }
+    sVECTOR3D GetLocation(unsigned i) const
+    {
+        return sVECTOR3D{LocationX[i], LocationY[i], LocationZ[i]};
+    }
+    void SetLocation(unsigned i, const sVECTOR3D &NewLocation)
+    {
+        LocationX[i] = NewLocation.x;
+        LocationY[i] = NewLocation.y;
+        LocationZ[i] = NewLocation.z;
+    }
+    sVECTOR3D GetVelocity(unsigned i) const
+    {
+        return sVECTOR3D{VelocityX[i], VelocityY[i], VelocityZ[i]};
+    }
+    void SetVelocity(unsigned i, const sVECTOR3D &NewVelocity)
+    {
+        VelocityX[i] = NewVelocity.x;
+        VelocityY[i] = NewVelocity.y;
+        VelocityZ[i] = NewVelocity.z;
+    }
+
+    std::vector<float> LocationX{};
+    std::vector<float> LocationY{};
+    std::vector<float> LocationZ{};
+    std::vector<float> VelocityX{};
+    std::vector<float> VelocityY{};
+    std::vector<float> VelocityZ{};
+    // note, bool fields are stored as 1.0f/0.0f, so, they could be used as factors and masks
+    std::vector<float> NeedStop{};
+    std::vector<float> ColorR{};
+    std::vector<float> ColorG{};
+    std::vector<float> ColorB{};
+    std::vector<float> ColorDeltaR{};
+    std::vector<float> ColorDeltaG{};
+    std::vector<float> ColorDeltaB{};
+    std::vector<float> Age{};
+    std::vector<float> Lifetime{};
+    std::vector<float> Size{};
+    std::vector<float> SizeDelta{};
+    std::vector<float> Alpha{};
+    std::vector<float> AlphaDelta{};
+    std::vector<float> AlphaShowHide{};
+    std::vector<float> Show{};
+};
+
 class cParticleSystem {
     friend std::weak_ptr<cParticleSystem> vw_CreateParticleSystem();
 
 public:
     // Update all particles.
     bool Update(float Time);
-    // Draw all particles.
-    void Draw(GLtexture &CurrentTexture);
+    // Check, is particle system visible (have particles and in camera frustum).
+    bool IsVisible();
+    // Add all particles into draw buffer, caller should care about draw buffer size.
+    void AddParticlesToDrawBuffer(const sVECTOR3D &CameraLocation);
+
+    unsigned GetParticlesCount() const
+    {
+        return Particles.Count();
+    }
 
     GLtexture Texture{0};
     bool TextureBlend{false};   // blend (for missiles trails)
@@ -175,17 +258,10 @@ public:
         return Location;
     }
 
-    // cycle for each particle in list, for external manipulations directly with particles data
+    // Cycle for each particle, for external manipulations directly with particles data.
     void ForEachParticle(std::function<void (sVECTOR3D &pLocation,
                          sVECTOR3D &pVelocity,
-                         bool &pNeedStop)> function)
-    {
-        for (auto &tmpParticle : ParticlesList) {
-            function(tmpParticle.Location,
-                     tmpParticle.Velocity,
-                     tmpParticle.NeedStop);
-        }
-    }
+                         bool &pNeedStop)> function);
 
 private:
     // Don't allow direct new/delete usage in code, only vw_CreateParticleSystem()
@@ -231,9 +307,7 @@ private:
                       sVECTOR3D{-1000000.0f, 1000000.0f, -1000000.0f}};
 
     // particles
-    std::forward_list<cParticle> ParticlesList{};
-    // we could use std::list with size(), but we don't need doubly-linked list here
-    unsigned int ParticlesCountInList{0};
+    cParticlesBuffer Particles{};
 
     // current rotation matrix for fast calculations
     float CurrentRotationMat[9]{1.0f, 0.0f, 0.0f,
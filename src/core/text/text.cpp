@@ -117,7 +117,7 @@ static void CreateTextTableUTF32()
 /*
  * Parse each row's block, separated by 1.SymbolSeparator, 2.SymbolEndOfLine, 3.EOF
  */
-static int GetRowTextBlock(std::string &CurrentTextBlock, uint8_t *Data, long DataSize, long &i,
+static int GetRowTextBlock(std::string &CurrentTextBlock, const uint8_t *Data, long DataSize, long &i,
                            const char SymbolSeparator, const char SymbolEndOfLine)
 {
     constexpr char SymbolQuotes{'\"'};
@@ -392,15 +392,88 @@ void vw_ConvertImageToVW2D(const std::string &SrcName, const std::string &DestNa
 }
 
 /*
- * Load texture from file.
+ * Preprocess image (alpha channel, resize, POT correction).
  */
-GLtexture vw_LoadTexture(const std::string &TextureName, eTextureCompressionType CompressionType,
-                         eLoadTextureAs LoadAs, int NeedResizeW, int NeedResizeH)
+static void PrepareTextureImage(sTextureImage &Image, bool Alpha, eAlphaCreateMode AFlag,
+                                int NeedResizeW, int NeedResizeH)
 {
-    if (TextureName.empty()) {
+    sTexture tmpTexture{};
+    tmpTexture.Width = Image.Width;
+    tmpTexture.Height = Image.Height;
+    tmpTexture.Bytes = Image.Bytes;
+
+    // if we have alpha channel, but don't need them - remove
+    if (tmpTexture.Bytes == 4 && !Alpha) {
+        RemoveAlpha(Image.PixelsArray, tmpTexture);
+    // if we don't have alpha channel, but need them - create
+    } else if (tmpTexture.Bytes == 3 && Alpha) {
+        CreateAlpha(Image.PixelsArray, tmpTexture, AFlag);
+    }
+
+    // Note, in case of resize, we should provide width and height (but not just one of them).
+    if (NeedResizeW && NeedResizeH) {
+        ResizeImage(NeedResizeW, NeedResizeH, Image.PixelsArray, tmpTexture);
+    }
+
+    // in case we change size, it is important to store "source" (initial) size
+    // that need for 2D rendering calculation, when we operate with pixels
+    // and don't count on NPOT resize
+    tmpTexture.SrcWidth = tmpTexture.Width;
+    tmpTexture.SrcHeight = tmpTexture.Height;
+
+    // if hardware don't support NPOT textures, forced to resize image manually
+    if (!vw_DevCaps().ARB_texture_non_power_of_two) {
+        ResizeToPOT(Image.PixelsArray, tmpTexture);
+    }
+
+    Image.Width = tmpTexture.Width;
+    Image.Height = tmpTexture.Height;
+    Image.SrcWidth = tmpTexture.SrcWidth;
+    Image.SrcHeight = tmpTexture.SrcHeight;
+    Image.Bytes = tmpTexture.Bytes;
+}
+
+/*
+ * Create texture from preprocessed image.
+ */
+static GLtexture CreateTexture(const std::string &TextureName, sTextureImage &Image,
+                               eTextureCompressionType CompressionType)
+{
+    GLtexture TextureID = vw_BuildTexture(Image.PixelsArray, Image.Width, Image.Height,
+                                          MipMapTex, Image.Bytes, CompressionType);
+
+    if (!TextureID) {
         return 0;
     }
 
+    vw_SetTextureFiltering(FilteringTex);
+    vw_SetTextureAnisotropy(AnisotropyLevelTex);
+    vw_SetTextureAddressMode(AddressModeTex);
+    vw_BindTexture(0, 0);
+
+    // create new entries
+    sTexture newTexture{};
+    newTexture.Width = Image.Width;
+    newTexture.Height = Image.Height;
+    newTexture.SrcWidth = Image.SrcWidth;
+    newTexture.SrcHeight = Image.SrcHeight;
+    newTexture.Bytes = Image.Bytes;
+    TexturesIDtoDataMap.emplace(TextureID, newTexture);
+
+    std::cout << "Texture created from memory: " << TextureName << "\n";
+    return TextureID;
+}
+
+/*
+ * Load and preprocess image for texture creation, without OpenGL calls.
+ */
+bool vw_LoadTextureImage(const std::string &TextureName, sTextureImage &Image, bool Alpha,
+                         eAlphaCreateMode AFlag, eLoadTextureAs LoadAs, int NeedResizeW, int NeedResizeH)
+{
+    if (TextureName.empty()) {
+        return false;
+    }
+
     int DWidth{0};
     int DHeight{0};
     int DChanels{0};
@@ -411,7 +484,7 @@ GLtexture vw_LoadTexture(const std::string &TextureName, eTextureCompressionType
     std::unique_ptr<cFILE> pFile = vw_fopen(TextureName);
     if (!pFile) {
         std::cerr << __func__ << "(): " << "Unable to found " << TextureName << "\n";
-        return 0;
+        return false;
     }
 
     // check extension
@@ -441,77 +514,79 @@ GLtexture vw_LoadTexture(const std::string &TextureName, eTextureCompressionType
         break;
 
     default:
-        return 0;
+        return false;
     }
 
-    if (!tmpPixelsArray.get()) {
+    if (!tmpPixelsArray.get() || DWidth <= 0 || DHeight <= 0) {
         std::cerr << __func__ << "(): " << "Unable to load " << TextureName << "\n";
-        return 0;
+        return false;
     }
 
     vw_fclose(pFile);
 
-    return vw_CreateTextureFromMemory(TextureName, tmpPixelsArray, DWidth, DHeight, DChanels,
-                                      CompressionType, NeedResizeW, NeedResizeH);
+    Image.PixelsArray = std::move(tmpPixelsArray);
+    Image.Width = DWidth;
+    Image.Height = DHeight;
+    Image.Bytes = DChanels;
+    PrepareTextureImage(Image, Alpha, AFlag, NeedResizeW, NeedResizeH);
+
+    return true;
 }
 
 /*
- * Create texture from memory.
+ * Create texture from image, prepared by vw_LoadTextureImage().
  */
-GLtexture vw_CreateTextureFromMemory(const std::string &TextureName, std::unique_ptr<uint8_t[]> &PixelsArray,
-                                     int ImageWidth, int ImageHeight, int ImageChanels,
-                                     eTextureCompressionType CompressionType,
-                                     int NeedResizeW, int NeedResizeH)
+GLtexture vw_CreateTextureFromImage(const std::string &TextureName, sTextureImage &Image,
+                                    eTextureCompressionType CompressionType)
 {
-    if (TextureName.empty() || !PixelsArray.get() || ImageWidth <= 0 || ImageHeight <= 0) {
+    if (TextureName.empty() || !Image.PixelsArray.get()) {
         return 0;
     }
 
-    sTexture newTexture{};
-    newTexture.Width = ImageWidth;
-    newTexture.Height = ImageHeight;
-    newTexture.Bytes = ImageChanels;
-
-    // if we have alpha channel, but don't need them - remove
-    if (newTexture.Bytes == 4 && !AlphaTex) {
-        RemoveAlpha(PixelsArray, newTexture);
-    // if we don't have alpha channel, but need them - create
-    } else if (newTexture.Bytes == 3 && AlphaTex) {
-        CreateAlpha(PixelsArray, newTexture, AFlagTex);
-    }
-
-    // Note, in case of resize, we should provide width and height (but not just one of them).
-    if (NeedResizeW && NeedResizeH) {
-        ResizeImage(NeedResizeW, NeedResizeH, PixelsArray, newTexture);
-    }
+    GLtexture TextureID = CreateTexture(TextureName, Image, CompressionType);
+    // pixels were uploaded, we don't need them any more
+    Image.PixelsArray.reset();
 
-    // in case we change size, it is important to store "source" (initial) size
-    // that need for 2D rendering calculation, when we operate with pixels
-    // and don't count on NPOT resize
-    newTexture.SrcWidth = newTexture.Width;
-    newTexture.SrcHeight = newTexture.Height;
+    return TextureID;
+}
 
-    // if hardware don't support NPOT textures, forced to resize image manually
-    if (!vw_DevCaps().ARB_texture_non_power_of_two) {
-        ResizeToPOT(PixelsArray, newTexture);
+/*
+ * Load texture from file.
+ */
+GLtexture vw_LoadTexture(const std::string &TextureName, eTextureCompressionType CompressionType,
+                         eLoadTextureAs LoadAs, int NeedResizeW, int NeedResizeH)
+{
+    sTextureImage tmpImage{};
+    if (!vw_LoadTextureImage(TextureName, tmpImage, AlphaTex, AFlagTex, LoadAs, NeedResizeW, NeedResizeH)) {
+        return 0;
     }
 
-    GLtexture TextureID = vw_BuildTexture(PixelsArray, newTexture.Width, newTexture.Height,
-                                          MipMapTex, newTexture.Bytes, CompressionType);
+    return vw_CreateTextureFromImage(TextureName, tmpImage, CompressionType);
+}
 
-    if (!TextureID) {
+/*
+ * Create texture from memory.
+ */
+GLtexture vw_CreateTextureFromMemory(const std::string &TextureName, std::unique_ptr<uint8_t[]> &PixelsArray,
+                                     int ImageWidth, int ImageHeight, int ImageChanels,
+                                     eTextureCompressionType CompressionType,
+                                     int NeedResizeW, int NeedResizeH)
+{
+    if (TextureName.empty() || !PixelsArray.get() || ImageWidth <= 0 || ImageHeight <= 0) {
         return 0;
     }
 
-    vw_SetTextureFiltering(FilteringTex);
-    vw_SetTextureAnisotropy(AnisotropyLevelTex);
-    vw_SetTextureAddressMode(AddressModeTex);
-    vw_BindTexture(0, 0);
+    sTextureImage tmpImage{};
+    tmpImage.PixelsArray = std::move(PixelsArray);
+    tmpImage.Width = ImageWidth;
+    tmpImage.Height = ImageHeight;
+    tmpImage.Bytes = ImageChanels;
+    PrepareTextureImage(tmpImage, AlphaTex, AFlagTex, NeedResizeW, NeedResizeH);
 
-    // create new entries
-    TexturesIDtoDataMap.emplace(TextureID, newTexture);
+    GLtexture TextureID = CreateTexture(TextureName, tmpImage, CompressionType);
+    // caller's pixels array should contain preprocessed image
+    PixelsArray = std::move(tmpImage.PixelsArray);
 
-    std::cout << "Texture created from memory: " << TextureName << "\n";
     return TextureID;
 }
 
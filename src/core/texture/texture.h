@@ -45,12 +45,31 @@ enum class eAlphaCreateMode {
     EQUAL   // Create alpha channel by equal Alpha color
 };
 
+// Decoded and preprocessed image, ready for texture creation.
+struct sTextureImage {
+    // std::unique_ptr, we need only memory allocation without container's features
+    std::unique_ptr<uint8_t[]> PixelsArray{};
+    int Width{0};       // Final image width
+    int Height{0};      // Final image height
+    int SrcWidth{0};    // Source image width (before POT correction)
+    int SrcHeight{0};   // Source image height (before POT correction)
+    int Bytes{0};       // Bytes per pixel
+};
+
 // Load texture from file.
 // Note, in case of resize, we should provide width and height (but not just one of them).
 GLtexture vw_LoadTexture(const std::string &TextureName,
                          eTextureCompressionType CompressionType = eTextureCompressionType::NONE,
                          eLoadTextureAs LoadAs = eLoadTextureAs::AUTO,
                          int NeedResizeW = 0, int NeedResizeH = 0);
+// Load and preprocess image for texture creation, without OpenGL calls.
+// Could be called from any thread, note, alpha color (see vw_SetTextureAlpha()) is used.
+bool vw_LoadTextureImage(const std::string &TextureName, sTextureImage &Image, bool Alpha,
+                         eAlphaCreateMode AFlag, eLoadTextureAs LoadAs = eLoadTextureAs::AUTO,
+                         int NeedResizeW = 0, int NeedResizeH = 0);
+// Create texture from image, prepared by vw_LoadTextureImage() (image's pixels will be released).
+GLtexture vw_CreateTextureFromImage(const std::string &TextureName, sTextureImage &Image,
+                                    eTextureCompressionType CompressionType = eTextureCompressionType::NONE);
 // Create texture from memory.
 GLtexture vw_CreateTextureFromMemory(const std::string &TextureName, std::unique_ptr<uint8_t[]> &PixelsArray,
                                      int ImageWidth, int ImageHeight, int ImageChanels,
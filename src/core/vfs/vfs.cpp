@@ -31,18 +31,19 @@
  The main VFS concept:
  1. store all game data in one file;
  2. provide unified access to game data (libSDL2 used as backend);
- 3. on request, copy game data to memory buffer and care about it.
+ 3. on request, provide game data memory buffer and care about it.
 
  On VFS file open, VFS entries list generated with all available in this VFS
  files data. Could be opened multiple VFS files, in this case VFS entries list
  will contain all available in all opened VFS files data.
- On cFILE open, all requested data will be copied into memory buffer (cFILE->Data_).
- Opened cFILE is not connected to VFS file or VFS entries list in any way.
+ VFS file is memory-mapped on open (if platform support this), in this case
+ cFILE->Data_ points directly into mapped region, no memory allocation and no
+ data copy. Otherwise (or for files from real file system), all requested data
+ will be copied into memory buffer (cFILE->Buffer_).
+ Opened cFILE holds memory-mapped VFS file, so, it could outlive vw_ShutdownVFS().
 
  Caller should hold cFILE open as long, as it need memory buffer (cFILE->Data_).
- In order to code simplicity, read and write direct access to cFILE data allowed.
- Caller could reset() memory buffer with different size (cFILE->Data), but should
- care about cFILE->Size_ and cFILE->Pos_ field (access by fseek()).
+ In order to code simplicity, read-only direct access to cFILE data allowed.
 
  Game data VFS v1.6 structure.
 
@@ -72,15 +73,33 @@ https://stackoverflow.com/questions/20895648/difference-in-make-shared-and-norma
 #include "vfs.h"
 #include <limits> // need this one for UINT16_MAX only
 
+#if defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // fstat
+#include <fcntl.h> // open
+#include <unistd.h> // close
+#endif // unix
+
 namespace viewizard {
 
 struct sVFS {
     std::string FileName;
     std::fstream File{};
+    // memory-mapped VFS file, nullptr if VFS file was not mapped (File should be used instead)
+    const uint8_t *MappedData{nullptr};
+    size_t MappedSize{0};
+    // File access from different threads (vw_fopen() for not mapped VFS file)
+    SDL_mutex *FileMutex{nullptr};
 
     explicit sVFS(const std::string &_FileName) :
         FileName{_FileName}
     {}
+    ~sVFS();
+
+    sVFS(sVFS const&) = delete;
+    void operator = (sVFS const&) = delete;
+
+    bool Map();
 };
 
 struct sVFS_Entry {
@@ -101,6 +120,89 @@ constexpr unsigned int FixedHeaderPartSize = 4 + 4 + 4; /*VFS_ + ver + build*/
 } // unnamed namespace
 
 
+/*
+ * Map VFS file into memory (read-only).
+ */
+bool sVFS::Map()
+{
+#if defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+    int fd = open(FileName.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+
+    struct stat tmpStat;
+    if (fstat(fd, &tmpStat) == -1 || tmpStat.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void *tmpData = mmap(nullptr, static_cast<size_t>(tmpStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping holds its own reference to file, so, we could close file descriptor now
+    close(fd);
+    if (tmpData == MAP_FAILED) {
+        return false;
+    }
+
+    MappedData = static_cast<const uint8_t*>(tmpData);
+    MappedSize = static_cast<size_t>(tmpStat.st_size);
+    return true;
+#elif defined(WIN32)
+    HANDLE tmpFile = CreateFileA(FileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (tmpFile == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER tmpSize;
+    if (!GetFileSizeEx(tmpFile, &tmpSize) || tmpSize.QuadPart <= 0) {
+        CloseHandle(tmpFile);
+        return false;
+    }
+
+    HANDLE tmpMapping = CreateFileMappingA(tmpFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // mapping holds its own reference to file
+    CloseHandle(tmpFile);
+    if (!tmpMapping) {
+        return false;
+    }
+
+    void *tmpData = MapViewOfFile(tmpMapping, FILE_MAP_READ, 0, 0, 0);
+    // view holds its own reference to mapping
+    CloseHandle(tmpMapping);
+    if (!tmpData) {
+        return false;
+    }
+
+    MappedData = static_cast<const uint8_t*>(tmpData);
+    MappedSize = static_cast<size_t>(tmpSize.QuadPart);
+    return true;
+#else
+    return false;
+#endif // unix
+}
+
+/*
+ * Unmap VFS file, if it was mapped.
+ */
+sVFS::~sVFS()
+{
+    if (FileMutex) {
+        SDL_DestroyMutex(FileMutex);
+    }
+
+    if (!MappedData) {
+        return;
+    }
+
+#if defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+    munmap(const_cast<uint8_t*>(MappedData), MappedSize);
+#elif defined(WIN32)
+    UnmapViewOfFile(MappedData);
+#endif // unix
+}
+
+
 /*
  * Write data from memory into VFS file.
  */
@@ -356,6 +458,14 @@ int vw_OpenVFS(const std::string &Name, unsigned int BuildNumber)
     // unconditional rehash, at this line we have not rehashed map
     VFSEntriesMap.rehash(0);
 
+    // all data will be provided from mapped memory, we don't need file stream any more
+    if (VFSList.front()->Map()) {
+        VFSList.front()->File.close();
+    } else {
+        std::cerr << __func__ << "(): " << "Can't map VFS file into memory, file stream will be used instead.\n";
+        VFSList.front()->FileMutex = SDL_CreateMutex();
+    }
+
     std::cout << "VFS file was opened " << Name << "\n";
     return 0;
 }
@@ -395,9 +505,28 @@ std::unique_ptr<cFILE> vw_fopen(const std::string &FileName)
         std::unique_ptr<cFILE> File(new cFILE(0, 0));
 
         File->Size_ = static_cast<long>(FileInVFS->second.Size);
+
+        // zero-copy, point directly into mapped VFS file
+        if (sharedParent->MappedData) {
+            if (static_cast<size_t>(FileInVFS->second.Offset) + FileInVFS->second.Size > sharedParent->MappedSize) {
+                std::cerr << __func__ << "(): " << "VFS file corrupted, entry out of file: " << FileName << "\n";
+                return nullptr;
+            }
+            File->Data_ = sharedParent->MappedData + FileInVFS->second.Offset;
+            File->MappedVFS_ = sharedParent;
+            return File;
+        }
+
+        File->Buffer_.reset(new uint8_t[File->Size_]);
+        if (sharedParent->FileMutex) {
+            SDL_LockMutex(sharedParent->FileMutex);
+        }
         sharedParent->File.seekg(FileInVFS->second.Offset, std::ios::beg);
-        File->Data_.reset(new uint8_t[File->Size_]);
-        sharedParent->File.read(reinterpret_cast<char*>(File->Data_.get()), File->Size_);
+        sharedParent->File.read(reinterpret_cast<char*>(File->Buffer_.get()), File->Size_);
+        if (sharedParent->FileMutex) {
+            SDL_UnlockMutex(sharedParent->FileMutex);
+        }
+        File->Data_ = File->Buffer_.get();
 
         return File;
     }
@@ -414,8 +543,9 @@ std::unique_ptr<cFILE> vw_fopen(const std::string &FileName)
         std::unique_ptr<cFILE> File(new cFILE(0, 0));
 
         File->Size_ = static_cast<long>(tmpSize);
-        File->Data_.reset(new uint8_t[File->Size_]);
-        fsFile.read(reinterpret_cast<char*>(File->Data_.get()), File->Size_);
+        File->Buffer_.reset(new uint8_t[File->Size_]);
+        fsFile.read(reinterpret_cast<char*>(File->Buffer_.get()), File->Size_);
+        File->Data_ = File->Buffer_.get();
 
         return File;
     }
@@ -451,7 +581,7 @@ size_t cFILE::fread(void *buffer, size_t size, size_t count)
 
     size_t CopyCount{0};
     for (; (CopyCount < count) && (Size_ >= static_cast<long>(Pos_ + size)); CopyCount++) {
-        memcpy(static_cast<uint8_t *>(buffer) + CopyCount * size, Data_.get() + Pos_, size);
+        memcpy(static_cast<uint8_t *>(buffer) + CopyCount * size, Data_ + Pos_, size);
         Pos_ += size;
     }
 
@@ -32,6 +32,8 @@
 
 namespace viewizard {
 
+struct sVFS;
+
 constexpr char VFS_VER[]{"v1.6"};
 
 // Create VFS file.
@@ -52,14 +54,18 @@ public:
         Pos_{Pos}
     {}
 
+    cFILE(cFILE const&) = delete;
+    void operator = (cFILE const&) = delete;
+
     long GetSize()
     {
         return Size_;
     }
 
-    uint8_t *GetData()
+    // Note, data could point directly into memory-mapped VFS file, read-only access.
+    const uint8_t *GetData()
     {
-        return Data_.get();
+        return Data_;
     }
 
     size_t fread(void *buffer, size_t size, size_t count);
@@ -70,12 +76,17 @@ private:
     long Size_{0};
     long Pos_{0};
 
+    // points to Buffer_ or into memory-mapped VFS file
+    const uint8_t *Data_{nullptr};
     // std::unique_ptr, we need only memory allocation without container's features
     // don't use std::vector here, since it allocates AND value-initializes
-    std::unique_ptr<uint8_t[]> Data_{};
+    std::unique_ptr<uint8_t[]> Buffer_{};
+    // hold memory-mapped VFS file, while we use its data
+    std::shared_ptr<sVFS> MappedVFS_{};
 };
 
 // Return std::unique_ptr, provide smart pointer connected to caller's scope.
+// Could be called from different threads, while VFS files are not opened or closed.
 std::unique_ptr<cFILE> vw_fopen(const std::string &FileName);
 // You could call vw_fclose() if you should release memory in particular
 // part of code. Otherwise, it will be released automatically (see. unique_ptr).
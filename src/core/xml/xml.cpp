@@ -273,7 +273,7 @@ cXMLDocument::cXMLDocument(const std::string &XMLFileName, bool Hash)
     }
     std::string Buffer{};
     Buffer.resize(File->GetSize() + 1, '\0');
-    Buffer.assign(reinterpret_cast<char*>(File->GetData()), File->GetSize());
+    Buffer.assign(reinterpret_cast<const char*>(File->GetData()), File->GetSize());
     vw_fclose(File);
 
     // check header
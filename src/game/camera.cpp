@@ -67,6 +67,7 @@ float CameraLastUpdate{0.0f};
 float CameraSpeed{10.0f};
 sVECTOR3D CameraCoveredDistance{0.0f, 0.0f, 0.0f};
 sVECTOR3D CameraMovementDirection{0.0f, 0.0f, 1.0f};
+sVECTOR3D CameraLastMovement{0.0f, 0.0f, 0.0f};
 // camera shake on explosion related vaiables
 float CameraCurrentShake{0.0f};
 float CameraNeedShake{0.0f};
@@ -83,6 +84,7 @@ float CameraShakePower{0.0f};
 void ResetCamera()
 {
     CameraCoveredDistance(0.0f, 0.0f, 0.0f);
+    CameraLastMovement(0.0f, 0.0f, 0.0f);
     CameraLastUpdate = 0.0f;
 
     CameraCurrentShake = 0.0f;
@@ -180,6 +182,7 @@ void CameraUpdate(float Time)
     CameraLastUpdate = Time;
 
     sVECTOR3D tmpDistance = CameraMovementDirection ^ (CameraSpeed * TimeDelta);
+    CameraLastMovement = tmpDistance;
     CameraCoveredDistance += tmpDistance;
     vw_IncCameraLocation(tmpDistance);
 
@@ -222,5 +225,13 @@ const sVECTOR3D &GetCameraMovementDirection()
     return CameraMovementDirection;
 }
 
+/*
+ * Get camera movement during last update.
+ */
+const sVECTOR3D &GetCameraLastMovement()
+{
+    return CameraLastMovement;
+}
+
 } // astromenace namespace
 } // viewizard namespace
@@ -53,6 +53,8 @@ float GetCameraSpeed();
 const sVECTOR3D &GetCameraCoveredDistance();
 // Get camera movement direction.
 const sVECTOR3D &GetCameraMovementDirection();
+// Get camera movement during last update.
+const sVECTOR3D &GetCameraLastMovement();
 
 } // astromenace namespace
 } // viewizard namespace
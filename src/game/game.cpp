@@ -35,6 +35,7 @@
 #include "../ui/game_speed.h"
 #include "../ui/game/text.h"
 #include "../ui/game/stopwatch.h"
+#include "../ui/profiler.h"
 #include "../assets/audio.h"
 #include "../assets/texture.h"
 #include "../gfx/star_system.h"
@@ -59,6 +60,12 @@ std::unique_ptr<cMissionScript> MissionScript{};
 
 eCommand GameExitCommand{eCommand::DO_NOTHING};
 
+// maximum simulation ticks per frame, if simulation can't keep up with time, all
+// time above this limit will be processed by last tick (as one big time step)
+constexpr unsigned MaxSimulationTicksPerFrame{5};
+// game time (time thread 1) of last simulation tick
+double SimulationTime{0.0};
+
 } // unnamed namespace
 
 
@@ -140,7 +147,7 @@ extern float CurrentTime;
 
 // работа с кораблем игрока
 void InitGamePlayerShip();
-void GamePlayerShip();
+void GamePlayerShip(float TimeDelta);
 float GetShipMaxEnergy(int Num);
 extern float CurrentPlayerShipEnergy;
 extern int LastMouseX;
@@ -247,6 +254,7 @@ void InitGame()
     if (!MissionScript->RunScript(GetCurrentMissionFileName(), vw_GetTimeThread(1))) {
         MissionScript.reset();
     }
+    SimulationTime = vw_GetTimeThread(1);
 
 
     SetupMissionNumberText(3.0f, CurrentMission + 1);
@@ -451,11 +459,76 @@ void SetGameMissionComplete()
 
 
 
+/*
+ * Game simulation tick.
+ */
+static void GameSimulationTick(float Time)
+{
+    CameraUpdate(Time);
+
+    UpdateAllObject3D(Time);
+    {
+        PROFILER_ZONE("UpdateAllParticleSystems");
+        vw_UpdateAllParticleSystems(Time);
+    }
+
+    // проверяем на столкновения
+    if (GameContentTransp < 0.99f) { // не нужно проверять коллизии, включено меню
+        DetectCollisionAllObject3D();
+    }
+
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // работаем со скриптом, пока он есть
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    PROFILER_ZONE("MissionScript");
+    if (MissionScript && !MissionScript->Update(Time)) {
+        MissionScript.reset();
+    }
+}
+
+/*
+ * Game simulation with fixed time step (see sGameConfig::SimulationTickRate).
+ * Return interpolation factor between previous and current ticks for rendering.
+ */
+static float GameSimulation(float &SimulatedTimeDelta)
+{
+    PROFILER_ZONE("GameSimulation");
+
+    double TargetTime{vw_GetTimeThread(1)};
+    double StartTime{SimulationTime};
+
+    if (GameConfig().SimulationTickRate <= 0) {
+        if (TargetTime > SimulationTime) {
+            SimulationTime = TargetTime;
+            GameSimulationTick(static_cast<float>(SimulationTime));
+        }
+        SimulatedTimeDelta = static_cast<float>(SimulationTime - StartTime);
+        return 1.0f;
+    }
+
+    double TickStep{1.0 / GameConfig().SimulationTickRate};
+    unsigned TicksCount{0};
+    while (SimulationTime + TickStep <= TargetTime) {
+        TicksCount++;
+        if (TicksCount == MaxSimulationTicksPerFrame) {
+            // catch up with time by one big step, same as variable time step do
+            SimulationTime = TargetTime;
+        } else {
+            SimulationTime += TickStep;
+        }
+        GameSimulationTick(static_cast<float>(SimulationTime));
+    }
+
+    SimulatedTimeDelta = static_cast<float>(SimulationTime - StartTime);
+    return static_cast<float>((TargetTime - SimulationTime) / TickStep);
+}
+
 //------------------------------------------------------------------------------------
 // прорисовка игровой части
 //------------------------------------------------------------------------------------
 void DrawGame()
 {
+    PROFILER_ZONE("DrawGame");
 
     float TimeDelta = vw_GetTimeThread(0) - CurrentTime;
     CurrentTime = vw_GetTimeThread(0);
@@ -477,10 +550,16 @@ void DrawGame()
 
 
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // Работа с 3д частью... прорисовка, просчет
+    // Работа с 3д частью... просчет, прорисовка
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    CameraUpdate(vw_GetTimeThread(1));
+    float SimulatedTimeDelta{0.0f};
+    float InterpolationFactor = GameSimulation(SimulatedTimeDelta);
+
+    // render camera and objects between previous and current simulation ticks
+    sVECTOR3D CameraDrawOffset = GetCameraLastMovement() ^ (InterpolationFactor - 1.0f);
+    vw_IncCameraLocation(CameraDrawOffset);
     vw_CameraLookAt();
+    SetObject3DInterpolationFactor(InterpolationFactor);
 
 
     // всегда первым рисуем скайбокс и "далекое" окружение
@@ -490,23 +569,8 @@ void DrawGame()
     // рисуем все 3д объекты
     DrawAllObject3D(eDrawType::GAME);
 
-
-    // после полной прорисовки делаем обновление данных
-    UpdateAllObject3D(vw_GetTimeThread(1));
-    vw_UpdateAllParticleSystems(vw_GetTimeThread(1));
-
-    // проверяем на столкновения
-    if (GameContentTransp < 0.99f) { // не нужно проверять коллизии, включено меню
-        DetectCollisionAllObject3D();
-    }
-
-
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // работаем со скриптом, пока он есть
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    if (MissionScript && !MissionScript->Update(vw_GetTimeThread(1))) {
-        MissionScript.reset();
-    }
+    SetObject3DInterpolationFactor(1.0f);
+    vw_IncCameraLocation(CameraDrawOffset ^ (-1.0f));
 
 
 
@@ -526,13 +590,16 @@ void DrawGame()
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     // Обработка состояния корабля игрока
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    GamePlayerShip();
+    GamePlayerShip(SimulatedTimeDelta);
 
 
-    UpdateHUD(PlayerFighter,
-              GamePowerSystem ? (CurrentPlayerShipEnergy / GetShipMaxEnergy(GamePowerSystem)) : 0.0f);
-    DrawHUD();
-    DrawWeaponPanels(PlayerFighter); // (?) part of HUD
+    {
+        PROFILER_ZONE("HUD");
+        UpdateHUD(PlayerFighter,
+                  GamePowerSystem ? (CurrentPlayerShipEnergy / GetShipMaxEnergy(GamePowerSystem)) : 0.0f);
+        DrawHUD();
+        DrawWeaponPanels(PlayerFighter); // (?) part of HUD
+    }
 
     cGameSpeed::GetInstance().Draw();
 
@@ -408,7 +408,7 @@ void InitGamePlayerShip()
 //------------------------------------------------------------------------------------
 // Основная процедура обработки состояния корабля игрока
 //------------------------------------------------------------------------------------
-void GamePlayerShip()
+void GamePlayerShip(float TimeDelta)
 {
     auto sharedPlayerFighter = PlayerFighter.lock();
     if (!sharedPlayerFighter) {
@@ -449,18 +449,8 @@ void GamePlayerShip()
         //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         // Вывод голосового предупреждения, если навелась ракета
         //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        bool CheckStatus{false};
-        ForEachProjectile([&] (const cProjectile &Projectile) {
-            if (auto sharedTarget = Projectile.Target.lock()) {
-                if (sharedTarget.get() == sharedPlayerFighter.get() &&
-                    // homing missile targeted on this ship, but not homing mine
-                    (Projectile.Num < 26 || Projectile.Num > 29)) {
-                    CheckStatus = true;
-                }
-            }
-        });
-
-        if (CheckStatus) {
+        // homing missile targeted on this ship, but not homing mine
+        if (IsTargetedByHomingMissile(*sharedPlayerFighter)) {
             // проверяем, действительно еще играем (играем только 1 раз!)
             if (!vw_IsSoundAvailable(VoiceMissileDetected) && !VoiceMissileDetectedStatus) {
                 VoiceMissileDetected = PlayVoicePhrase(eVoicePhrase::MissileDetected, 1.0f);
@@ -503,7 +493,8 @@ void GamePlayerShip()
                 Command = eSpaceCycle::Break;
             }
         });
-        ForEachGroundObject([&CollisionDetected, &sharedPlayerFighter] (const cGroundObject &tmpGround, eGroundCycle &Command) {
+        ForEachGroundObject([&CollisionDetected, &sharedPlayerFighter] (cGroundObject &tmpGround, eGroundCycle &Command) {
+            tmpGround.UpdateBounds();
             // test with "immortal" civilian buildings
             if (tmpGround.ObjectType == eObjectType::CivilianBuilding
                 && vw_SphereSphereCollision(sharedPlayerFighter->Radius, sharedPlayerFighter->Location,
@@ -609,16 +600,16 @@ void GamePlayerShip()
         // клавиатура
         if (!NeedSkip) {
             if (vw_GetKeyStatus(GameConfig().KeyBoardDown)) {
-                MoveFB -= 2.0f * (GameConfig().ControlSensivity / 10.0f) * sharedPlayerFighter->TimeDelta;
+                MoveFB -= 2.0f * (GameConfig().ControlSensivity / 10.0f) * TimeDelta;
             }
             if (vw_GetKeyStatus(GameConfig().KeyBoardUp)) {
-                MoveFB += 2.0f * (GameConfig().ControlSensivity / 10.0f) * sharedPlayerFighter->TimeDelta;
+                MoveFB += 2.0f * (GameConfig().ControlSensivity / 10.0f) * TimeDelta;
             }
             if (vw_GetKeyStatus(GameConfig().KeyBoardLeft)) {
-                MoveLR -= 2.0f * (GameConfig().ControlSensivity / 10.0f) * sharedPlayerFighter->TimeDelta;
+                MoveLR -= 2.0f * (GameConfig().ControlSensivity / 10.0f) * TimeDelta;
             }
             if (vw_GetKeyStatus(GameConfig().KeyBoardRight)) {
-                MoveLR += 2.0f * (GameConfig().ControlSensivity / 10.0f) * sharedPlayerFighter->TimeDelta;
+                MoveLR += 2.0f * (GameConfig().ControlSensivity / 10.0f) * TimeDelta;
             }
         }
 
@@ -692,7 +683,7 @@ void GamePlayerShip()
                     SimMoveSpeed = 30.0f;
                 }
 
-                SimMoveSpeed = SimMoveSpeed*4.0f*sharedPlayerFighter->TimeDelta;
+                SimMoveSpeed = SimMoveSpeed*4.0f*TimeDelta;
 
 
                 // получаем текущее движение
@@ -740,7 +731,7 @@ void GamePlayerShip()
                     SimMoveSpeed = sharedPlayerFighter->MaxSpeed;
                 }
 
-                SimMoveSpeed = SimMoveSpeed*(sharedPlayerFighter->MaxAcceler/14.0f)*sharedPlayerFighter->TimeDelta;
+                SimMoveSpeed = SimMoveSpeed*(sharedPlayerFighter->MaxAcceler/14.0f)*TimeDelta;
 
 
                 // получаем текущее движение
@@ -809,8 +800,8 @@ void GamePlayerShip()
         int SecCount = 0;
         float SecTime = 0.0f;
 
-        PrimaryGroupCurrentFireWeaponDelay -= sharedPlayerFighter->TimeDelta;
-        SecondaryGroupCurrentFireWeaponDelay -= sharedPlayerFighter->TimeDelta;
+        PrimaryGroupCurrentFireWeaponDelay -= TimeDelta;
+        SecondaryGroupCurrentFireWeaponDelay -= TimeDelta;
 
         // находим кол-во оружия в группах
         for (unsigned i = 0; i < sharedPlayerFighter->WeaponSlots.size(); i++) {
@@ -1015,7 +1006,7 @@ void GamePlayerShip()
     // учитывать, как работает двигатель... стоим или летим...
     // если не аркадный режим...
     if (GameSpaceShipControlMode != 1) {
-        if (CurrentPlayerShipEnergy < GetShipEngineSystemEnergyUse(GameEngineSystem)*sharedPlayerFighter->TimeDelta) {
+        if (CurrentPlayerShipEnergy < GetShipEngineSystemEnergyUse(GameEngineSystem)*TimeDelta) {
             sharedPlayerFighter->MaxSpeed = 0.0f;
             sharedPlayerFighter->MaxAcceler = 0.0f;
             sharedPlayerFighter->MaxSpeedRotate = 0.0f;
@@ -1063,7 +1054,7 @@ void GamePlayerShip()
                     }
                 }
             }
-            CurrentPlayerShipEnergy -= GetShipEngineSystemEnergyUse(GameEngineSystem)*sharedPlayerFighter->TimeDelta;
+            CurrentPlayerShipEnergy -= GetShipEngineSystemEnergyUse(GameEngineSystem)*TimeDelta;
         }
     }
 
@@ -1081,7 +1072,7 @@ void GamePlayerShip()
                     // если энергии не достаточно для зарядки орудия
                     if (CurrentPlayerShipEnergy < sharedWeapon->EnergyUse) {
                         // останавливаем перезарядку оружия
-                        sharedWeapon->LastFireTime += sharedPlayerFighter->TimeDelta;
+                        sharedWeapon->LastFireTime += TimeDelta;
                         if (auto sharedFire = sharedWeapon->Fire.lock()) {
                             sharedFire->IsSuppressed = true;
                         }
@@ -1099,15 +1090,15 @@ void GamePlayerShip()
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     // питание других (защитных) систем
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    if (CurrentPlayerShipEnergy >= GetShipEngineSystemEnergyUse(GameEngineSystem)*sharedPlayerFighter->TimeDelta) {
+    if (CurrentPlayerShipEnergy >= GetShipEngineSystemEnergyUse(GameEngineSystem)*TimeDelta) {
 
         switch (GameAdvancedProtectionSystem) {
         // нано роботы
         case 1:
             // восстанавливаем на 0.5% в секунду
             if (sharedPlayerFighter->ArmorCurrentStatus < sharedPlayerFighter->ArmorInitialStatus) {
-                CurrentPlayerShipEnergy -= GetShipProtectionSystemEnergyUse(GameAdvancedProtectionSystem) * sharedPlayerFighter->TimeDelta;
-                sharedPlayerFighter->ArmorCurrentStatus += (sharedPlayerFighter->ArmorInitialStatus / 200.0f) * sharedPlayerFighter->TimeDelta;
+                CurrentPlayerShipEnergy -= GetShipProtectionSystemEnergyUse(GameAdvancedProtectionSystem) * TimeDelta;
+                sharedPlayerFighter->ArmorCurrentStatus += (sharedPlayerFighter->ArmorInitialStatus / 200.0f) * TimeDelta;
                 if (sharedPlayerFighter->ArmorCurrentStatus > sharedPlayerFighter->ArmorInitialStatus) {
                     sharedPlayerFighter->ArmorCurrentStatus = sharedPlayerFighter->ArmorInitialStatus;
                 }
@@ -1120,8 +1111,8 @@ void GamePlayerShip()
         case 3:
             // восстанавливаем полностью за 4 секунды
             if (ShildEnergyStatus < 1.0f) {
-                CurrentPlayerShipEnergy -= GetShipProtectionSystemEnergyUse(GameAdvancedProtectionSystem) * sharedPlayerFighter->TimeDelta;
-                ShildEnergyStatus += 0.02f * sharedPlayerFighter->TimeDelta;
+                CurrentPlayerShipEnergy -= GetShipProtectionSystemEnergyUse(GameAdvancedProtectionSystem) * TimeDelta;
+                ShildEnergyStatus += 0.02f * TimeDelta;
                 if (ShildEnergyStatus > 1.0f) {
                     ShildEnergyStatus = 1.0f;
                 }
@@ -1131,8 +1122,8 @@ void GamePlayerShip()
         case 4:
             // восстанавливаем полностью за 2 секунды
             if (ShildEnergyStatus < 1.0f) {
-                CurrentPlayerShipEnergy -= GetShipProtectionSystemEnergyUse(GameAdvancedProtectionSystem) * sharedPlayerFighter->TimeDelta;
-                ShildEnergyStatus += 0.03f * sharedPlayerFighter->TimeDelta;
+                CurrentPlayerShipEnergy -= GetShipProtectionSystemEnergyUse(GameAdvancedProtectionSystem) * TimeDelta;
+                ShildEnergyStatus += 0.03f * TimeDelta;
                 if (ShildEnergyStatus > 1.0f) {
                     ShildEnergyStatus = 1.0f;
                 }
@@ -1162,7 +1153,7 @@ void GamePlayerShip()
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     // если реактор - можем генерировать энергию, если баттарея - нет
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    CurrentPlayerShipEnergy += GetShipRechargeEnergy(GamePowerSystem)*sharedPlayerFighter->TimeDelta;
+    CurrentPlayerShipEnergy += GetShipRechargeEnergy(GamePowerSystem)*TimeDelta;
     if (CurrentPlayerShipEnergy > GetShipMaxEnergy(GamePowerSystem)) {
         CurrentPlayerShipEnergy = GetShipMaxEnergy(GamePowerSystem);
     }
@@ -0,0 +1,235 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+/*
+Headless mode, in order to benchmark simulation on machines without GPU.
+
+Only simulation part of the game's frame is stepped (camera movement, objects update,
+particle systems update, collision detection and mission script), with fixed time step.
+No window, OpenGL context and audio are created. Since there are no player's input,
+mission runs without player's ship. Default configuration is used (config file is not
+loaded or saved), so, results could be compared between different machines.
+*/
+
+#include "../core/core.h"
+#include "../config/config.h"
+#include "../assets/model3d.h"
+#include "../assets/texture.h"
+#include "../gfx/star_system.h"
+#include "../script/script.h"
+#include "../object3d/object3d.h"
+#include "../game/camera.h"
+#include "../enum.h"
+#include "../game.h" // FIXME "game.h" should be replaced by individual headers
+#include "headless.h"
+#include <chrono> // need this one for std::chrono only
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+namespace {
+
+enum class eHeadlessStage {
+    Script,
+    Objects,
+    ParticleSystems,
+    Collision,
+    Count
+};
+
+struct sStageTiming {
+    const char *Name;
+    double Total{0.0};
+    double Max{0.0};
+
+    explicit sStageTiming(const char *_Name) :
+        Name{_Name}
+    {}
+};
+
+} // unnamed namespace
+
+
+/*
+ * Duration in milliseconds.
+ */
+static inline double DurationMs(const std::chrono::steady_clock::time_point &Start,
+                                const std::chrono::steady_clock::time_point &End)
+{
+    return std::chrono::duration<double, std::milli>(End - Start).count();
+}
+
+/*
+ * Prepare game data, that mission script need.
+ */
+static void InitHeadlessMission()
+{
+    // no OpenGL context, textures could not be loaded, models will be loaded without hardware buffers
+    DisableTextureAssets();
+    ChangeGameConfig().UseGLSL120 = false;
+    ForEachModel3DAssetLoad([] (unsigned) {});
+
+    // VisualEffectsQuality is inverted (0 - all effects, 2 - minimum effects)
+    vw_InitParticleSystems(false, GameConfig().VisualEffectsQuality + 1.0f);
+
+    // stopwatch and star system use time threads directly
+    vw_InitTimeThread(0);
+    vw_InitTimeThread(1);
+
+    ResetCamera();
+    vw_SetCameraLocation(sVECTOR3D{0.0f, 65.0f, -100.0f + 10.0f});
+    vw_SetCameraMoveAroundPoint(sVECTOR3D{0.0f, 0.0f, 10.0f}, 0.0f, sVECTOR3D{0.0f, 0.0f, 0.0f});
+
+    StarSystemInitByType(eDrawType::GAME); // should be before RunScript()
+}
+
+/*
+ * Release all game data.
+ */
+static void ReleaseHeadlessMission()
+{
+    ReleaseAllObject3D();
+    vw_ReleaseAllParticleSystems();
+    vw_ReleaseAllLights();
+    StarSystemRelease();
+    vw_ReleaseAllModel3D();
+    vw_ReleaseAllTimeThread();
+}
+
+/*
+ * Run mission simulation at fixed rate without window, OpenGL and audio, report timing.
+ * Note, VFS should be opened before this call.
+ */
+int RunHeadlessMission(int MissionNumber, float SimulationTime, unsigned TickRate)
+{
+    if (!TickRate || TickRate > MaxHeadlessTickRate
+        || !std::isfinite(SimulationTime) || SimulationTime <= 0.0f
+        // ticks count should fit unsigned
+        || static_cast<double>(SimulationTime) * TickRate >= static_cast<double>(std::numeric_limits<unsigned>::max())) {
+        std::cerr << __func__ << "(): " << "wrong tick rate or simulation time.\n";
+        return 1;
+    }
+
+    MissionListInit();
+    CurrentMission = MissionNumber - 1;
+    std::string MissionFileName{GetCurrentMissionFileName()};
+    if (MissionFileName.empty()) {
+        std::cerr << __func__ << "(): " << "mission not found: " << MissionNumber << "\n";
+        return 1;
+    }
+
+    InitHeadlessMission();
+
+    std::unique_ptr<cMissionScript> MissionScript{new cMissionScript};
+    if (!MissionScript->RunScript(MissionFileName, 0.0f)) {
+        std::cerr << __func__ << "(): " << "can't run mission script: " << MissionFileName << "\n";
+        ReleaseHeadlessMission();
+        return 1;
+    }
+
+    std::array<sStageTiming, static_cast<size_t>(eHeadlessStage::Count)> StageTiming{{
+            sStageTiming{"script"},
+            sStageTiming{"objects"},
+            sStageTiming{"particles"},
+            sStageTiming{"collision"}
+        }};
+    auto AddStageTiming = [&StageTiming] (eHeadlessStage Stage, double Duration) {
+        sStageTiming &Timing = StageTiming[static_cast<size_t>(Stage)];
+        Timing.Total += Duration;
+        if (Timing.Max < Duration) {
+            Timing.Max = Duration;
+        }
+    };
+
+    unsigned TicksCount = static_cast<unsigned>(SimulationTime * static_cast<float>(TickRate));
+    float TimeStep = 1.0f / static_cast<float>(TickRate);
+    float ScriptEndTime{-1.0f};
+    double MaxTickDuration{0.0};
+
+    std::cout << "\nHeadless mission " << MissionNumber << " (" << MissionFileName << "), "
+              << TicksCount << " ticks at " << TickRate << " ticks per second.\n";
+
+    ResetCollisionLayersStatistic();
+    ResetObject3DIndexStatistic();
+    auto SimulationStart = std::chrono::steady_clock::now();
+    for (unsigned i = 1; i <= TicksCount; i++) {
+        // note, we use tick number for time calculation, in order to avoid float error accumulation
+        float Time = static_cast<float>(i) * TimeStep;
+
+        // same order as DrawGame() have
+        auto StageStart = std::chrono::steady_clock::now();
+        CameraUpdate(Time);
+        auto ObjectsStart = std::chrono::steady_clock::now();
+        UpdateAllObject3D(Time);
+        auto ParticleSystemsStart = std::chrono::steady_clock::now();
+        vw_UpdateAllParticleSystems(Time);
+        auto CollisionStart = std::chrono::steady_clock::now();
+        DetectCollisionAllObject3D();
+        auto ScriptStart = std::chrono::steady_clock::now();
+        if (MissionScript && !MissionScript->Update(Time)) {
+            MissionScript.reset();
+            ScriptEndTime = Time;
+        }
+        auto StageEnd = std::chrono::steady_clock::now();
+
+        AddStageTiming(eHeadlessStage::Script, DurationMs(StageStart, ObjectsStart) + DurationMs(ScriptStart, StageEnd));
+        AddStageTiming(eHeadlessStage::Objects, DurationMs(ObjectsStart, ParticleSystemsStart));
+        AddStageTiming(eHeadlessStage::ParticleSystems, DurationMs(ParticleSystemsStart, CollisionStart));
+        AddStageTiming(eHeadlessStage::Collision, DurationMs(CollisionStart, ScriptStart));
+        MaxTickDuration = std::max(MaxTickDuration, DurationMs(StageStart, StageEnd));
+    }
+    double SimulationDuration = DurationMs(SimulationStart, std::chrono::steady_clock::now());
+
+    std::cout << "Simulated " << static_cast<float>(TicksCount) * TimeStep << " s in "
+              << SimulationDuration / 1000.0 << " s (" << (SimulationDuration > 0.0 ?
+                      static_cast<double>(TicksCount) * 1000.0 / SimulationDuration : 0.0)
+              << " ticks per second).\n";
+    if (ScriptEndTime >= 0.0f) {
+        std::cout << "Mission script finished at " << ScriptEndTime << " s.\n";
+    }
+    std::cout << "Tick: avg " << (TicksCount ? SimulationDuration / TicksCount : 0.0)
+              << " ms, max " << MaxTickDuration << " ms.\n";
+    for (auto &tmpTiming : StageTiming) {
+        std::cout << "  " << tmpTiming.Name << ": avg " << (TicksCount ? tmpTiming.Total / TicksCount : 0.0)
+                  << " ms, max " << tmpTiming.Max << " ms, total " << tmpTiming.Total << " ms\n";
+    }
+    const sCollisionLayersStatistic &CollisionStatistic = GetCollisionLayersStatistic();
+    std::cout << "Projectile pairs: checked " << CollisionStatistic.CheckedProjectilePairs
+              << ", rejected by collision layers " << CollisionStatistic.RejectedProjectilePairs << "\n";
+    const sUniformGridStatistic &IndexStatistic = GetObject3DIndexStatistic();
+    std::cout << "Objects index queries: " << IndexStatistic.Queries
+              << ", coarse level " << IndexStatistic.CoarseQueries
+              << ", linear scan " << IndexStatistic.LinearQueries << "\n";
+
+    MissionScript.reset();
+    ReleaseHeadlessMission();
+    return 0;
+}
+
+} // astromenace namespace
+} // viewizard namespace
@@ -0,0 +1,47 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+#ifndef GAME_HEADLESS_H
+#define GAME_HEADLESS_H
+
+#include "../core/base.h"
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+// Maximum simulation ticks per second for headless mode.
+constexpr unsigned MaxHeadlessTickRate{10000};
+
+// Run mission simulation at fixed rate without window, OpenGL and audio, report timing.
+// Note, VFS should be opened before this call.
+int RunHeadlessMission(int MissionNumber, float SimulationTime, unsigned TickRate);
+
+} // astromenace namespace
+} // viewizard namespace
+
+#endif // GAME_HEADLESS_H
@@ -43,6 +43,7 @@ In order to show movement and more 'live' space, star system render "space dust"
 #include "../object3d/space_object/space_object.h"
 #include "skybox.h"
 #include "../game/camera.h"
+#include "../ui/profiler.h"
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
@@ -263,6 +264,8 @@ static inline void AddToVertexArray(float CoordX, float CoordY, float CoordZ,
  */
 void StarSystemDraw(eDrawType DrawType)
 {
+    PROFILER_ZONE("StarSystemDraw");
+
     if (!StarSystem_InitedAll) {
         return;
     }
@@ -32,6 +32,7 @@
 #include "platform/platform.h"
 #include "ui/cursor.h"
 #include "ui/fps_counter.h"
+#include "ui/profiler.h"
 #include "ui/game_speed.h"
 #include "gfx/star_system.h"
 #include "game/weapon_panel.h"
@@ -78,9 +79,13 @@ void Loop_Proc()
     DrawDialogBox();
     CursorDraw();
     cFPS::GetInstance().Draw();
+    cProfiler::GetInstance().Draw();
 
     vw_End2DMode();
-    vw_EndRendering();
+    {
+        PROFILER_ZONE("EndRendering");
+        vw_EndRendering();
+    }
 
     if (vw_GetKeyStatus(SDLK_ESCAPE)) {
         SetCurrentDialogBox(eDialogBox::QuitFromGame);
@@ -90,6 +95,7 @@ void Loop_Proc()
     cCommand::GetInstance().Proceed();
     cGameSpeed::GetInstance().Update();
     cFPS::GetInstance().Update();
+    cProfiler::GetInstance().Update();
 
     // после обхода всех активных элементов меню, надо подкорректировать состояние выбора через клавиатуру (если оно было)
     if (vw_GetKeyStatus(SDLK_TAB)) {
@@ -41,7 +41,9 @@
 #include "object3d/object3d.h"
 #include "utils/fs2vfs.h"
 #include "assets/loading.h"
+#include "game/headless.h"
 #include "game.h" // FIXME "game.h" should be replaced by individual headers
+#include <limits> // need this one for std::numeric_limits only
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
@@ -357,6 +359,25 @@ static void Loop()
     }
 }
 
+/*
+ * Print all game launch options.
+ */
+static void PrintLaunchOptions()
+{
+    std::cout << "AstroMenace launch options:\n\n"
+              << "--dir=/folder - folder with gamedata.vfs file;\n"
+              << "--rawdata=/folder - folder with raw data for gamedata.vfs;\n"
+              << "--pack - pack data to gamedata.vfs file;\n"
+              << "--mouse - launch the game without system cursor hiding;\n"
+              << "--reset-config - reset all settings except Pilot Profiles;\n"
+              << "--headless - run mission simulation without window, OpenGL and audio, report timing;\n"
+              << "--mission=N - mission number for headless mode (1 by default);\n"
+              << "--sim-time=S - simulation time in seconds for headless mode (60 by default);\n"
+              << "--tick-rate=R - simulation ticks per second for headless mode, from 1 to "
+              << MaxHeadlessTickRate << " (60 by default);\n"
+              << "--help - info about all game launch options.\n";
+}
+
 } // astromenace namespace
 } // viewizard namespace
 
@@ -371,17 +392,15 @@ int main(int argc, char *argv[])
     bool NeedShowSystemCursor{false};
     bool NeedResetConfig{false};
     bool NeedPack{false};
+    bool NeedHeadless{false};
+    int HeadlessMission{1};
+    float HeadlessSimulationTime{60.0f};
+    unsigned HeadlessTickRate{60};
 
     // don't use getopt_long() here, since it could be not available (MSVC)
     for (int i = 1; i < argc; i++) {
         if (!strcmp(argv[i], "--help")) {
-            std::cout << "AstroMenace launch options:\n\n"
-                      << "--dir=/folder - folder with gamedata.vfs file;\n"
-                      << "--rawdata=/folder - folder with raw data for gamedata.vfs;\n"
-                      << "--pack - pack data to gamedata.vfs file;\n"
-                      << "--mouse - launch the game without system cursor hiding;\n"
-                      << "--reset-config - reset all settings except Pilot Profiles;\n"
-                      << "--help - info about all game launch options.\n";
+            PrintLaunchOptions();
             return 0;
         }
 
@@ -407,6 +426,53 @@ int main(int argc, char *argv[])
 
         if (!strcmp(argv[i], "--reset-config")) {
             NeedResetConfig = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--headless")) {
+            NeedHeadless = true;
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--mission=", strlen("--mission="))) {
+            const char *Value = argv[i] + strlen("--mission=");
+            char *ValueEnd{nullptr};
+            long Mission = strtol(Value, &ValueEnd, 10);
+            if (ValueEnd == Value || *ValueEnd != '\0'
+                || Mission < 1 || Mission > std::numeric_limits<int>::max()) {
+                std::cerr << __func__ << "(): " << "wrong mission: " << Value << "\n\n";
+                PrintLaunchOptions();
+                return 1;
+            }
+            HeadlessMission = static_cast<int>(Mission);
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--sim-time=", strlen("--sim-time="))) {
+            const char *Value = argv[i] + strlen("--sim-time=");
+            char *ValueEnd{nullptr};
+            float SimulationTime = strtof(Value, &ValueEnd);
+            if (ValueEnd == Value || *ValueEnd != '\0'
+                || !std::isfinite(SimulationTime) || SimulationTime <= 0.0f) {
+                std::cerr << __func__ << "(): " << "wrong simulation time: " << Value << "\n\n";
+                PrintLaunchOptions();
+                return 1;
+            }
+            HeadlessSimulationTime = SimulationTime;
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--tick-rate=", strlen("--tick-rate="))) {
+            const char *Value = argv[i] + strlen("--tick-rate=");
+            char *ValueEnd{nullptr};
+            long TickRate = strtol(Value, &ValueEnd, 10);
+            if (ValueEnd == Value || *ValueEnd != '\0'
+                || TickRate <= 0 || TickRate > static_cast<long>(MaxHeadlessTickRate)) {
+                std::cerr << __func__ << "(): " << "wrong tick rate: " << Value << "\n\n";
+                PrintLaunchOptions();
+                return 1;
+            }
+            HeadlessTickRate = static_cast<unsigned>(TickRate);
         }
     }
 
@@ -417,6 +483,19 @@ int main(int argc, char *argv[])
         return ConvertFS2VFS(GetRawDataPath(), GetDataPath() + "gamedata.vfs");
     }
 
+    // headless mode don't need libSDL subsystems (window, OpenGL, audio, input)
+    if (NeedHeadless) {
+        if (vw_OpenVFS(GetDataPath() + "gamedata.vfs", GAME_VFS_BUILD) != 0) {
+            std::cerr << __func__ << "(): " << "gamedata.vfs file not found or corrupted.\n";
+            return 1;
+        }
+        vw_InitJobSystem();
+        int Result = RunHeadlessMission(HeadlessMission, HeadlessSimulationTime, HeadlessTickRate);
+        vw_ReleaseJobSystem();
+        vw_ShutdownVFS();
+        return Result;
+    }
+
     // subsystems, that should be initialized before any interactions
     // for predictable work on all platforms
     Uint32 SDL_Init_Flags = SDL_INIT_TIMER |
@@ -453,6 +532,7 @@ int main(int argc, char *argv[])
     InitFont(GetFontMetadata(GameConfig().FontNumber).FontFileName); // should be called after LoadXMLConfigFile()
 
     vw_InitTimeThread(0);
+    vw_InitJobSystem();
 
     // should be called after vw_InitTimeThread(0)
     JoystickInit(vw_GetTimeThread(0));
@@ -484,6 +564,7 @@ RecreateWindow:
         vw_ShutdownAudio();
         vw_ShutdownVFS();
         JoystickClose();
+        vw_ReleaseJobSystem();
         vw_ReleaseAllTimeThread();
         SDL_Quit();
         return 1;
@@ -550,6 +631,7 @@ RecreateWindow:
     vw_ShutdownAudio();
     vw_ShutdownVFS();
     JoystickClose();
+    vw_ReleaseJobSystem();
     vw_ReleaseAllTimeThread();
     SDL_Quit();
     return 0;
@@ -34,6 +34,7 @@
 #include "../config/config.h"
 #include "../ui/font.h"
 #include "../ui/cursor.h"
+#include "../ui/profiler.h"
 #include "../assets/audio.h"
 #include "../assets/texture.h"
 #include "../script/script.h"
@@ -402,6 +403,7 @@ void SetMenu2(eMenuStatus Menu)
 //------------------------------------------------------------------------------------
 void DrawMenu()
 {
+    PROFILER_ZONE("DrawMenu");
 
     // делаем плавное появление меню
     if (NeedShowMenu) {
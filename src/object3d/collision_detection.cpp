@@ -31,11 +31,265 @@
 // TODO change from cObject3D to sModel3D
 
 #include "object3d.h"
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif // __SSE__
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
 namespace astromenace {
 
+namespace {
+
+// Boxes separating axis test data, that is constant for all chunks of objects pair
+// (second box rotation matrix in first box space, see BoxesSeparated()).
+#ifdef __SSE__
+struct sBoxPairAxes {
+    __m128 Column[3];      // second box axes (X, Y, Z) components
+    __m128 AbsColumn[3];
+    __m128 AbsRow[3];
+    __m128 AbsCrossP[3];   // shuffled absolute values for cross product axes tests
+    __m128 AbsCrossQ[3];
+};
+#else
+struct sBoxPairAxes {
+    sVECTOR3D XAxis{};
+    sVECTOR3D YAxis{};
+    sVECTOR3D ZAxis{};
+};
+#endif // __SSE__
+
+} // unnamed namespace
+
+
+#ifdef __SSE__
+/*
+ * Initialize boxes separating axis test data by second box rotation matrix in first box space.
+ */
+static void InitBoxPairAxes(sBoxPairAxes &Axes, const float (&matB)[9])
+{
+    float Abs[9];
+    for (unsigned i = 0; i < 9; i++) {
+        Abs[i] = fabsf(matB[i]);
+    }
+
+    for (unsigned i = 0; i < 3; i++) {
+        Axes.Column[i] = _mm_setr_ps(matB[i], matB[i + 3], matB[i + 6], 0.0f);
+        Axes.AbsColumn[i] = _mm_setr_ps(Abs[i], Abs[i + 3], Abs[i + 6], 0.0f);
+        Axes.AbsRow[i] = _mm_setr_ps(Abs[i * 3], Abs[i * 3 + 1], Abs[i * 3 + 2], 0.0f);
+        Axes.AbsCrossP[i] = _mm_setr_ps(Abs[i + 6], Abs[i + 6], Abs[i + 3], 0.0f);
+        Axes.AbsCrossQ[i] = _mm_setr_ps(Abs[i + 3], Abs[i], Abs[i], 0.0f);
+    }
+}
+
+/*
+ * Check for separating axis between two boxes (15 axes), all tests are performed
+ * at once, 3 axes per SSE register (last component is not used).
+ * Pos - second box center in first box space, HalfA and HalfB - boxes half sizes.
+ */
+static bool BoxesSeparated(const sBoxPairAxes &Axes, const sVECTOR3D &Pos,
+                           const sVECTOR3D &HalfA, const sVECTOR3D &HalfB)
+{
+    const __m128 SignMask = _mm_set1_ps(-0.0f);
+    const __m128 T = _mm_setr_ps(Pos.x, Pos.y, Pos.z, 0.0f);
+    const __m128 A = _mm_setr_ps(HalfA.x, HalfA.y, HalfA.z, 0.0f);
+    const __m128 B = _mm_setr_ps(HalfB.x, HalfB.y, HalfB.z, 0.0f);
+
+    const __m128 Tx = _mm_set1_ps(Pos.x);
+    const __m128 Ty = _mm_set1_ps(Pos.y);
+    const __m128 Tz = _mm_set1_ps(Pos.z);
+    const __m128 Ax = _mm_set1_ps(HalfA.x);
+    const __m128 Ay = _mm_set1_ps(HalfA.y);
+    const __m128 Az = _mm_set1_ps(HalfA.z);
+    // (B.y, B.x, B.x) and (B.z, B.z, B.y) for cross product axes tests
+    const __m128 Byxx = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 0, 1));
+    const __m128 Bzzy = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 1, 2, 2));
+
+    // 1-3 (Ra)x, (Ra)y, (Ra)z
+    __m128 L = _mm_andnot_ps(SignMask, T);
+    __m128 R = _mm_add_ps(_mm_add_ps(_mm_add_ps(A, _mm_mul_ps(_mm_set1_ps(HalfB.x), Axes.AbsRow[0])),
+                                     _mm_mul_ps(_mm_set1_ps(HalfB.y), Axes.AbsRow[1])),
+                          _mm_mul_ps(_mm_set1_ps(HalfB.z), Axes.AbsRow[2]));
+    __m128 Separated = _mm_cmpgt_ps(L, R);
+
+    // 4-6 (Rb)x, (Rb)y, (Rb)z
+    L = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Tx, Axes.Column[0]), _mm_mul_ps(Ty, Axes.Column[1])),
+                   _mm_mul_ps(Tz, Axes.Column[2]));
+    L = _mm_andnot_ps(SignMask, L);
+    R = _mm_add_ps(_mm_add_ps(_mm_add_ps(B, _mm_mul_ps(Ax, Axes.AbsColumn[0])),
+                              _mm_mul_ps(Ay, Axes.AbsColumn[1])),
+                   _mm_mul_ps(Az, Axes.AbsColumn[2]));
+    Separated = _mm_or_ps(Separated, _mm_cmpgt_ps(L, R));
+
+    // 7-9 (Ra)x X (Rb)x, (Ra)x X (Rb)y, (Ra)x X (Rb)z
+    L = _mm_andnot_ps(SignMask, _mm_sub_ps(_mm_mul_ps(Tz, Axes.Column[1]), _mm_mul_ps(Ty, Axes.Column[2])));
+    R = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Ay, Axes.AbsColumn[2]), _mm_mul_ps(Az, Axes.AbsColumn[1])),
+                              _mm_mul_ps(Byxx, Axes.AbsCrossP[0])),
+                   _mm_mul_ps(Bzzy, Axes.AbsCrossQ[0]));
+    Separated = _mm_or_ps(Separated, _mm_cmpgt_ps(L, R));
+
+    // 10-12 (Ra)y X (Rb)x, (Ra)y X (Rb)y, (Ra)y X (Rb)z
+    L = _mm_andnot_ps(SignMask, _mm_sub_ps(_mm_mul_ps(Tx, Axes.Column[2]), _mm_mul_ps(Tz, Axes.Column[0])));
+    R = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Ax, Axes.AbsColumn[2]), _mm_mul_ps(Az, Axes.AbsColumn[0])),
+                              _mm_mul_ps(Byxx, Axes.AbsCrossP[1])),
+                   _mm_mul_ps(Bzzy, Axes.AbsCrossQ[1]));
+    Separated = _mm_or_ps(Separated, _mm_cmpgt_ps(L, R));
+
+    // 13-15 (Ra)z X (Rb)x, (Ra)z X (Rb)y, (Ra)z X (Rb)z
+    L = _mm_andnot_ps(SignMask, _mm_sub_ps(_mm_mul_ps(Ty, Axes.Column[0]), _mm_mul_ps(Tx, Axes.Column[1])));
+    R = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Ax, Axes.AbsColumn[1]), _mm_mul_ps(Ay, Axes.AbsColumn[0])),
+                              _mm_mul_ps(Byxx, Axes.AbsCrossP[2])),
+                   _mm_mul_ps(Bzzy, Axes.AbsCrossQ[2]));
+    Separated = _mm_or_ps(Separated, _mm_cmpgt_ps(L, R));
+
+    return _mm_movemask_ps(Separated) != 0;
+}
+#else
+/*
+ * Initialize boxes separating axis test data by second box rotation matrix in first box space.
+ */
+static void InitBoxPairAxes(sBoxPairAxes &Axes, const float (&matB)[9])
+{
+    Axes.XAxis = sVECTOR3D{matB[0], matB[3], matB[6]};
+    Axes.YAxis = sVECTOR3D{matB[1], matB[4], matB[7]};
+    Axes.ZAxis = sVECTOR3D{matB[2], matB[5], matB[8]};
+}
+
+/*
+ * Check for separating axis between two boxes (15 axes).
+ * Pos - second box center in first box space, HalfA and HalfB - boxes half sizes.
+ */
+static bool BoxesSeparated(const sBoxPairAxes &Axes, const sVECTOR3D &Pos,
+                           const sVECTOR3D &HalfA, const sVECTOR3D &HalfB)
+{
+    const sVECTOR3D &XAxis = Axes.XAxis;
+    const sVECTOR3D &YAxis = Axes.YAxis;
+    const sVECTOR3D &ZAxis = Axes.ZAxis;
+
+    //1 (Ra)x
+    if (fabsf(Pos.x) > (HalfA.x + HalfB.x * fabsf(XAxis.x) +
+                        HalfB.y * fabsf(XAxis.y) +
+                        HalfB.z * fabsf(XAxis.z))) {
+        return true;
+    }
+
+    //2 (Ra)y
+    if (fabsf(Pos.y) > (HalfA.y + HalfB.x * fabsf(YAxis.x) +
+                        HalfB.y * fabsf(YAxis.y) +
+                        HalfB.z * fabsf(YAxis.z))) {
+        return true;
+    }
+
+    //3 (Ra)z
+    if (fabsf(Pos.z) > (HalfA.z + HalfB.x * fabsf(ZAxis.x) +
+                        HalfB.y * fabsf(ZAxis.y) +
+                        HalfB.z * fabsf(ZAxis.z))) {
+        return true;
+    }
+
+    //4 (Rb)x
+    if (fabsf(Pos.x * XAxis.x +
+              Pos.y * YAxis.x +
+              Pos.z * ZAxis.x) > (HalfB.x + HalfA.x * fabsf(XAxis.x) +
+                                  HalfA.y * fabsf(YAxis.x) +
+                                  HalfA.z * fabsf(ZAxis.x))) {
+        return true;
+    }
+
+    //5 (Rb)y
+    if (fabsf(Pos.x * XAxis.y +
+              Pos.y * YAxis.y +
+              Pos.z * ZAxis.y) > (HalfB.y + HalfA.x * fabsf(XAxis.y) +
+                                  HalfA.y * fabsf(YAxis.y) +
+                                  HalfA.z * fabsf(ZAxis.y))) {
+        return true;
+    }
+
+    //6 (Rb)z
+    if (fabsf(Pos.x * XAxis.z +
+              Pos.y * YAxis.z +
+              Pos.z * ZAxis.z) > (HalfB.z + HalfA.x * fabsf(XAxis.z) +
+                                  HalfA.y * fabsf(YAxis.z) +
+                                  HalfA.z * fabsf(ZAxis.z))) {
+        return true;
+    }
+
+    //7 (Ra)x X (Rb)x
+    if (fabsf(Pos.z * YAxis.x - Pos.y * ZAxis.x) > (HalfA.y * fabsf(ZAxis.x) +
+                                                    HalfA.z * fabsf(YAxis.x) +
+                                                    HalfB.y * fabsf(XAxis.z) +
+                                                    HalfB.z * fabsf(XAxis.y))) {
+        return true;
+    }
+
+    //8 (Ra)x X (Rb)y
+    if (fabsf(Pos.z * YAxis.y - Pos.y * ZAxis.y) > (HalfA.y * fabsf(ZAxis.y) +
+                                                    HalfA.z * fabsf(YAxis.y) +
+                                                    HalfB.x * fabsf(XAxis.z) +
+                                                    HalfB.z * fabsf(XAxis.x))) {
+        return true;
+    }
+
+    //9 (Ra)x X (Rb)z
+    if (fabsf(Pos.z * YAxis.z - Pos.y * ZAxis.z) > (HalfA.y * fabsf(ZAxis.z) +
+                                                    HalfA.z * fabsf(YAxis.z) +
+                                                    HalfB.x * fabsf(XAxis.y) +
+                                                    HalfB.y * fabsf(XAxis.x))) {
+        return true;
+    }
+
+    //10 (Ra)y X (Rb)x
+    if (fabsf(Pos.x * ZAxis.x - Pos.z * XAxis.x) > (HalfA.x * fabsf(ZAxis.x) +
+                                                    HalfA.z * fabsf(XAxis.x) +
+                                                    HalfB.y * fabsf(YAxis.z) +
+                                                    HalfB.z * fabsf(YAxis.y))) {
+        return true;
+    }
+
+    //11 (Ra)y X (Rb)y
+    if (fabsf(Pos.x * ZAxis.y - Pos.z * XAxis.y) > (HalfA.x * fabsf(ZAxis.y) +
+                                                    HalfA.z * fabsf(XAxis.y) +
+                                                    HalfB.x * fabsf(YAxis.z) +
+                                                    HalfB.z * fabsf(YAxis.x))) {
+        return true;
+    }
+
+    //12 (Ra)y X (Rb)z
+    if (fabsf(Pos.x * ZAxis.z - Pos.z * XAxis.z) > (HalfA.x * fabsf(ZAxis.z) +
+                                                    HalfA.z * fabsf(XAxis.z) +
+                                                    HalfB.x * fabsf(YAxis.y) +
+                                                    HalfB.y * fabsf(YAxis.x))) {
+        return true;
+    }
+
+    //13 (Ra)z X (Rb)x
+    if (fabsf(Pos.y * XAxis.x - Pos.x * YAxis.x) > (HalfA.x * fabsf(YAxis.x) +
+                                                    HalfA.y * fabsf(XAxis.x) +
+                                                    HalfB.y * fabsf(ZAxis.z) +
+                                                    HalfB.z * fabsf(ZAxis.y))) {
+        return true;
+    }
+
+    //14 (Ra)z X (Rb)y
+    if (fabsf(Pos.y * XAxis.y - Pos.x * YAxis.y) > (HalfA.x * fabsf(YAxis.y) +
+                                                    HalfA.y * fabsf(XAxis.y) +
+                                                    HalfB.x * fabsf(ZAxis.z) +
+                                                    HalfB.z * fabsf(ZAxis.x))) {
+        return true;
+    }
+
+    //15 (Ra)z X (Rb)z
+    if (fabsf(Pos.y * XAxis.z - Pos.x * YAxis.z) > (HalfA.x * fabsf(YAxis.z) +
+                                                    HalfA.y * fabsf(XAxis.z) +
+                                                    HalfB.x * fabsf(ZAxis.y) +
+                                                    HalfB.y * fabsf(ZAxis.x))) {
+        return true;
+    }
+
+    return false;
+}
+#endif // __SSE__
+
 /*
  * Mesh-Sphere collision detection.
  */
@@ -91,7 +345,8 @@ bool CheckMeshSphereCollisionDetection(const cObject3D &Object1, const cObject3D
             }
         }
 
-        if (vw_SphereMeshCollision(Object1.Location, Object1.Chunks[j],
+        if (vw_SphereMeshCollision(Object1.Location, Object1.Model3D->Chunks[j],
+                                   Object1.Chunks[j].Location, Object1.Chunks[j].Rotation,
                                    Object1.CurrentRotationMat, Object2.Radius, Object2.Location,
                                    Object2.PrevLocation, NewLoc)) {
             Object1PieceNum = j;
@@ -105,168 +360,31 @@ bool CheckMeshSphereCollisionDetection(const cObject3D &Object1, const cObject3D
 /*
  * HitBB-HitBB collision detection.
  */
-bool CheckHitBBHitBBCollisionDetection(const cObject3D &Object1, const cObject3D &Object2,
+bool CheckHitBBHitBBCollisionDetection(cObject3D &Object1, cObject3D &Object2,
                                        int &Object1PieceNum, int &Object2PieceNum)
 {
-    for (unsigned int i = 0; i < Object1.Chunks.size(); i++) {
-        for (unsigned int j = 0; j < Object2.Chunks.size(); j++) {
-            float Distance2 = (Object1.Location.x + Object1.HitBB[i].Location.x -
-                               Object2.Location.x - Object2.HitBB[j].Location.x) *
-                              (Object1.Location.x + Object1.HitBB[i].Location.x -
-                               Object2.Location.x - Object2.HitBB[j].Location.x) +
-                              (Object1.Location.y + Object1.HitBB[i].Location.y -
-                               Object2.Location.y - Object2.HitBB[j].Location.y) *
-                              (Object1.Location.y + Object1.HitBB[i].Location.y -
-                               Object2.Location.y - Object2.HitBB[j].Location.y) +
-                              (Object1.Location.z + Object1.HitBB[i].Location.z -
-                               Object2.Location.z - Object2.HitBB[j].Location.z) *
-                              (Object1.Location.z + Object1.HitBB[i].Location.z -
-                               Object2.Location.z - Object2.HitBB[j].Location.z);
-
+    Object1.UpdateCollisionCache();
+    Object2.UpdateCollisionCache();
+    const sCollisionCache &Cache1 = Object1.CollisionCache;
+    const sCollisionCache &Cache2 = Object2.CollisionCache;
+
+    // Object2 rotation in Object1 space, same for all chunks pairs
+    float matB[9];
+    memcpy(matB, Object2.CurrentRotationMat, 9 * sizeof(Object2.CurrentRotationMat[0]));
+    vw_Matrix33Mult(matB, Cache1.InvRotationMat);
+    sBoxPairAxes Axes;
+    InitBoxPairAxes(Axes, matB);
+
+    for (unsigned int i = 0; i < Cache1.HitBBWorldLocation.size(); i++) {
+        for (unsigned int j = 0; j < Cache2.HitBBWorldLocation.size(); j++) {
+            sVECTOR3D vPosB = Cache2.HitBBWorldLocation[j] - Cache1.HitBBWorldLocation[i];
+            float Distance2 = vPosB.x * vPosB.x + vPosB.y * vPosB.y + vPosB.z * vPosB.z;
             if (Distance2 > Object2.HitBB[j].Radius2 + Object1.HitBB[i].Radius2) {
                 continue;
             }
 
-            float TMPOldInvRotationMat[9];
-            memcpy(TMPOldInvRotationMat, Object1.CurrentRotationMat, 9 * sizeof(Object1.CurrentRotationMat[0]));
-            vw_Matrix33InverseRotate(TMPOldInvRotationMat);
-
-            float matB[9];
-            memcpy(matB, Object2.CurrentRotationMat, 9 * sizeof(Object2.CurrentRotationMat[0]));
-            vw_Matrix33Mult(matB, TMPOldInvRotationMat);
-
-            sVECTOR3D vPosB = (Object2.Location + Object2.HitBB[j].Location) -
-                              (Object1.Location + Object1.HitBB[i].Location);
-            vw_Matrix33CalcPoint(vPosB, TMPOldInvRotationMat);
-
-            sVECTOR3D XAxis(matB[0], matB[3], matB[6]);
-            sVECTOR3D YAxis(matB[1], matB[4], matB[7]);
-            sVECTOR3D ZAxis(matB[2], matB[5], matB[8]);
-
-            sVECTOR3D Obj1_data(Object1.HitBB[i].Size.x / 2.0f,
-                                Object1.HitBB[i].Size.y / 2.0f,
-                                Object1.HitBB[i].Size.z / 2.0f);
-            sVECTOR3D Obj2_data(Object2.HitBB[j].Size.x / 2.0f,
-                                Object2.HitBB[j].Size.y / 2.0f,
-                                Object2.HitBB[j].Size.z / 2.0f);
-
-            //1 (Ra)x
-            if (fabsf(vPosB.x) > (Obj1_data.x + Obj2_data.x * fabsf(XAxis.x) +
-                                  Obj2_data.y * fabsf(XAxis.y) +
-                                  Obj2_data.z * fabsf(XAxis.z))) {
-                continue;
-            }
-
-            //2 (Ra)y
-            if (fabsf(vPosB.y) > (Obj1_data.y + Obj2_data.x * fabsf(YAxis.x) +
-                                  Obj2_data.y * fabsf(YAxis.y) +
-                                  Obj2_data.z * fabsf(YAxis.z))) {
-                continue;
-            }
-
-            //3 (Ra)z
-            if (fabsf(vPosB.z) > (Obj1_data.z + Obj2_data.x * fabsf(ZAxis.x) +
-                                  Obj2_data.y * fabsf(ZAxis.y) +
-                                  Obj2_data.z * fabsf(ZAxis.z))) {
-                continue;
-            }
-
-            //4 (Rb)x
-            if (fabsf(vPosB.x * XAxis.x +
-                      vPosB.y * YAxis.x +
-                      vPosB.z * ZAxis.x) > (Obj2_data.x + Obj1_data.x * fabsf(XAxis.x) +
-                                            Obj1_data.y * fabsf(YAxis.x) +
-                                            Obj1_data.z * fabsf(ZAxis.x))) {
-                continue;
-            }
-
-            //5 (Rb)y
-            if (fabsf(vPosB.x * XAxis.y +
-                      vPosB.y * YAxis.y +
-                      vPosB.z * ZAxis.y) > (Obj2_data.y + Obj1_data.x * fabsf(XAxis.y) +
-                                            Obj1_data.y * fabsf(YAxis.y) +
-                                            Obj1_data.z * fabsf(ZAxis.y))) {
-                continue;
-            }
-
-            //6 (Rb)z
-            if (fabsf(vPosB.x * XAxis.z +
-                      vPosB.y * YAxis.z +
-                      vPosB.z * ZAxis.z) > (Obj2_data.z + Obj1_data.x * fabsf(XAxis.z) +
-                                            Obj1_data.y * fabsf(YAxis.z) +
-                                            Obj1_data.z * fabsf(ZAxis.z))) {
-                continue;
-            }
-
-            //7 (Ra)x X (Rb)x
-            if (fabsf(vPosB.z * YAxis.x - vPosB.y * ZAxis.x) > (Obj1_data.y * fabsf(ZAxis.x) +
-                                                                Obj1_data.z * fabsf(YAxis.x) +
-                                                                Obj2_data.y * fabsf(XAxis.z) +
-                                                                Obj2_data.z * fabsf(XAxis.y))) {
-                continue;
-            }
-
-            //8 (Ra)x X (Rb)y
-            if (fabsf(vPosB.z * YAxis.y - vPosB.y * ZAxis.y) > (Obj1_data.y * fabsf(ZAxis.y) +
-                                                                Obj1_data.z * fabsf(YAxis.y) +
-                                                                Obj2_data.x * fabsf(XAxis.z) +
-                                                                Obj2_data.z * fabsf(XAxis.x))) {
-                continue;
-            }
-
-            //9 (Ra)x X (Rb)z
-            if (fabsf(vPosB.z * YAxis.z - vPosB.y * ZAxis.z) > (Obj1_data.y * fabsf(ZAxis.z) +
-                                                                Obj1_data.z * fabsf(YAxis.z) +
-                                                                Obj2_data.x * fabsf(XAxis.y) +
-                                                                Obj2_data.y * fabsf(XAxis.x))) {
-                continue;
-            }
-
-            //10 (Ra)y X (Rb)x
-            if (fabsf(vPosB.x * ZAxis.x - vPosB.z * XAxis.x) > (Obj1_data.x * fabsf(ZAxis.x) +
-                                                                Obj1_data.z * fabsf(XAxis.x) +
-                                                                Obj2_data.y * fabsf(YAxis.z) +
-                                                                Obj2_data.z * fabsf(YAxis.y))) {
-                continue;
-            }
-
-            //11 (Ra)y X (Rb)y
-            if (fabsf(vPosB.x * ZAxis.y - vPosB.z * XAxis.y) > (Obj1_data.x * fabsf(ZAxis.y) +
-                                                                Obj1_data.z * fabsf(XAxis.y) +
-                                                                Obj2_data.x * fabsf(YAxis.z) +
-                                                                Obj2_data.z * fabsf(YAxis.x))) {
-                continue;
-            }
-
-            //12 (Ra)y X (Rb)z
-            if (fabsf(vPosB.x * ZAxis.z - vPosB.z * XAxis.z) > (Obj1_data.x * fabsf(ZAxis.z) +
-                                                                Obj1_data.z * fabsf(XAxis.z) +
-                                                                Obj2_data.x * fabsf(YAxis.y) +
-                                                                Obj2_data.y * fabsf(YAxis.x))) {
-                continue;
-            }
-
-            //13 (Ra)z X (Rb)x
-            if (fabsf(vPosB.y * XAxis.x - vPosB.x * YAxis.x) > (Obj1_data.x * fabsf(YAxis.x) +
-                                                                Obj1_data.y * fabsf(XAxis.x) +
-                                                                Obj2_data.y * fabsf(ZAxis.z) +
-                                                                Obj2_data.z * fabsf(ZAxis.y))) {
-                continue;
-            }
-
-            //14 (Ra)z X (Rb)y
-            if (fabsf(vPosB.y * XAxis.y - vPosB.x * YAxis.y) > (Obj1_data.x * fabsf(YAxis.y) +
-                                                                Obj1_data.y * fabsf(XAxis.y) +
-                                                                Obj2_data.x * fabsf(ZAxis.z) +
-                                                                Obj2_data.z * fabsf(ZAxis.x))) {
-                continue;
-            }
-
-            //15 (Ra)z X (Rb)z
-            if (fabsf(vPosB.y * XAxis.z - vPosB.x * YAxis.z) > (Obj1_data.x * fabsf(YAxis.z) +
-                                                                Obj1_data.y * fabsf(XAxis.z) +
-                                                                Obj2_data.x * fabsf(ZAxis.y) +
-                                                                Obj2_data.y * fabsf(ZAxis.x))) {
+            vw_Matrix33CalcPoint(vPosB, Cache1.InvRotationMat);
+            if (BoxesSeparated(Axes, vPosB, Cache1.HitBBHalfSize[i], Cache2.HitBBHalfSize[j])) {
                 continue;
             }
 
@@ -284,145 +402,28 @@ bool CheckHitBBHitBBCollisionDetection(const cObject3D &Object1, const cObject3D
  */
 bool CheckHitBBOBBCollisionDetection(const cObject3D &Object1, const cObject3D &Object2, int &Object1PieceNum)
 {
-    for (unsigned int i = 0; i < Object1.Chunks.size(); i++) {
-        float TMPOldInvRotationMat[9];
-        memcpy(TMPOldInvRotationMat, Object2.CurrentRotationMat, 9 * sizeof(Object2.CurrentRotationMat[0]));
-        vw_Matrix33InverseRotate(TMPOldInvRotationMat);
+    float TMPOldInvRotationMat[9];
+    memcpy(TMPOldInvRotationMat, Object2.CurrentRotationMat, 9 * sizeof(Object2.CurrentRotationMat[0]));
+    vw_Matrix33InverseRotate(TMPOldInvRotationMat);
 
-        float matB[9];
-        memcpy(matB, Object1.CurrentRotationMat, 9 * sizeof(Object1.CurrentRotationMat[0]));
-        vw_Matrix33Mult(matB, TMPOldInvRotationMat);
+    float matB[9];
+    memcpy(matB, Object1.CurrentRotationMat, 9 * sizeof(Object1.CurrentRotationMat[0]));
+    vw_Matrix33Mult(matB, TMPOldInvRotationMat);
+    sBoxPairAxes Axes;
+    InitBoxPairAxes(Axes, matB);
 
+    sVECTOR3D Obj1_data{Object2.Width / 2.0f, Object2.Height / 2.0f, Object2.Length / 2.0f};
+
+    for (unsigned int i = 0; i < Object1.Chunks.size(); i++) {
         sVECTOR3D vPosB = (Object1.Location + Object1.HitBB[i].Location) -
                           (Object2.Location + Object2.OBB.Location);
         vw_Matrix33CalcPoint(vPosB, TMPOldInvRotationMat);
 
-        sVECTOR3D XAxis(matB[0], matB[3], matB[6]);
-        sVECTOR3D YAxis(matB[1], matB[4], matB[7]);
-        sVECTOR3D ZAxis(matB[2], matB[5], matB[8]);
-
         sVECTOR3D Obj2_data{Object1.HitBB[i].Size.x / 2.0f,
                             Object1.HitBB[i].Size.y / 2.0f,
                             Object1.HitBB[i].Size.z / 2.0f};
-        sVECTOR3D Obj1_data{Object2.Width / 2.0f, Object2.Height / 2.0f, Object2.Length / 2.0f};
-
-        //1 (Ra)x
-        if (fabsf(vPosB.x) > (Obj1_data.x + Obj2_data.x * fabsf(XAxis.x) +
-                              Obj2_data.y * fabsf(XAxis.y) +
-                              Obj2_data.z * fabsf(XAxis.z))) {
-            continue;
-        }
-
-        //2 (Ra)y
-        if (fabsf(vPosB.y) > (Obj1_data.y + Obj2_data.x * fabsf(YAxis.x) +
-                              Obj2_data.y * fabsf(YAxis.y) +
-                              Obj2_data.z * fabsf(YAxis.z))) {
-            continue;
-        }
-
-        //3 (Ra)z
-        if (fabsf(vPosB.z) > (Obj1_data.z + Obj2_data.x * fabsf(ZAxis.x) +
-                              Obj2_data.y * fabsf(ZAxis.y) +
-                              Obj2_data.z * fabsf(ZAxis.z))) {
-            continue;
-        }
-
-        //4 (Rb)x
-        if (fabsf(vPosB.x * XAxis.x +
-                  vPosB.y * YAxis.x +
-                  vPosB.z * ZAxis.x) > (Obj2_data.x + Obj1_data.x * fabsf(XAxis.x) +
-                                        Obj1_data.y * fabsf(YAxis.x) +
-                                        Obj1_data.z * fabsf(ZAxis.x))) {
-            continue;
-        }
-
-        //5 (Rb)y
-        if (fabsf(vPosB.x * XAxis.y +
-                  vPosB.y * YAxis.y +
-                  vPosB.z * ZAxis.y) > (Obj2_data.y + Obj1_data.x * fabsf(XAxis.y) +
-                                        Obj1_data.y * fabsf(YAxis.y) +
-                                        Obj1_data.z * fabsf(ZAxis.y))) {
-            continue;
-        }
-
-        //6 (Rb)z
-        if (fabsf(vPosB.x * XAxis.z +
-                  vPosB.y * YAxis.z +
-                  vPosB.z * ZAxis.z) > (Obj2_data.z + Obj1_data.x * fabsf(XAxis.z) +
-                                        Obj1_data.y * fabsf(YAxis.z) +
-                                        Obj1_data.z * fabsf(ZAxis.z))) {
-            continue;
-        }
-
-        //7 (Ra)x X (Rb)x
-        if (fabsf(vPosB.z * YAxis.x - vPosB.y * ZAxis.x) > Obj1_data.y*fabsf(ZAxis.x) +
-                                                           Obj1_data.z*fabsf(YAxis.x) +
-                                                           Obj2_data.y*fabsf(XAxis.z) +
-                                                           Obj2_data.z*fabsf(XAxis.y)) {
-            continue;
-        }
-
-        //8 (Ra)x X (Rb)y
-        if (fabsf(vPosB.z * YAxis.y - vPosB.y * ZAxis.y) > Obj1_data.y*fabsf(ZAxis.y) +
-                                                           Obj1_data.z*fabsf(YAxis.y) +
-                                                           Obj2_data.x*fabsf(XAxis.z) +
-                                                           Obj2_data.z*fabsf(XAxis.x)) {
-            continue;
-        }
-
-        //9 (Ra)x X (Rb)z
-        if (fabsf(vPosB.z * YAxis.z - vPosB.y * ZAxis.z) > Obj1_data.y*fabsf(ZAxis.z) +
-                                                           Obj1_data.z*fabsf(YAxis.z) +
-                                                           Obj2_data.x*fabsf(XAxis.y) +
-                                                           Obj2_data.y*fabsf(XAxis.x)) {
-            continue;
-        }
-
-        //10 (Ra)y X (Rb)x
-        if (fabsf(vPosB.x * ZAxis.x - vPosB.z * XAxis.x) > Obj1_data.x * fabsf(ZAxis.x) +
-                                                           Obj1_data.z * fabsf(XAxis.x) +
-                                                           Obj2_data.y * fabsf(YAxis.z) +
-                                                           Obj2_data.z * fabsf(YAxis.y)) {
-            continue;
-        }
-
-        //11 (Ra)y X (Rb)y
-        if (fabsf(vPosB.x * ZAxis.y - vPosB.z * XAxis.y) > Obj1_data.x * fabsf(ZAxis.y) +
-                                                           Obj1_data.z * fabsf(XAxis.y) +
-                                                           Obj2_data.x * fabsf(YAxis.z) +
-                                                           Obj2_data.z * fabsf(YAxis.x)) {
-            continue;
-        }
-
-        //12 (Ra)y X (Rb)z
-        if (fabsf(vPosB.x * ZAxis.z - vPosB.z * XAxis.z) > Obj1_data.x * fabsf(ZAxis.z) +
-                                                           Obj1_data.z * fabsf(XAxis.z) +
-                                                           Obj2_data.x * fabsf(YAxis.y) +
-                                                           Obj2_data.y * fabsf(YAxis.x)) {
-            continue;
-        }
-
-        //13 (Ra)z X (Rb)x
-        if (fabsf(vPosB.y * XAxis.x - vPosB.x * YAxis.x) > Obj1_data.x * fabsf(YAxis.x) +
-                                                           Obj1_data.y * fabsf(XAxis.x) +
-                                                           Obj2_data.y * fabsf(ZAxis.z) +
-                                                           Obj2_data.z * fabsf(ZAxis.y)) {
-            continue;
-        }
-
-        //14 (Ra)z X (Rb)y
-        if (fabsf(vPosB.y * XAxis.y - vPosB.x * YAxis.y) > Obj1_data.x * fabsf(YAxis.y) +
-                                                           Obj1_data.y * fabsf(XAxis.y) +
-                                                           Obj2_data.x * fabsf(ZAxis.z) +
-                                                           Obj2_data.z * fabsf(ZAxis.x)) {
-            continue;
-        }
 
-        //15 (Ra)z X (Rb)z
-        if (fabsf(vPosB.y * XAxis.z - vPosB.x * YAxis.z) > Obj1_data.x * fabsf(YAxis.z) +
-                                                           Obj1_data.y * fabsf(XAxis.z) +
-                                                           Obj2_data.x * fabsf(ZAxis.y) +
-                                                           Obj2_data.y * fabsf(ZAxis.x)) {
+        if (BoxesSeparated(Axes, vPosB, Obj1_data, Obj2_data)) {
             continue;
         }
 
@@ -459,6 +460,7 @@ bool CheckHitBBMeshCollisionDetection(const cObject3D &Object1, const cObject3D
         vw_Matrix33CalcPoint(Center, TMPOldInvRotationMat);
 
         for (unsigned int j = 0; j < Object2.Chunks.size(); j++) {
+            const sChunk3D &tmpChunk = Object2.Model3D->Chunks[j];
             sVECTOR3D LocalLocation(Object2.Chunks[j].Location);
             vw_Matrix33CalcPoint(LocalLocation, Object2.CurrentRotationMat);
 
@@ -479,45 +481,45 @@ bool CheckHitBBMeshCollisionDetection(const cObject3D &Object1, const cObject3D
                 vw_Matrix44Translate(ObjTransMat, LocalLocation);
             }
 
-            for (unsigned int k = 0; k < Object2.Chunks[j].VertexQuantity; k+=3) {
+            for (unsigned int k = 0; k < tmpChunk.VertexQuantity; k+=3) {
                 int j2;
-                if (Object2.Chunks[j].IndexArray) {
-                    j2 = Object2.Chunks[j].IndexArray.get()[Object2.Chunks[j].RangeStart + k]
-                         * Object2.Chunks[j].VertexStride;
+                if (tmpChunk.IndexArray) {
+                    j2 = tmpChunk.IndexArray.get()[tmpChunk.RangeStart + k]
+                         * tmpChunk.VertexStride;
                 } else {
-                    j2 = (Object2.Chunks[j].RangeStart + k) * Object2.Chunks[j].VertexStride;
+                    j2 = (tmpChunk.RangeStart + k) * tmpChunk.VertexStride;
                 }
 
                 sVECTOR3D Point1;
-                Point1.x = Object2.Chunks[j].VertexArray.get()[j2];
-                Point1.y = Object2.Chunks[j].VertexArray.get()[j2 + 1];
-                Point1.z = Object2.Chunks[j].VertexArray.get()[j2 + 2];
+                Point1.x = tmpChunk.VertexArray.get()[j2];
+                Point1.y = tmpChunk.VertexArray.get()[j2 + 1];
+                Point1.z = tmpChunk.VertexArray.get()[j2 + 2];
                 vw_Matrix44CalcPoint(Point1, ObjTransMat);
 
-                if (Object2.Chunks[j].IndexArray) {
-                    j2 = Object2.Chunks[j].IndexArray.get()[Object2.Chunks[j].RangeStart + k + 1]
-                         * Object2.Chunks[j].VertexStride;
+                if (tmpChunk.IndexArray) {
+                    j2 = tmpChunk.IndexArray.get()[tmpChunk.RangeStart + k + 1]
+                         * tmpChunk.VertexStride;
                 } else {
-                    j2 = (Object2.Chunks[j].RangeStart + k + 1) * Object2.Chunks[j].VertexStride;
+                    j2 = (tmpChunk.RangeStart + k + 1) * tmpChunk.VertexStride;
                 }
 
                 sVECTOR3D Point2;
-                Point2.x = Object2.Chunks[j].VertexArray.get()[j2];
-                Point2.y = Object2.Chunks[j].VertexArray.get()[j2 + 1];
-                Point2.z = Object2.Chunks[j].VertexArray.get()[j2 + 2];
+                Point2.x = tmpChunk.VertexArray.get()[j2];
+                Point2.y = tmpChunk.VertexArray.get()[j2 + 1];
+                Point2.z = tmpChunk.VertexArray.get()[j2 + 2];
                 vw_Matrix44CalcPoint(Point2, ObjTransMat);
 
-                if (Object2.Chunks[j].IndexArray) {
-                    j2 = Object2.Chunks[j].IndexArray.get()[Object2.Chunks[j].RangeStart + k + 2] *
-                         Object2.Chunks[j].VertexStride;
+                if (tmpChunk.IndexArray) {
+                    j2 = tmpChunk.IndexArray.get()[tmpChunk.RangeStart + k + 2] *
+                         tmpChunk.VertexStride;
                 } else {
-                    j2 = (Object2.Chunks[j].RangeStart + k + 2) * Object2.Chunks[j].VertexStride;
+                    j2 = (tmpChunk.RangeStart + k + 2) * tmpChunk.VertexStride;
                 }
 
                 sVECTOR3D Point3;
-                Point3.x = Object2.Chunks[j].VertexArray.get()[j2];
-                Point3.y = Object2.Chunks[j].VertexArray.get()[j2 + 1];
-                Point3.z = Object2.Chunks[j].VertexArray.get()[j2 + 2];
+                Point3.x = tmpChunk.VertexArray.get()[j2];
+                Point3.y = tmpChunk.VertexArray.get()[j2 + 1];
+                Point3.z = tmpChunk.VertexArray.get()[j2 + 2];
                 vw_Matrix44CalcPoint(Point3, ObjTransMat);
 
                 vw_Matrix33CalcPoint(Point1, TMPOldInvRotationMat);
@@ -39,7 +39,7 @@ namespace astromenace {
 bool CheckMeshSphereCollisionDetection(const cObject3D &Object1, const cObject3D &Object2,
                                        sVECTOR3D &NewLoc, int &Object1PieceNum);
 // HitBB-HitBB collision detection.
-bool CheckHitBBHitBBCollisionDetection(const cObject3D &Object1, const cObject3D &Object2,
+bool CheckHitBBHitBBCollisionDetection(cObject3D &Object1, cObject3D &Object2,
                                        int &Object1PieceNum, int &Object2PieceNum);
 // HitBB-OBB collision detection.
 bool CheckHitBBOBBCollisionDetection(const cObject3D &Object1, const cObject3D &Object2, int &Object1PieceNum);
@@ -663,90 +663,99 @@ cBulletExplosion::cBulletExplosion(const cObject3D *Object, cProjectile &Project
     }
 
     // explosion with geometry animation
-    if (InternalExplosionType == 2) {
+    if (InternalExplosionType == 2 && Projectile.Model3D) {
         Texture = Projectile.Texture;
-        Chunks = Projectile.Chunks;
-
-        for (unsigned int i = 0; i < Chunks.size(); i++) {
-            Chunks[i].VBO = 0;
-            Chunks[i].IBO = 0;
-            Chunks[i].VAO = 0;
-            Chunks[i].NeedReleaseOpenGLBuffers = true; // this one should be released on destroy
-            Chunks[i].RangeStart = 0;
+        ExplosionModel3D = vw_CreateModel3D();
+        ExplosionModel3D->Chunks = Projectile.Model3D->Chunks;
+        std::vector<sChunk3D> &ExplosionChunks = ExplosionModel3D->Chunks;
+
+        for (unsigned int i = 0; i < ExplosionChunks.size(); i++) {
+            ExplosionChunks[i].VBO = 0;
+            ExplosionChunks[i].IBO = 0;
+            ExplosionChunks[i].VAO = 0;
+            ExplosionChunks[i].NeedReleaseOpenGLBuffers = true; // this one should be released on destroy
+            ExplosionChunks[i].RangeStart = 0;
+            ExplosionChunks[i].TriangleBVH.reset();
 
             if (GameConfig().UseGLSL120) {
-                Chunks[i].VertexStride = 3 + 3 + 6;
-                Chunks[i].VertexFormat = RI_3f_XYZ | RI_3f_NORMAL | RI_3_TEX | RI_2f_TEX;
+                ExplosionChunks[i].VertexStride = 3 + 3 + 6;
+                ExplosionChunks[i].VertexFormat = RI_3f_XYZ | RI_3f_NORMAL | RI_3_TEX | RI_2f_TEX;
             }
 
-            Chunks[i].VertexArray.reset(new float[Chunks[i].VertexStride * Chunks[i].VertexQuantity],
+            ExplosionChunks[i].VertexArray.reset(new float[ExplosionChunks[i].VertexStride * ExplosionChunks[i].VertexQuantity],
                                         std::default_delete<float[]>());
 
             // model's mesh rotation
-            for (unsigned int j = 0; j < Chunks[i].VertexQuantity; j++) {
-                int j1 = j * Chunks[i].VertexStride;
+            for (unsigned int j = 0; j < ExplosionChunks[i].VertexQuantity; j++) {
+                int j1 = j * ExplosionChunks[i].VertexStride;
                 int j2;
-                if (Projectile.Chunks[i].IndexArray) {
-                    j2 = Projectile.Chunks[i].IndexArray.get()[Projectile.Chunks[i].RangeStart + j] *
-                         Projectile.Chunks[i].VertexStride;
+                if (Projectile.Model3D->Chunks[i].IndexArray) {
+                    j2 = Projectile.Model3D->Chunks[i].IndexArray.get()[Projectile.Model3D->Chunks[i].RangeStart + j] *
+                         Projectile.Model3D->Chunks[i].VertexStride;
                 } else {
-                    j2 = (Projectile.Chunks[i].RangeStart + j) *
-                         Projectile.Chunks[i].VertexStride;
+                    j2 = (Projectile.Model3D->Chunks[i].RangeStart + j) *
+                         Projectile.Model3D->Chunks[i].VertexStride;
                 }
 
                 sVECTOR3D TMP;
-                TMP.x = Projectile.Chunks[i].VertexArray.get()[j2] + Chunks[i].Location.x;
-                TMP.y = Projectile.Chunks[i].VertexArray.get()[j2 + 1] + Chunks[i].Location.y;
-                TMP.z = Projectile.Chunks[i].VertexArray.get()[j2 + 2] + Chunks[i].Location.z;
+                TMP.x = Projectile.Model3D->Chunks[i].VertexArray.get()[j2] + Projectile.Chunks[i].Location.x;
+                TMP.y = Projectile.Model3D->Chunks[i].VertexArray.get()[j2 + 1] + Projectile.Chunks[i].Location.y;
+                TMP.z = Projectile.Model3D->Chunks[i].VertexArray.get()[j2 + 2] + Projectile.Chunks[i].Location.z;
                 vw_Matrix33CalcPoint(TMP, Projectile.CurrentRotationMat);
                 // coordinates
-                Chunks[i].VertexArray.get()[j1] = TMP.x;
-                Chunks[i].VertexArray.get()[j1 + 1] = TMP.y;
-                Chunks[i].VertexArray.get()[j1 + 2] = TMP.z;
+                ExplosionChunks[i].VertexArray.get()[j1] = TMP.x;
+                ExplosionChunks[i].VertexArray.get()[j1 + 1] = TMP.y;
+                ExplosionChunks[i].VertexArray.get()[j1 + 2] = TMP.z;
                 // normals
-                TMP.x = Projectile.Chunks[i].VertexArray.get()[j2 + 3];
-                TMP.y = Projectile.Chunks[i].VertexArray.get()[j2 + 4];
-                TMP.z = Projectile.Chunks[i].VertexArray.get()[j2 + 5];
+                TMP.x = Projectile.Model3D->Chunks[i].VertexArray.get()[j2 + 3];
+                TMP.y = Projectile.Model3D->Chunks[i].VertexArray.get()[j2 + 4];
+                TMP.z = Projectile.Model3D->Chunks[i].VertexArray.get()[j2 + 5];
                 vw_Matrix33CalcPoint(TMP, Projectile.CurrentRotationMat);
-                Chunks[i].VertexArray.get()[j1 + 3] = TMP.x;
-                Chunks[i].VertexArray.get()[j1 + 4] = TMP.y;
-                Chunks[i].VertexArray.get()[j1 + 5] = TMP.z;
+                ExplosionChunks[i].VertexArray.get()[j1 + 3] = TMP.x;
+                ExplosionChunks[i].VertexArray.get()[j1 + 4] = TMP.y;
+                ExplosionChunks[i].VertexArray.get()[j1 + 5] = TMP.z;
                 // texture UV
-                Chunks[i].VertexArray.get()[j1 + 6] = Projectile.Chunks[i].VertexArray.get()[j2 + 6];
-                Chunks[i].VertexArray.get()[j1 + 7] = Projectile.Chunks[i].VertexArray.get()[j2 + 7];
+                ExplosionChunks[i].VertexArray.get()[j1 + 6] = Projectile.Model3D->Chunks[i].VertexArray.get()[j2 + 6];
+                ExplosionChunks[i].VertexArray.get()[j1 + 7] = Projectile.Model3D->Chunks[i].VertexArray.get()[j2 + 7];
             }
 
-            Chunks[i].Location = sVECTOR3D{0.0f, 0.0f, 0.0f};
-            Chunks[i].IndexArray.reset();
+            ExplosionChunks[i].IndexArray.reset();
+        }
+
+        // chunks' state (rotation, animation) is the same as projectile's, but vertices are already moved
+        SetModel3D(ExplosionModel3D);
+        Chunks = Projectile.Chunks;
+        for (auto &tmpChunk : Chunks) {
+            tmpChunk.Location = sVECTOR3D{0.0f, 0.0f, 0.0f};
         }
 
         float tRadius2 = Projectile.Radius / 1.5f;
         int Count = 0;
-        ExplosionPieceData.reset(new sExplosionPiece[Chunks[0].VertexQuantity / 3]);
-        for (unsigned int i = 0; i < Chunks[0].VertexQuantity; i += 3) {
-            unsigned tmpIndex1 = Chunks[0].VertexStride * i;
-            ExplosionPieceData[Count].Velocity.x = Chunks[0].VertexArray.get()[tmpIndex1];
-            ExplosionPieceData[Count].Velocity.y = Chunks[0].VertexArray.get()[tmpIndex1 + 1];
-            ExplosionPieceData[Count].Velocity.z = Chunks[0].VertexArray.get()[tmpIndex1 + 2];
+        ExplosionPieceData.reset(new sExplosionPiece[ExplosionChunks[0].VertexQuantity / 3]);
+        for (unsigned int i = 0; i < ExplosionChunks[0].VertexQuantity; i += 3) {
+            unsigned tmpIndex1 = ExplosionChunks[0].VertexStride * i;
+            ExplosionPieceData[Count].Velocity.x = ExplosionChunks[0].VertexArray.get()[tmpIndex1];
+            ExplosionPieceData[Count].Velocity.y = ExplosionChunks[0].VertexArray.get()[tmpIndex1 + 1];
+            ExplosionPieceData[Count].Velocity.z = ExplosionChunks[0].VertexArray.get()[tmpIndex1 + 2];
 
             float VelocityTMP = vw_fRand0() * tRadius2;
 
             // acceleration and UV center for shader
             if (GameConfig().UseGLSL120) {
-                unsigned tmpIndex2 = tmpIndex1 + Chunks[0].VertexStride;
-                unsigned tmpIndex3 = tmpIndex2 + Chunks[0].VertexStride;
-                Chunks[0].VertexArray.get()[tmpIndex1 + 8] = ExplosionPieceData[Count].Velocity.x;
-                Chunks[0].VertexArray.get()[tmpIndex1 + 9] = ExplosionPieceData[Count].Velocity.y;
-                Chunks[0].VertexArray.get()[tmpIndex1 + 10] = ExplosionPieceData[Count].Velocity.z;
-                Chunks[0].VertexArray.get()[tmpIndex2 + 8] = ExplosionPieceData[Count].Velocity.x;
-                Chunks[0].VertexArray.get()[tmpIndex2 + 9] = ExplosionPieceData[Count].Velocity.y;
-                Chunks[0].VertexArray.get()[tmpIndex2 + 10] = ExplosionPieceData[Count].Velocity.z;
-                Chunks[0].VertexArray.get()[tmpIndex3 + 8] = ExplosionPieceData[Count].Velocity.x;
-                Chunks[0].VertexArray.get()[tmpIndex3 + 9] = ExplosionPieceData[Count].Velocity.y;
-                Chunks[0].VertexArray.get()[tmpIndex3 + 10] = ExplosionPieceData[Count].Velocity.z;
-                Chunks[0].VertexArray.get()[tmpIndex1 + 11] = VelocityTMP;
-                Chunks[0].VertexArray.get()[tmpIndex2 + 11] = Chunks[0].VertexArray.get()[tmpIndex1 + 11];
-                Chunks[0].VertexArray.get()[tmpIndex3 + 11] = Chunks[0].VertexArray.get()[tmpIndex1 + 11];
+                unsigned tmpIndex2 = tmpIndex1 + ExplosionChunks[0].VertexStride;
+                unsigned tmpIndex3 = tmpIndex2 + ExplosionChunks[0].VertexStride;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex1 + 8] = ExplosionPieceData[Count].Velocity.x;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex1 + 9] = ExplosionPieceData[Count].Velocity.y;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex1 + 10] = ExplosionPieceData[Count].Velocity.z;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex2 + 8] = ExplosionPieceData[Count].Velocity.x;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex2 + 9] = ExplosionPieceData[Count].Velocity.y;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex2 + 10] = ExplosionPieceData[Count].Velocity.z;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex3 + 8] = ExplosionPieceData[Count].Velocity.x;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex3 + 9] = ExplosionPieceData[Count].Velocity.y;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex3 + 10] = ExplosionPieceData[Count].Velocity.z;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex1 + 11] = VelocityTMP;
+                ExplosionChunks[0].VertexArray.get()[tmpIndex2 + 11] = ExplosionChunks[0].VertexArray.get()[tmpIndex1 + 11];
+                ExplosionChunks[0].VertexArray.get()[tmpIndex3 + 11] = ExplosionChunks[0].VertexArray.get()[tmpIndex1 + 11];
             }
 
             ExplosionPieceData[Count].Velocity = ExplosionPieceData[Count].Velocity ^ VelocityTMP;
@@ -769,22 +778,22 @@ cBulletExplosion::cBulletExplosion(const cObject3D *Object, cProjectile &Project
             ExplShaderRangeFactor = 0.0f;
         }
 
-        if (Chunks[0].VBO) {
-            vw_DeleteBufferObject(Chunks[0].VBO);
+        if (ExplosionChunks[0].VBO) {
+            vw_DeleteBufferObject(ExplosionChunks[0].VBO);
         }
         if (!vw_BuildBufferObject(eBufferObject::Vertex,
-                                  Chunks[0].VertexQuantity * Chunks[0].VertexStride * sizeof(float),
-                                  Chunks[0].VertexArray.get(), Chunks[0].VBO)) {
-            Chunks[0].VBO = 0;
+                                  ExplosionChunks[0].VertexQuantity * ExplosionChunks[0].VertexStride * sizeof(float),
+                                  ExplosionChunks[0].VertexArray.get(), ExplosionChunks[0].VBO)) {
+            ExplosionChunks[0].VBO = 0;
         }
 
-        if (Chunks[0].VAO) {
-            vw_DeleteVAO(Chunks[0].VAO);
+        if (ExplosionChunks[0].VAO) {
+            vw_DeleteVAO(ExplosionChunks[0].VAO);
         }
-        if (!vw_BuildVAO(Chunks[0].VAO, Chunks[0].VertexFormat,
-                         Chunks[0].VertexStride * sizeof(float),
-                         Chunks[0].VBO, Chunks[0].IBO)) {
-            Chunks[0].VAO = 0;
+        if (!vw_BuildVAO(ExplosionChunks[0].VAO, ExplosionChunks[0].VertexFormat,
+                         ExplosionChunks[0].VertexStride * sizeof(float),
+                         ExplosionChunks[0].VBO, ExplosionChunks[0].IBO)) {
+            ExplosionChunks[0].VAO = 0;
         }
     }
 
@@ -41,6 +41,12 @@ namespace {
 
 // all explosion list
 std::list<std::unique_ptr<cExplosion, std::function<void (cExplosion *p)>>> ExplosionList{};
+// explosions for parallel update and update status, note, we don't use std::vector<bool>,
+// since different threads could write into the same memory location in this case
+std::vector<cExplosion*> UpdateExplosions{};
+std::vector<uint8_t> UpdateExplosionsStatus{};
+// explosions per parallel update job
+constexpr unsigned UpdateExplosionsChunkSize{2};
 
 } // unnamed namespace
 
@@ -83,9 +89,26 @@ void CreateSpaceExplosion(cObject3D &Object, int ExplType, const sVECTOR3D &Expl
  */
 void UpdateAllExplosion(float Time)
 {
+    // explosions don't interact with other objects during update, so, we could update them
+    // in parallel, all global state changes are deferred and applied in list order
+    UpdateExplosions.clear();
+    for (auto &tmpExplosion : ExplosionList) {
+        UpdateExplosions.push_back(tmpExplosion.get());
+    }
+    UpdateExplosionsStatus.resize(UpdateExplosions.size());
+
+    vw_ParallelFor(static_cast<unsigned>(UpdateExplosions.size()), UpdateExplosionsChunkSize,
+                   [&Time] (unsigned Begin, unsigned End) {
+        for (unsigned i = Begin; i < End; i++) {
+            UpdateExplosionsStatus[i] = UpdateExplosions[i]->Update(Time);
+        }
+    });
+
     // NOTE use std::erase_if here (since C++20)
-    for (auto iter = ExplosionList.begin(); iter != ExplosionList.end();) {
-        if (!iter->get()->Update(Time)) {
+    unsigned i{0};
+    for (auto iter = ExplosionList.begin(); iter != ExplosionList.end(); i++) {
+        iter->get()->ApplyDeferredUpdate(!UpdateExplosionsStatus[i]);
+        if (!UpdateExplosionsStatus[i]) {
             iter = ExplosionList.erase(iter);
         } else {
             ++iter;
@@ -454,25 +477,42 @@ cExplosion::~cExplosion()
     }
 }
 
+/*
+ * Setup debris model with object's chunk, debris location is chunk's HitBB center.
+ * Note, debris have own model, but chunk's geometry (and OpenGL buffers) is owned by object's model.
+ */
+void cExplosion::SetupDebrisModel3D(cObject3D &Debris, const cObject3D &Object, unsigned ChunkNum,
+                                    const float (&InvRotationMat)[9])
+{
+    std::shared_ptr<sModel3D> DebrisModel3D = vw_CreateModel3D();
+    DebrisModel3D->Chunks.push_back(Object.Model3D->Chunks[ChunkNum]);
+
+    sChunk3D &DebrisChunk = DebrisModel3D->Chunks[0];
+    const sChunkState &ObjectChunk = Object.Chunks[ChunkNum];
+    DebrisChunk.NeedReleaseOpenGLBuffers = false;
+    DebrisChunk.Rotation = ObjectChunk.Rotation;
+    DebrisChunk.NeedGeometryAnimation = ObjectChunk.NeedGeometryAnimation;
+    DebrisChunk.GeometryAnimation = ObjectChunk.GeometryAnimation;
+    DebrisChunk.NeedTextureAnimation = ObjectChunk.NeedTextureAnimation;
+    DebrisChunk.TextureAnimation = ObjectChunk.TextureAnimation;
+    DebrisChunk.DrawType = ObjectChunk.DrawType;
+
+    sVECTOR3D LocalLocation = ObjectChunk.Location;
+    vw_Matrix33CalcPoint(LocalLocation, Object.CurrentRotationMat);
+    LocalLocation = Object.HitBB[ChunkNum].Location - LocalLocation;
+    vw_Matrix33CalcPoint(LocalLocation, InvRotationMat);
+    DebrisChunk.Location = LocalLocation ^ (-1.0f);
+
+    DebrisModel3D->MetadataInitialization();
+    Debris.SetModel3D(DebrisModel3D);
+}
+
 /*
  * Update.
  */
 bool cExplosion::Update(float Time)
 {
     if (!cObject3D::Update(Time)) {
-        for (auto &tmpGFX : GraphicFX) {
-            if (auto sharedGFX = tmpGFX.lock()) {
-                sharedGFX->StopAllParticles();
-
-                // FIXME why we need this in update? should be moved to initialization?
-                if (!(ExplosionTypeByClass == 2 && (ExplosionType == 16 || ExplosionType == 17
-                                                    || ExplosionType == 18 || ExplosionType == 19
-                                                    || ExplosionType == 205 || ExplosionType == 206
-                                                    || ExplosionType == 209 || ExplosionType == 210))) {
-                    vw_ReleaseParticleSystem(sharedGFX);
-                }
-            }
-        }
         return false;
     }
 
@@ -574,10 +614,10 @@ bool cExplosion::Update(float Time)
             float ExplosionGeometryMove = Time - ExplosionGeometryMoveLastTime;
             ExplosionGeometryMoveLastTime = Time;
 
-            if (!Chunks.empty()) {
+            if (ExplosionModel3D) {
                 int Count = 0;
 
-                for (auto &tmpChunk : Chunks) {
+                for (auto &tmpChunk : ExplosionModel3D->Chunks) {
                     for (unsigned int i = 0; i < tmpChunk.VertexQuantity; i += 3) {
                         if (ExplosionPieceData[Count].RemainTime > 0.0f) {
                             sVECTOR3D TMP = ExplosionPieceData[Count].Velocity ^ ExplosionGeometryMove;
@@ -625,31 +665,8 @@ bool cExplosion::Update(float Time)
 
                         Count++;
                     }
-
-                    if (tmpChunk.VBO) {
-                        vw_DeleteBufferObject(tmpChunk.VBO);
-                    }
-                    if (!vw_BuildBufferObject(eBufferObject::Vertex, tmpChunk.VertexQuantity * tmpChunk.VertexStride * sizeof(float),
-                                              tmpChunk.VertexArray.get(), tmpChunk.VBO)) {
-                        tmpChunk.VBO = 0;
-                    }
-
-                    if (!tmpChunk.IBO) {
-                        if (!vw_BuildBufferObject(eBufferObject::Index, tmpChunk.VertexQuantity * sizeof(unsigned),
-                                                  tmpChunk.IndexArray.get(), tmpChunk.IBO)) {
-                            tmpChunk.IBO = 0;
-                        }
-                    }
-
-                    if (tmpChunk.VAO) {
-                        vw_DeleteVAO(tmpChunk.VAO);
-                    }
-                    if (!vw_BuildVAO(tmpChunk.VAO, tmpChunk.VertexFormat,
-                                     tmpChunk.VertexStride * sizeof(float),
-                                     tmpChunk.VBO, tmpChunk.IBO)) {
-                        tmpChunk.VAO = 0;
-                    }
                 }
+                NeedBuffersRebuild = true;
             }
         }
     } else {
@@ -711,5 +728,63 @@ bool cExplosion::Update(float Time)
     return true;
 }
 
+/*
+ * Apply changes, that were deferred in Update() (OpenGL buffers, particle systems release).
+ */
+void cExplosion::ApplyDeferredUpdate(bool Expired)
+{
+    if (Expired) {
+        for (auto &tmpGFX : GraphicFX) {
+            if (auto sharedGFX = tmpGFX.lock()) {
+                sharedGFX->StopAllParticles();
+
+                // FIXME why we need this in update? should be moved to initialization?
+                if (!(ExplosionTypeByClass == 2 && (ExplosionType == 16 || ExplosionType == 17
+                                                    || ExplosionType == 18 || ExplosionType == 19
+                                                    || ExplosionType == 205 || ExplosionType == 206
+                                                    || ExplosionType == 209 || ExplosionType == 210))) {
+                    vw_ReleaseParticleSystem(sharedGFX);
+                }
+            }
+        }
+        return;
+    }
+
+    if (!NeedBuffersRebuild) {
+        return;
+    }
+    NeedBuffersRebuild = false;
+
+    if (!ExplosionModel3D) {
+        return;
+    }
+
+    for (auto &tmpChunk : ExplosionModel3D->Chunks) {
+        if (tmpChunk.VBO) {
+            vw_DeleteBufferObject(tmpChunk.VBO);
+        }
+        if (!vw_BuildBufferObject(eBufferObject::Vertex, tmpChunk.VertexQuantity * tmpChunk.VertexStride * sizeof(float),
+                                  tmpChunk.VertexArray.get(), tmpChunk.VBO)) {
+            tmpChunk.VBO = 0;
+        }
+
+        if (!tmpChunk.IBO) {
+            if (!vw_BuildBufferObject(eBufferObject::Index, tmpChunk.VertexQuantity * sizeof(unsigned),
+                                      tmpChunk.IndexArray.get(), tmpChunk.IBO)) {
+                tmpChunk.IBO = 0;
+            }
+        }
+
+        if (tmpChunk.VAO) {
+            vw_DeleteVAO(tmpChunk.VAO);
+        }
+        if (!vw_BuildVAO(tmpChunk.VAO, tmpChunk.VertexFormat,
+                         tmpChunk.VertexStride * sizeof(float),
+                         tmpChunk.VBO, tmpChunk.IBO)) {
+            tmpChunk.VAO = 0;
+        }
+    }
+}
+
 } // astromenace namespace
 } // viewizard namespace
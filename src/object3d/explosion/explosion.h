@@ -52,18 +52,31 @@ protected:
     cExplosion();
     ~cExplosion();
 
+    // Setup debris model with object's chunk, debris location is chunk's HitBB center.
+    static void SetupDebrisModel3D(cObject3D &Debris, const cObject3D &Object, unsigned ChunkNum,
+                                   const float (&InvRotationMat)[9]);
+
 public:
+    // Note, Update() could be called in parallel for different explosions, all global state
+    // changes (OpenGL, particle systems release) are deferred till ApplyDeferredUpdate() call.
     virtual bool Update(float Time) override;
+    // Apply changes, that were deferred in Update(), should be called from main thread.
+    void ApplyDeferredUpdate(bool Expired);
 
     int ExplosionType{0};
     int ExplosionTypeByClass{0};
 
+    // explosion's own geometry (generated from destroyed object's geometry and changed during
+    // explosion), Model3D points to the same model
+    std::shared_ptr<sModel3D> ExplosionModel3D{};
+
     // std::unique_ptr, we need only memory allocation without container's features
     // don't use std::vector here, since it allocates AND value-initializes
     std::unique_ptr<sExplosionPiece[]> ExplosionPieceData{};
 
     // NOTE this is part of non shader geometry calculation
     float ExplosionGeometryMoveLastTime{-1.0f};
+    bool NeedBuffersRebuild{false};
 
     sVECTOR3D VelocityOrientation{0.0f, 0.0f, 0.0f};
     float OldSpeed{0.0f};
@@ -43,6 +43,8 @@ namespace astromenace {
 cGroundExplosion::cGroundExplosion(cGroundObject &Object, int ExplType,
                                    const sVECTOR3D &ExplLocation, int ObjectChunkNum)
 {
+    Object.UpdateBounds();
+
     TimeLastUpdate = Object.TimeLastUpdate;
     ExplosionTypeByClass = 3;
     int InternalExplosionType = 0;
@@ -80,21 +82,9 @@ cGroundExplosion::cGroundExplosion(cGroundObject &Object, int ExplType,
                 sharedSpaceDebris->NormalMap[0] = Object.NormalMap[i];
             }
 
-            sharedSpaceDebris->Chunks.resize(1);
-            sharedSpaceDebris->Chunks[0] = Object.Chunks[i];
             sharedSpaceDebris->ShaderType = 1;
-            if (Object.Chunks[i].NeedReleaseOpenGLBuffers) {
-                Object.Chunks[i].NeedReleaseOpenGLBuffers = false;
-                sharedSpaceDebris->Chunks[0].NeedReleaseOpenGLBuffers = true;
-            }
-
-            sVECTOR3D LocalLocation = Object.Chunks[i].Location;
-            vw_Matrix33CalcPoint(LocalLocation, Object.CurrentRotationMat);
-            LocalLocation = Object.HitBB[i].Location - LocalLocation;
-            vw_Matrix33CalcPoint(LocalLocation, InvRotationMat);
-            sharedSpaceDebris->Chunks[0].Location = LocalLocation ^ (-1.0f);
 
-            sharedSpaceDebris->MetadataInitialization();
+            SetupDebrisModel3D(*sharedSpaceDebris, Object, i, InvRotationMat);
             sharedSpaceDebris->SetLocation(Object.Location + Object.HitBB[i].Location);
             sharedSpaceDebris->SetRotation(Object.Rotation);
 
@@ -379,22 +379,7 @@ cSpaceExplosion::cSpaceExplosion(cObject3D &Object, int ExplType, const sVECTOR3
                 sharedSpaceDebris->NormalMap[0] = Object.NormalMap[i];
             }
 
-            sharedSpaceDebris->Chunks.resize(1);
-            sharedSpaceDebris->Chunks[0] = Object.Chunks[i];
-
-            if (Object.Chunks[i].NeedReleaseOpenGLBuffers) {
-                Object.Chunks[i].NeedReleaseOpenGLBuffers = false;
-                sharedSpaceDebris->Chunks[0].NeedReleaseOpenGLBuffers = true;
-            }
-
-            sVECTOR3D LocalLocation = Object.Chunks[i].Location;
-            vw_Matrix33CalcPoint(LocalLocation, Object.CurrentRotationMat);
-            LocalLocation = Object.HitBB[i].Location - LocalLocation;
-            vw_Matrix33CalcPoint(LocalLocation, InvRotationMat);
-
-            sharedSpaceDebris->Chunks[0].Location = LocalLocation ^ (-1.0f);
-
-            sharedSpaceDebris->MetadataInitialization();
+            SetupDebrisModel3D(*sharedSpaceDebris, Object, i, InvRotationMat);
             sharedSpaceDebris->SetLocation(Object.Location + Object.HitBB[i].Location);
             sharedSpaceDebris->SetRotation(Object.Rotation);
             sharedSpaceDebris->Speed = Speed - 2 * vw_fRand();
@@ -425,7 +410,7 @@ cSpaceExplosion::cSpaceExplosion(cObject3D &Object, int ExplType, const sVECTOR3
     }
 
     // explosion with geometry animation
-    if (InternalExplosionType == 2) {
+    if (InternalExplosionType == 2 && Object.Model3D) {
         AABB[0] = Object.AABB[0];
         AABB[1] = Object.AABB[1];
         AABB[2] = Object.AABB[2];
@@ -440,41 +425,48 @@ cSpaceExplosion::cSpaceExplosion(cObject3D &Object, int ExplType, const sVECTOR3
         int TotalCount = 0;
 
         Texture = Object.Texture;
-        Chunks = Object.Chunks;
+        ExplosionModel3D = vw_CreateModel3D();
+        ExplosionModel3D->Chunks = Object.Model3D->Chunks;
+        std::vector<sChunk3D> &ExplosionChunks = ExplosionModel3D->Chunks;
 
         int NeedIn = GameConfig().VisualEffectsQuality;
 
-        for (unsigned int i = 0; i < Chunks.size(); i++) {
-            Chunks[i].VBO = 0;
-            Chunks[i].IBO = 0;
-            Chunks[i].VAO = 0;
-            Chunks[i].NeedReleaseOpenGLBuffers = true;
-            Chunks[i].RangeStart = 0;
-            Chunks[i].IndexArray.reset();
-            Chunks[i].VertexArrayWithSmallTriangles.reset();
-            Chunks[i].VertexArrayWithSmallTrianglesCount = 0;
-
-            Chunks[i].VertexQuantity = 0;
+        // selected vertices' coordinates and normals, transformed by batch
+        std::vector<sVECTOR3D> tmpLocations{};
+        std::vector<sVECTOR3D> tmpNormals{};
+
+        for (unsigned int i = 0; i < ExplosionChunks.size(); i++) {
+            ExplosionChunks[i].VBO = 0;
+            ExplosionChunks[i].IBO = 0;
+            ExplosionChunks[i].VAO = 0;
+            ExplosionChunks[i].NeedReleaseOpenGLBuffers = true;
+            ExplosionChunks[i].RangeStart = 0;
+            ExplosionChunks[i].IndexArray.reset();
+            ExplosionChunks[i].TriangleBVH.reset();
+            ExplosionChunks[i].VertexArrayWithSmallTriangles.reset();
+            ExplosionChunks[i].VertexArrayWithSmallTrianglesCount = 0;
+
+            ExplosionChunks[i].VertexQuantity = 0;
             int k = 0;
             int NeedInCur = NeedIn;
 
             int tricount = 0;
 
             // we don't need second texture coord. here
-            if ((Object.Chunks[i].VertexFormat & 0x000000F) >= 2) {
-                Chunks[i].VertexFormat = (Object.Chunks[i].VertexFormat & 0xFFFFFF0) | RI_1_TEX;
+            if ((Object.Model3D->Chunks[i].VertexFormat & 0x000000F) >= 2) {
+                ExplosionChunks[i].VertexFormat = (Object.Model3D->Chunks[i].VertexFormat & 0xFFFFFF0) | RI_1_TEX;
             } else {
-                Chunks[i].VertexFormat = Object.Chunks[i].VertexFormat;
+                ExplosionChunks[i].VertexFormat = Object.Model3D->Chunks[i].VertexFormat;
             }
 
-            Chunks[i].VertexStride = Object.Chunks[i].VertexStride;
+            ExplosionChunks[i].VertexStride = Object.Model3D->Chunks[i].VertexStride;
 
             if (GameConfig().UseGLSL120) {
-                Chunks[i].VertexStride = 3 + 3 + 6;
-                Chunks[i].VertexFormat = RI_3f_XYZ | RI_3f_NORMAL | RI_3_TEX | RI_2f_TEX;
+                ExplosionChunks[i].VertexStride = 3 + 3 + 6;
+                ExplosionChunks[i].VertexFormat = RI_3f_XYZ | RI_3f_NORMAL | RI_3_TEX | RI_2f_TEX;
             }
 
-            Chunks[i].VertexArray.reset(new float[Chunks[i].VertexStride * Object.Chunks[i].VertexArrayWithSmallTrianglesCount],
+            ExplosionChunks[i].VertexArray.reset(new float[ExplosionChunks[i].VertexStride * Object.Model3D->Chunks[i].VertexArrayWithSmallTrianglesCount],
                                         std::default_delete<float[]>());
 
             float TransMat[16]{Object.CurrentRotationMat[0], Object.CurrentRotationMat[1], Object.CurrentRotationMat[2], 0.0f,
@@ -504,38 +496,30 @@ cSpaceExplosion::cSpaceExplosion(cObject3D &Object, int ExplType, const sVECTOR3
                 vw_Matrix33Mult(TransMatNorm, TransMatAnimTMPNorm);
             }
 
-            vw_Matrix44Translate(TransMatTMP, Chunks[i].Location);
+            vw_Matrix44Translate(TransMatTMP, Object.Chunks[i].Location);
             vw_Matrix44Mult(TransMat, TransMatTMP);
             vw_Matrix33Mult(TransMatNorm, Object.CurrentRotationMat);
 
 
-            sVECTOR3D TMP;
-            for (unsigned int j = 0; j < Object.Chunks[i].VertexArrayWithSmallTrianglesCount; j++) {
+            tmpLocations.clear();
+            tmpNormals.clear();
+            for (unsigned int j = 0; j < Object.Model3D->Chunks[i].VertexArrayWithSmallTrianglesCount; j++) {
                 if (NeedInCur <= 0) {
-                    int j1 = k * Chunks[i].VertexStride;
-                    int j2 = j * Object.Chunks[i].VertexStride;
-
-                    TMP.x = Object.Chunks[i].VertexArrayWithSmallTriangles.get()[j2];
-                    TMP.y = Object.Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 1];
-                    TMP.z = Object.Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 2];
-                    vw_Matrix44CalcPoint(TMP, TransMat);
-                    // coordinates
-                    Chunks[i].VertexArray.get()[j1] = TMP.x;
-                    Chunks[i].VertexArray.get()[j1 + 1] = TMP.y;
-                    Chunks[i].VertexArray.get()[j1 + 2] = TMP.z;
-                    // normals
-                    TMP.x = Object.Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 3];
-                    TMP.y = Object.Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 4];
-                    TMP.z = Object.Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 5];
-                    vw_Matrix33CalcPoint(TMP, TransMatNorm);
-                    Chunks[i].VertexArray.get()[j1 + 3] = TMP.x;
-                    Chunks[i].VertexArray.get()[j1 + 4] = TMP.y;
-                    Chunks[i].VertexArray.get()[j1 + 5] = TMP.z;
+                    int j1 = k * ExplosionChunks[i].VertexStride;
+                    int j2 = j * Object.Model3D->Chunks[i].VertexStride;
+
+                    // coordinates and normals, will be transformed and stored below
+                    tmpLocations.push_back(sVECTOR3D{Object.Model3D->Chunks[i].VertexArrayWithSmallTriangles.get()[j2],
+                                                     Object.Model3D->Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 1],
+                                                     Object.Model3D->Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 2]});
+                    tmpNormals.push_back(sVECTOR3D{Object.Model3D->Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 3],
+                                                   Object.Model3D->Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 4],
+                                                   Object.Model3D->Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 5]});
                     // texture UV
-                    Chunks[i].VertexArray.get()[j1 + 6] = Object.Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 6];
-                    Chunks[i].VertexArray.get()[j1 + 7] = Object.Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 7];
+                    ExplosionChunks[i].VertexArray.get()[j1 + 6] = Object.Model3D->Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 6];
+                    ExplosionChunks[i].VertexArray.get()[j1 + 7] = Object.Model3D->Chunks[i].VertexArrayWithSmallTriangles.get()[j2 + 7];
 
-                    Chunks[i].VertexQuantity++;
+                    ExplosionChunks[i].VertexQuantity++;
                     k++;
 
                     if (tricount == 2)
@@ -550,11 +534,28 @@ cSpaceExplosion::cSpaceExplosion(cObject3D &Object, int ExplType, const sVECTOR3
                 }
             }
 
-            Chunks[i].Location = sVECTOR3D{0.0f, 0.0f, 0.0f};
-            Chunks[i].Rotation = sVECTOR3D{0.0f, 0.0f, 0.0f};
-            Chunks[i].GeometryAnimation = sVECTOR3D{0.0f, 0.0f, 0.0f};
+            vw_Matrix44CalcPoints(TransMat, tmpLocations.data(), tmpLocations.data(), ExplosionChunks[i].VertexQuantity);
+            vw_Matrix33CalcPoints(TransMatNorm, tmpNormals.data(), tmpNormals.data(), ExplosionChunks[i].VertexQuantity);
+            for (unsigned int j = 0; j < ExplosionChunks[i].VertexQuantity; j++) {
+                unsigned int j1 = j * ExplosionChunks[i].VertexStride;
+                ExplosionChunks[i].VertexArray.get()[j1] = tmpLocations[j].x;
+                ExplosionChunks[i].VertexArray.get()[j1 + 1] = tmpLocations[j].y;
+                ExplosionChunks[i].VertexArray.get()[j1 + 2] = tmpLocations[j].z;
+                ExplosionChunks[i].VertexArray.get()[j1 + 3] = tmpNormals[j].x;
+                ExplosionChunks[i].VertexArray.get()[j1 + 4] = tmpNormals[j].y;
+                ExplosionChunks[i].VertexArray.get()[j1 + 5] = tmpNormals[j].z;
+            }
+
+            TotalCount += ExplosionChunks[i].VertexQuantity;
+        }
 
-            TotalCount += Chunks[i].VertexQuantity;
+        // chunks' state (animation) is the same as object's, but vertices are already moved and rotated
+        SetModel3D(ExplosionModel3D);
+        Chunks = Object.Chunks;
+        for (auto &tmpChunk : Chunks) {
+            tmpChunk.Location = sVECTOR3D{0.0f, 0.0f, 0.0f};
+            tmpChunk.Rotation = sVECTOR3D{0.0f, 0.0f, 0.0f};
+            tmpChunk.GeometryAnimation = sVECTOR3D{0.0f, 0.0f, 0.0f};
         }
 
         // расстояние от центра до крайней точки
@@ -565,7 +566,7 @@ cSpaceExplosion::cSpaceExplosion(cObject3D &Object, int ExplType, const sVECTOR3
         // для каждого треугольника - свои данные
         int Count = 0;
         ExplosionPieceData.reset(new sExplosionPiece[TotalCount / 3]);
-        for (auto &tmpChunk : Chunks) {
+        for (auto &tmpChunk : ExplosionModel3D->Chunks) {
             for (unsigned int i = 0; i < tmpChunk.VertexQuantity; i += 3) {
                 unsigned tmpIndex1 = tmpChunk.VertexStride * i;
                 unsigned tmpIndex2 = tmpIndex1 + tmpChunk.VertexStride;
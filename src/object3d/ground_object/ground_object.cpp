@@ -42,6 +42,13 @@ constexpr float Epsilon{0.0001f};
 // all ground object list
 std::list<std::shared_ptr<cGroundObject>> GroundObjectList{};
 
+// ground objects for parallel update and update status, note, we don't use std::vector<bool>,
+// since different threads could write into the same memory location in this case
+std::vector<cGroundObject*> UpdateGroundObjects{};
+std::vector<uint8_t> UpdateGroundObjectsStatus{};
+// ground objects per parallel update job
+constexpr unsigned UpdateGroundObjectsChunkSize{4};
+
 } // unnamed namespace
 
 
@@ -94,9 +101,24 @@ std::weak_ptr<cGroundObject> CreateWheeled(const int WheeledNum)
  */
 void UpdateAllGroundObjects(float Time)
 {
+    UpdateGroundObjects.clear();
+    for (auto &tmpObject : GroundObjectList) {
+        UpdateGroundObjects.push_back(tmpObject.get());
+    }
+    UpdateGroundObjectsStatus.resize(UpdateGroundObjects.size());
+
+    // all interactions with other objects are deferred (see DeferObject3DCommand())
+    ParallelUpdateObject3D(static_cast<unsigned>(UpdateGroundObjects.size()), UpdateGroundObjectsChunkSize,
+                           [&Time] (unsigned Begin, unsigned End) {
+        for (unsigned i = Begin; i < End; i++) {
+            UpdateGroundObjectsStatus[i] = UpdateGroundObjects[i]->Update(Time);
+        }
+    });
+
     // NOTE use std::erase_if here (since C++20)
-    for (auto iter = GroundObjectList.begin(); iter != GroundObjectList.end();) {
-        if (!iter->get()->Update(Time)) {
+    unsigned i{0};
+    for (auto iter = GroundObjectList.begin(); iter != GroundObjectList.end(); i++) {
+        if (!UpdateGroundObjectsStatus[i]) {
             iter = GroundObjectList.erase(iter);
         } else {
             ++iter;
@@ -193,6 +215,17 @@ std::weak_ptr<cObject3D> GetGroundObjectPtr(const cGroundObject &Object)
     return std::weak_ptr<cObject3D> {};
 }
 
+/*
+ * Cycle for each ground object with object's ptr.
+ * Note, caller must guarantee, that 'Object' will not released in callback function call.
+ */
+void ForEachGroundObjectPtr(std::function<void (cGroundObject &Object, const std::weak_ptr<cObject3D> &ObjectPtr)> function)
+{
+    for (auto &tmpGround : GroundObjectList) {
+        function(*tmpGround, tmpGround);
+    }
+}
+
 /*
  * Constructor.
  */
@@ -293,31 +326,9 @@ bool cGroundObject::Update(float Time)
     }
 
     if (WeaponTargeting) {
-        int WeapNum{204}; // default pirate weapon
-        sVECTOR3D FirePos(0.0f, 0.0f, 0.0f);
-        if (!WeaponSlots.empty()) {
-            if (auto sharedWeapon = WeaponSlots[0].Weapon.lock()) {
-                WeapNum = sharedWeapon->InternalType;
-            }
-
-            int Count{0};
-            for (auto &tmpWeaponSlot : WeaponSlots) {
-                if (!tmpWeaponSlot.Weapon.expired()) {
-                    FirePos += tmpWeaponSlot.Location;
-                    Count++;
-                }
-            }
-            FirePos = FirePos ^ (1.0f / Count);
-        }
-        sVECTOR3D NeedAngle{TargetVertChunksNeedAngle, TargetHorizChunksNeedAngle, 0};
-        sVECTOR3D tmpTargetLocation{};
-        if (FindTargetLocationWithPrediction(ObjectStatus, Location + FirePos, WeapNum, tmpTargetLocation)
-            && GetTurretOnTargetOrientation(Location + FirePos, Rotation, CurrentRotationMat, tmpTargetLocation, NeedAngle)) {
-            TargetHorizChunksNeedAngle = NeedAngle.y;
-            TargetVertChunksNeedAngle = NeedAngle.x;
-        } else {
-            TargetVertChunksNeedAngle = TargetVertChunksMaxAngle * 0.5f;
-        }
+        // targeting read other objects, should be deferred during objects parallel update,
+        // so, turret rotates to the angles, found on previous update
+        DeferObject3DCommand([this] () {UpdateWeaponsTargeting();});
     } else {
         TargetHorizChunksNeedAngle = 0.0f;
         TargetVertChunksNeedAngle = 0.0f;
@@ -450,7 +461,7 @@ bool cGroundObject::Update(float Time)
             for (auto &tmpWeaponSlot : WeaponSlots) {
                 if (tmpWeaponSlot.SetFire) {
                     if (auto sharedWeapon = tmpWeaponSlot.Weapon.lock()) {
-                        sharedWeapon->WeaponFire(Time);
+                        DeferWeaponFire(sharedWeapon, Time);
                     }
                 }
             }
@@ -483,7 +494,7 @@ bool cGroundObject::Update(float Time)
                 if (!WeaponSlots[i].Weapon.expired() && WeaponSlots[i].SetFire) {
                     if (WeaponGroupCurrentFireNum == static_cast<int>(i) && WeaponGroupCurrentFireDelay <= 0.0f) {
                         if (auto sharedWeapon = WeaponSlots[i].Weapon.lock()) {
-                            sharedWeapon->WeaponFire(Time);
+                            DeferWeaponFire(sharedWeapon, Time);
                         }
 
                         WeaponGroupCurrentFireDelay = (PrimTime / PrimCount) * ((1.0f + GameEnemyWeaponPenalty) / 2.0f);
@@ -537,7 +548,7 @@ bool cGroundObject::Update(float Time)
                     if (WeaponGroupCurrentFireNum == static_cast<int>(i)
                         && WeaponGroupCurrentFireDelay <= 0.0f) {
                         if (auto sharedWeapon = WeaponSlots[i].Weapon.lock()) {
-                            sharedWeapon->WeaponFire(Time);
+                            DeferWeaponFire(sharedWeapon, Time);
                         }
 
                         WeaponGroupCurrentFireDelay = PrimTime / (PrimCount * PrimCount);
@@ -765,5 +776,37 @@ bool cGroundObject::Update(float Time)
     return true;
 }
 
+/*
+ * Weapons targeting.
+ */
+void cGroundObject::UpdateWeaponsTargeting()
+{
+    int WeapNum{204}; // default pirate weapon
+    sVECTOR3D FirePos(0.0f, 0.0f, 0.0f);
+    if (!WeaponSlots.empty()) {
+        if (auto sharedWeapon = WeaponSlots[0].Weapon.lock()) {
+            WeapNum = sharedWeapon->InternalType;
+        }
+
+        int Count{0};
+        for (auto &tmpWeaponSlot : WeaponSlots) {
+            if (!tmpWeaponSlot.Weapon.expired()) {
+                FirePos += tmpWeaponSlot.Location;
+                Count++;
+            }
+        }
+        FirePos = FirePos ^ (1.0f / Count);
+    }
+    sVECTOR3D NeedAngle{TargetVertChunksNeedAngle, TargetHorizChunksNeedAngle, 0};
+    sVECTOR3D tmpTargetLocation{};
+    if (FindTargetLocationWithPrediction(ObjectStatus, Location + FirePos, WeapNum, tmpTargetLocation)
+        && GetTurretOnTargetOrientation(Location + FirePos, Rotation, CurrentRotationMat, tmpTargetLocation, NeedAngle)) {
+        TargetHorizChunksNeedAngle = NeedAngle.y;
+        TargetVertChunksNeedAngle = NeedAngle.x;
+    } else {
+        TargetVertChunksNeedAngle = TargetVertChunksMaxAngle * 0.5f;
+    }
+}
+
 } // astromenace namespace
 } // viewizard namespace
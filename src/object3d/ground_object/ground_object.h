@@ -80,6 +80,10 @@ protected:
     cGroundObject();
     ~cGroundObject() = default;
 
+private:
+    // Weapons targeting, could be deferred (see DeferObject3DCommand()).
+    void UpdateWeaponsTargeting();
+
 public:
     virtual bool Update(float Time) override;
     virtual void SetLocation(const sVECTOR3D &NewLocation) override;
@@ -197,6 +201,9 @@ void ForEachGroundObject(std::function<void (cGroundObject &Object)> function);
 void ForEachGroundObject(std::function<void (cGroundObject &Object, eGroundCycle &Command)> function);
 // Get object ptr by reference.
 std::weak_ptr<cObject3D> GetGroundObjectPtr(const cGroundObject &Object);
+// Cycle for each ground object with object's ptr (same order as ForEachGroundObject() have).
+// Note, caller must guarantee, that 'Object' will not released in callback function call.
+void ForEachGroundObjectPtr(std::function<void (cGroundObject &Object, const std::weak_ptr<cObject3D> &ObjectPtr)> function);
 
 } // astromenace namespace
 } // viewizard namespace
@@ -39,13 +39,12 @@ std::weak_ptr<cGLSL> GLSLShaderType3{};
 
 
 /*
- * Check for "mortal" objects, that could be used for collision detection.
+ * Check for "mortal" objects type, that could be used for collision detection.
  */
-// TODO probably, we should use additional field with this info instead of call NeedCheckCollision() all the time
-bool NeedCheckCollision(const cObject3D &Object3D)
+bool NeedCheckCollision(eObjectType ObjectType)
 {
     // don't use 'default' case here, we need compiler's warning if anyone was missed
-    switch (Object3D.ObjectType) {
+    switch (ObjectType) {
     case eObjectType::none:
         return false;
 
@@ -101,6 +100,15 @@ bool NeedCheckCollision(const cObject3D &Object3D)
     return false;
 }
 
+/*
+ * Check for "mortal" objects, that could be used for collision detection.
+ */
+// TODO probably, we should use additional field with this info instead of call NeedCheckCollision() all the time
+bool NeedCheckCollision(const cObject3D &Object3D)
+{
+    return NeedCheckCollision(Object3D.ObjectType);
+}
+
 /*
  * Load 3D model data.
  */
@@ -112,27 +120,13 @@ void LoadObjectData(const std::string &FileName, cObject3D &Object3D)
         return;
     }
 
-    Object3D.GlobalVertexArray = sharedModel->GlobalVertexArray;
-    Object3D.GlobalVertexArrayCount = sharedModel->GlobalVertexArrayCount;
-    Object3D.GlobalVBO = sharedModel->GlobalVBO;
-    Object3D.GlobalIndexArray = sharedModel->GlobalIndexArray;
-    Object3D.GlobalIndexArrayCount = sharedModel->GlobalIndexArrayCount;
-    Object3D.GlobalIBO = sharedModel->GlobalIBO;
-    Object3D.GlobalVAO = sharedModel->GlobalVAO;
-    Object3D.Chunks = sharedModel->Chunks;
+    // model's chunks geometry is shared by all objects, object have only chunks' state
+    // (location/rotation/animation) and bounds (rotated with object and chunks)
+    Object3D.SetModel3D(sharedModel);
 
     Object3D.Texture.resize(Object3D.Chunks.size(), 0);
     Object3D.TextureIllum.resize(Object3D.Chunks.size(), 0);
     Object3D.NormalMap.resize(Object3D.Chunks.size(), 0);
-
-    Object3D.AABB = sharedModel->AABB;
-    Object3D.OBB = sharedModel->OBB;
-    Object3D.HitBB = sharedModel->HitBB;
-    Object3D.GeometryCenter = sharedModel->GeometryCenter;
-    Object3D.Radius = sharedModel->Radius;
-    Object3D.Width = sharedModel->Width;
-    Object3D.Length = sharedModel->Length;
-    Object3D.Height = sharedModel->Height;
 }
 
 /*
@@ -42,6 +42,10 @@ namespace astromenace {
 namespace {
 
 eRenderBoundingBoxes BBRenderMode{eRenderBoundingBoxes::None};
+// current simulation tick, note, 0 is reserved for "never moved" objects
+unsigned SimulationTick{1};
+// rendering interpolation factor between previous and current simulation ticks
+float InterpolationFactor{1.0f};
 
 } // unnamed namespace
 
@@ -52,115 +56,99 @@ extern std::weak_ptr<cGLSL> GLSLShaderType3;
 
 
 /*
- * Set chunk location.
+ * Set box corners by min and max points.
  */
-void cObject3D::SetChunkLocation(const sVECTOR3D &NewLocation, unsigned ChunkNum)
+static void SetBoxCorners(bounding_box &Box, const sVECTOR3D &Min, const sVECTOR3D &Max)
 {
-    if (!HitBB.empty()) {
-        float OldInvRotationMatTmp[9];
-        memcpy(OldInvRotationMatTmp, CurrentRotationMat, 9 * sizeof(CurrentRotationMat[0]));
-        vw_Matrix33InverseRotate(OldInvRotationMatTmp);
-
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, OldInvRotationMatTmp);
-        HitBB[ChunkNum].Location -= Chunks[ChunkNum].Location - NewLocation;
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, CurrentRotationMat);
+    Box[0] = sVECTOR3D{Max.x, Max.y, Max.z};
+    Box[1] = sVECTOR3D{Min.x, Max.y, Max.z};
+    Box[2] = sVECTOR3D{Min.x, Max.y, Min.z};
+    Box[3] = sVECTOR3D{Max.x, Max.y, Min.z};
+    Box[4] = sVECTOR3D{Max.x, Min.y, Max.z};
+    Box[5] = sVECTOR3D{Min.x, Min.y, Max.z};
+    Box[6] = sVECTOR3D{Min.x, Min.y, Min.z};
+    Box[7] = sVECTOR3D{Max.x, Min.y, Min.z};
+}
 
-        float MinX = 10000.0f;
-        float MaxX = -10000.0f;
-        float MinY = 10000.0f;
-        float MaxY = -10000.0f;
-        float MinZ = 10000.0f;
-        float MaxZ = -10000.0f;
+/*
+ * Store chunks hit boxes in object's local space, for current chunks location and rotation.
+ */
+static void InitChunksHitBB(cObject3D &Object)
+{
+    float InvRotationMat[9];
+    memcpy(InvRotationMat, Object.CurrentRotationMat, 9 * sizeof(Object.CurrentRotationMat[0]));
+    vw_Matrix33InverseRotate(InvRotationMat);
+
+    Object.ChunksHitBB.resize(Object.Chunks.size());
+    for (unsigned i = 0; i < Object.Chunks.size(); i++) {
+        sChunkHitBB &tmpChunkHitBB = Object.ChunksHitBB[i];
+
+        tmpChunkHitBB.LocalBox = Object.HitBB[i].Box;
+        vw_Matrix33CalcPoints(InvRotationMat, tmpChunkHitBB.LocalBox.data(),
+                              tmpChunkHitBB.LocalBox.data(), tmpChunkHitBB.LocalBox.size());
+        tmpChunkHitBB.LocalLocation = Object.HitBB[i].Location;
+        vw_Matrix33CalcPoint(tmpChunkHitBB.LocalLocation, InvRotationMat);
+
+        tmpChunkHitBB.BaseBox = tmpChunkHitBB.LocalBox;
+        tmpChunkHitBB.BaseOffset = tmpChunkHitBB.LocalLocation - Object.Chunks[i].Location;
+        vw_Matrix33CreateRotate(tmpChunkHitBB.BaseInvRotationMat, Object.Chunks[i].Rotation);
+        vw_Matrix33InverseRotate(tmpChunkHitBB.BaseInvRotationMat);
+    }
+}
 
-        for (unsigned int i = 0; i < Chunks.size(); i++) {
-            vw_Matrix33CalcPoint(HitBB[i].Location, OldInvRotationMatTmp);
+/*
+ * Set shared 3D model and initialize chunks' state by model's chunks.
+ */
+void cObject3D::SetModel3D(const std::shared_ptr<const sModel3D> &NewModel3D)
+{
+    Model3D = NewModel3D;
+    Chunks.clear();
+    ChunksHitBB.clear();
+    ChunksDrawMatrix.clear();
+    BoundsDirty = false;
+    CollisionCacheStamp = 0;
+    if (!Model3D) {
+        return;
+    }
 
-            for (int j = 0; j < 8; j++) {
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], OldInvRotationMatTmp);
+    Chunks.resize(Model3D->Chunks.size());
+    for (unsigned i = 0; i < Chunks.size(); i++) {
+        Chunks[i].Location = Model3D->Chunks[i].Location;
+        Chunks[i].Rotation = Model3D->Chunks[i].Rotation;
+        Chunks[i].NeedGeometryAnimation = Model3D->Chunks[i].NeedGeometryAnimation;
+        Chunks[i].GeometryAnimation = Model3D->Chunks[i].GeometryAnimation;
+        Chunks[i].NeedTextureAnimation = Model3D->Chunks[i].NeedTextureAnimation;
+        Chunks[i].TextureAnimation = Model3D->Chunks[i].TextureAnimation;
+        Chunks[i].DrawType = Model3D->Chunks[i].DrawType;
+    }
 
-                if (MinX > HitBB[i].Box[j].x + HitBB[i].Location.x) {
-                    MinX = HitBB[i].Box[j].x + HitBB[i].Location.x;
-                }
-                if (MaxX < HitBB[i].Box[j].x + HitBB[i].Location.x) {
-                    MaxX = HitBB[i].Box[j].x + HitBB[i].Location.x;
-                }
-                if (MinY > HitBB[i].Box[j].y + HitBB[i].Location.y) {
-                    MinY = HitBB[i].Box[j].y + HitBB[i].Location.y;
-                }
-                if (MaxY < HitBB[i].Box[j].y + HitBB[i].Location.y) {
-                    MaxY = HitBB[i].Box[j].y + HitBB[i].Location.y;
-                }
-                if (MinZ > HitBB[i].Box[j].z + HitBB[i].Location.z) {
-                    MinZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
-                }
-                if (MaxZ < HitBB[i].Box[j].z + HitBB[i].Location.z) {
-                    MaxZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
-                }
+    // generated geometry could be without metadata, bounds should be provided by caller
+    if (Model3D->HitBB.size() != Model3D->Chunks.size()) {
+        return;
+    }
 
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], CurrentRotationMat);
-            }
-            vw_Matrix33CalcPoint(HitBB[i].Location, CurrentRotationMat);
-        }
+    AABB = Model3D->AABB;
+    OBB = Model3D->OBB;
+    HitBB = Model3D->HitBB;
+    GeometryCenter = Model3D->GeometryCenter;
+    Radius = Model3D->Radius;
+    Width = Model3D->Width;
+    Length = Model3D->Length;
+    Height = Model3D->Height;
+}
 
-        OBB.Box[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-        OBB.Box[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-        OBB.Box[2] = sVECTOR3D{MinX, MaxY, MinZ};
-        OBB.Box[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-        OBB.Box[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-        OBB.Box[5] = sVECTOR3D{MinX, MinY, MaxZ};
-        OBB.Box[6] = sVECTOR3D{MinX, MinY, MinZ};
-        OBB.Box[7] = sVECTOR3D{MaxX, MinY, MinZ};
-
-        Width = fabsf(MaxX - MinX);
-        Height = fabsf(MaxY - MinY);
-        Length = fabsf(MaxZ - MinZ);
-
-        float Width2 = Width / 2.0f;
-        float Length2 = Length / 2.0f;
-        float Height2 = Height / 2.0f;
-        Radius = vw_sqrtf(Width2 * Width2 + Length2 * Length2 + Height2 * Height2);
-
-        OBB.Location.x = (MaxX + MinX) / 2.0f;
-        OBB.Location.y = (MaxY + MinY) / 2.0f;
-        OBB.Location.z = (MaxZ + MinZ) / 2.0f;
-
-        for (int k = 0; k < 8; k++) {
-            OBB.Box[k] -= OBB.Location;
-            vw_Matrix33CalcPoint(OBB.Box[k], CurrentRotationMat);
-        }
-        vw_Matrix33CalcPoint(OBB.Location, CurrentRotationMat);
-
-        MinX = MaxX = OBB.Box[0].x + OBB.Location.x;
-        MinY = MaxY = OBB.Box[0].y + OBB.Location.y;
-        MinZ = MaxZ = OBB.Box[0].z + OBB.Location.z;
-        for (int j = 0; j < 8; j++) {
-            if (MinX > OBB.Box[j].x + OBB.Location.x) {
-                MinX = OBB.Box[j].x + OBB.Location.x;
-            }
-            if (MinY > OBB.Box[j].y + OBB.Location.y) {
-                MinY = OBB.Box[j].y + OBB.Location.y;
-            }
-            if (MinZ > OBB.Box[j].z + OBB.Location.z) {
-                MinZ = OBB.Box[j].z + OBB.Location.z;
-            }
-            if (MaxX < OBB.Box[j].x + OBB.Location.x) {
-                MaxX = OBB.Box[j].x + OBB.Location.x;
-            }
-            if (MaxY < OBB.Box[j].y + OBB.Location.y) {
-                MaxY = OBB.Box[j].y + OBB.Location.y;
-            }
-            if (MaxZ < OBB.Box[j].z + OBB.Location.z) {
-                MaxZ = OBB.Box[j].z + OBB.Location.z;
-            }
+/*
+ * Set chunk location.
+ * Note, bounds (HitBB, OBB, AABB and size) will be updated on next UpdateBounds() call.
+ */
+void cObject3D::SetChunkLocation(const sVECTOR3D &NewLocation, unsigned ChunkNum)
+{
+    if (!HitBB.empty()) {
+        if (ChunksHitBB.empty()) {
+            InitChunksHitBB(*this);
         }
-        AABB[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-        AABB[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-        AABB[2] = sVECTOR3D{MinX, MaxY, MinZ};
-        AABB[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-        AABB[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-        AABB[5] = sVECTOR3D{MinX, MinY, MaxZ};
-        AABB[6] = sVECTOR3D{MinX, MinY, MinZ};
-        AABB[7] = sVECTOR3D{MaxX, MinY, MinZ};
+        ChunksHitBB[ChunkNum].Dirty = true;
+        BoundsDirty = true;
     }
 
     Chunks[ChunkNum].Location = NewLocation;
@@ -168,133 +156,121 @@ void cObject3D::SetChunkLocation(const sVECTOR3D &NewLocation, unsigned ChunkNum
 
 /*
  * Set chunk rotation.
+ * Note, bounds (HitBB, OBB, AABB and size) will be updated on next UpdateBounds() call.
  */
 void cObject3D::SetChunkRotation(const sVECTOR3D &NewRotation, unsigned ChunkNum)
 {
     if (!HitBB.empty()) {
-        float CurrentRotationMatTmp2[9];
-        vw_Matrix33CreateRotate(CurrentRotationMatTmp2, NewRotation);
-
-        float OldInvRotationMatTmp2[9];
-        vw_Matrix33CreateRotate(OldInvRotationMatTmp2, Chunks[ChunkNum].Rotation);
-        vw_Matrix33InverseRotate(OldInvRotationMatTmp2);
-
-        float OldInvRotationMatTmp[9];
-        memcpy(OldInvRotationMatTmp, CurrentRotationMat, 9 * sizeof(CurrentRotationMat[0]));
-        vw_Matrix33InverseRotate(OldInvRotationMatTmp);
-
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, OldInvRotationMatTmp);
-        HitBB[ChunkNum].Location -= Chunks[ChunkNum].Location;
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, OldInvRotationMatTmp2);
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, CurrentRotationMatTmp2);
-        HitBB[ChunkNum].Location += Chunks[ChunkNum].Location;
-        vw_Matrix33CalcPoint(HitBB[ChunkNum].Location, CurrentRotationMat);
-        for (int j = 0; j < 8; j++) {
-            vw_Matrix33CalcPoint(HitBB[ChunkNum].Box[j], OldInvRotationMatTmp);
-            vw_Matrix33CalcPoint(HitBB[ChunkNum].Box[j], OldInvRotationMatTmp2);
-            vw_Matrix33CalcPoint(HitBB[ChunkNum].Box[j], CurrentRotationMatTmp2);
-            vw_Matrix33CalcPoint(HitBB[ChunkNum].Box[j], CurrentRotationMat);
+        if (ChunksHitBB.empty()) {
+            InitChunksHitBB(*this);
         }
+        ChunksHitBB[ChunkNum].Dirty = true;
+        BoundsDirty = true;
+    }
 
-        float MinX = 10000.0f;
-        float MaxX = -10000.0f;
-        float MinY = 10000.0f;
-        float MaxY = -10000.0f;
-        float MinZ = 10000.0f;
-        float MaxZ = -10000.0f;
+    Chunks[ChunkNum].Rotation = NewRotation;
+}
 
-        for (unsigned int i = 0; i < Chunks.size(); i++) {
-            vw_Matrix33CalcPoint(HitBB[i].Location, OldInvRotationMatTmp);
+/*
+ * Update bounds (HitBB, OBB, AABB and size), if chunks were moved or rotated since last update.
+ * Should be called before bounds usage (collision detection, culling, etc).
+ */
+void cObject3D::UpdateBounds()
+{
+    if (!BoundsDirty) {
+        return;
+    }
+    BoundsDirty = false;
+    CollisionCacheStamp = 0;
+
+    // chunks hit boxes in object's local space, for current chunks location and rotation
+    for (unsigned i = 0; i < Chunks.size(); i++) {
+        sChunkHitBB &tmpChunkHitBB = ChunksHitBB[i];
+        if (!tmpChunkHitBB.Dirty) {
+            continue;
+        }
+        tmpChunkHitBB.Dirty = false;
 
-            for (int j = 0; j < 8; j++) {
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], OldInvRotationMatTmp);
+        float ChunkRotationMat[9];
+        vw_Matrix33CreateRotate(ChunkRotationMat, Chunks[i].Rotation);
 
-                if (MinX > HitBB[i].Box[j].x + HitBB[i].Location.x) {
-                    MinX = HitBB[i].Box[j].x + HitBB[i].Location.x;
-                }
-                if (MaxX < HitBB[i].Box[j].x + HitBB[i].Location.x) {
-                    MaxX = HitBB[i].Box[j].x + HitBB[i].Location.x;
-                }
-                if (MinY > HitBB[i].Box[j].y + HitBB[i].Location.y) {
-                    MinY = HitBB[i].Box[j].y + HitBB[i].Location.y;
-                }
-                if (MaxY < HitBB[i].Box[j].y + HitBB[i].Location.y) {
-                    MaxY = HitBB[i].Box[j].y + HitBB[i].Location.y;
-                }
-                if (MinZ > HitBB[i].Box[j].z + HitBB[i].Location.z) {
-                    MinZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
-                }
-                if (MaxZ < HitBB[i].Box[j].z + HitBB[i].Location.z) {
-                    MaxZ = HitBB[i].Box[j].z + HitBB[i].Location.z;
-                }
+        vw_Matrix33CalcPoints(tmpChunkHitBB.BaseInvRotationMat, tmpChunkHitBB.BaseBox.data(),
+                              tmpChunkHitBB.LocalBox.data(), tmpChunkHitBB.LocalBox.size());
+        vw_Matrix33CalcPoints(ChunkRotationMat, tmpChunkHitBB.LocalBox.data(),
+                              tmpChunkHitBB.LocalBox.data(), tmpChunkHitBB.LocalBox.size());
 
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], CurrentRotationMat);
-            }
-            vw_Matrix33CalcPoint(HitBB[i].Location, CurrentRotationMat);
-        }
+        tmpChunkHitBB.LocalLocation = tmpChunkHitBB.BaseOffset;
+        vw_Matrix33CalcPoint(tmpChunkHitBB.LocalLocation, tmpChunkHitBB.BaseInvRotationMat);
+        vw_Matrix33CalcPoint(tmpChunkHitBB.LocalLocation, ChunkRotationMat);
+        tmpChunkHitBB.LocalLocation += Chunks[i].Location;
+    }
 
-        OBB.Box[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-        OBB.Box[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-        OBB.Box[2] = sVECTOR3D{MinX, MaxY, MinZ};
-        OBB.Box[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-        OBB.Box[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-        OBB.Box[5] = sVECTOR3D{MinX, MinY, MaxZ};
-        OBB.Box[6] = sVECTOR3D{MinX, MinY, MinZ};
-        OBB.Box[7] = sVECTOR3D{MaxX, MinY, MinZ};
-
-        Width = fabsf(MaxX - MinX);
-        Height = fabsf(MaxY - MinY);
-        Length = fabsf(MaxZ - MinZ);
-
-        float Width2 = Width / 2.0f;
-        float Length2 = Length / 2.0f;
-        float Height2 = Height / 2.0f;
-        Radius = vw_sqrtf(Width2 * Width2 + Length2 * Length2 + Height2 * Height2);
-
-        OBB.Location.x = (MaxX + MinX) / 2.0f;
-        OBB.Location.y = (MaxY + MinY) / 2.0f;
-        OBB.Location.z = (MaxZ + MinZ) / 2.0f;
-
-        for (int k = 0; k < 8; k++) {
-            OBB.Box[k] -= OBB.Location;
-            vw_Matrix33CalcPoint(OBB.Box[k], CurrentRotationMat);
-        }
-        vw_Matrix33CalcPoint(OBB.Location, CurrentRotationMat);
-
-        MinX = MaxX = OBB.Box[0].x + OBB.Location.x;
-        MinY = MaxY = OBB.Box[0].y + OBB.Location.y;
-        MinZ = MaxZ = OBB.Box[0].z + OBB.Location.z;
-        for (int j = 0; j < 8; j++) {
-            if (MinX > OBB.Box[j].x + OBB.Location.x) {
-                MinX = OBB.Box[j].x + OBB.Location.x;
-            }
-            if (MinY > OBB.Box[j].y + OBB.Location.y) {
-                MinY = OBB.Box[j].y + OBB.Location.y;
-            }
-            if (MinZ > OBB.Box[j].z + OBB.Location.z) {
-                MinZ = OBB.Box[j].z + OBB.Location.z;
-            }
-            if (MaxX < OBB.Box[j].x + OBB.Location.x) {
-                MaxX = OBB.Box[j].x + OBB.Location.x;
-            }
-            if (MaxY < OBB.Box[j].y + OBB.Location.y) {
-                MaxY = OBB.Box[j].y + OBB.Location.y;
-            }
-            if (MaxZ < OBB.Box[j].z + OBB.Location.z) {
-                MaxZ = OBB.Box[j].z + OBB.Location.z;
-            }
+    // OBB and size in object's local space, HitBB in world space
+    sVECTOR3D Min, Max;
+    for (unsigned i = 0; i < Chunks.size(); i++) {
+        sVECTOR3D tmpMin, tmpMax;
+        vw_PointsAABB(ChunksHitBB[i].LocalBox.data(), ChunksHitBB[i].LocalBox.size(), tmpMin, tmpMax);
+        tmpMin += ChunksHitBB[i].LocalLocation;
+        tmpMax += ChunksHitBB[i].LocalLocation;
+        if (i == 0) {
+            Min = tmpMin;
+            Max = tmpMax;
+        } else {
+            Min.x = std::min(Min.x, tmpMin.x);
+            Min.y = std::min(Min.y, tmpMin.y);
+            Min.z = std::min(Min.z, tmpMin.z);
+            Max.x = std::max(Max.x, tmpMax.x);
+            Max.y = std::max(Max.y, tmpMax.y);
+            Max.z = std::max(Max.z, tmpMax.z);
         }
-        AABB[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-        AABB[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-        AABB[2] = sVECTOR3D{MinX, MaxY, MinZ};
-        AABB[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-        AABB[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-        AABB[5] = sVECTOR3D{MinX, MinY, MaxZ};
-        AABB[6] = sVECTOR3D{MinX, MinY, MinZ};
-        AABB[7] = sVECTOR3D{MaxX, MinY, MinZ};
+
+        vw_Matrix33CalcPoints(CurrentRotationMat, ChunksHitBB[i].LocalBox.data(),
+                              HitBB[i].Box.data(), HitBB[i].Box.size());
+        HitBB[i].Location = ChunksHitBB[i].LocalLocation;
+        vw_Matrix33CalcPoint(HitBB[i].Location, CurrentRotationMat);
     }
 
-    Chunks[ChunkNum].Rotation = NewRotation;
+    Width = fabsf(Max.x - Min.x);
+    Height = fabsf(Max.y - Min.y);
+    Length = fabsf(Max.z - Min.z);
+
+    float Width2 = Width / 2.0f;
+    float Length2 = Length / 2.0f;
+    float Height2 = Height / 2.0f;
+    Radius = vw_sqrtf(Width2 * Width2 + Length2 * Length2 + Height2 * Height2);
+
+    OBB.Location = (Max + Min) / 2.0f;
+    SetBoxCorners(OBB.Box, Min - OBB.Location, Max - OBB.Location);
+    vw_Matrix33CalcPoints(CurrentRotationMat, OBB.Box.data(), OBB.Box.data(), OBB.Box.size());
+    vw_Matrix33CalcPoint(OBB.Location, CurrentRotationMat);
+
+    // AABB in world space
+    vw_PointsAABB(OBB.Box.data(), OBB.Box.size(), Min, Max);
+    SetBoxCorners(AABB, Min + OBB.Location, Max + OBB.Location);
+}
+
+/*
+ * Update collision cache (inverse rotation, hit boxes half sizes and world centers), if outdated.
+ * Cache is valid till the end of simulation tick, or till next SetLocation()/SetRotation() call.
+ */
+void cObject3D::UpdateCollisionCache()
+{
+    UpdateBounds();
+
+    if (CollisionCacheStamp == SimulationTick) {
+        return;
+    }
+    CollisionCacheStamp = SimulationTick;
+
+    memcpy(CollisionCache.InvRotationMat, CurrentRotationMat, 9 * sizeof(CurrentRotationMat[0]));
+    vw_Matrix33InverseRotate(CollisionCache.InvRotationMat);
+
+    CollisionCache.HitBBHalfSize.resize(HitBB.size());
+    CollisionCache.HitBBWorldLocation.resize(HitBB.size());
+    for (unsigned i = 0; i < HitBB.size(); i++) {
+        CollisionCache.HitBBHalfSize[i] = HitBB[i].Size / 2.0f;
+        CollisionCache.HitBBWorldLocation[i] = Location + HitBB[i].Location;
+    }
 }
 
 /*
@@ -302,8 +278,31 @@ void cObject3D::SetChunkRotation(const sVECTOR3D &NewRotation, unsigned ChunkNum
  */
 void cObject3D::SetLocation(const sVECTOR3D &NewLocation)
 {
+    // object was not updated yet (just created), don't interpolate from initial location
+    if (TimeLastUpdate == -1.0f) {
+        TickStartLocation = NewLocation;
+        TickLocationStamp = SimulationTick;
+    } else if (TickLocationStamp != SimulationTick) {
+        TickStartLocation = Location;
+        TickLocationStamp = SimulationTick;
+    }
+
     PrevLocation = Location;
     Location = NewLocation;
+    CollisionCacheStamp = 0;
+}
+
+/*
+ * Location for rendering, interpolated between previous and current simulation ticks.
+ */
+sVECTOR3D cObject3D::GetDrawLocation() const
+{
+    // object was not moved during last simulation tick
+    if (TickLocationStamp != SimulationTick) {
+        return Location;
+    }
+
+    return TickStartLocation + ((Location - TickStartLocation) ^ InterpolationFactor);
 }
 
 /*
@@ -320,61 +319,31 @@ void cObject3D::SetRotation(const sVECTOR3D &NewRotation)
 
     vw_Matrix33CalcPoint(Orientation, OldInvRotationMat);
     vw_Matrix33CalcPoint(Orientation, CurrentRotationMat);
+    CollisionCacheStamp = 0;
+
+    // bounds will be recalculated with new rotation matrix on next UpdateBounds() call
+    if (BoundsDirty) {
+        return;
+    }
 
     if (!HitBB.empty()) {
         for (unsigned int i = 0; i < Chunks.size(); i++) {
             vw_Matrix33CalcPoint(HitBB[i].Location, OldInvRotationMat);
             vw_Matrix33CalcPoint(HitBB[i].Location, CurrentRotationMat);
 
-            for (int j = 0; j < 8; j++) {
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], OldInvRotationMat);
-                vw_Matrix33CalcPoint(HitBB[i].Box[j], CurrentRotationMat);
-            }
+            vw_Matrix33CalcPoints(OldInvRotationMat, HitBB[i].Box.data(), HitBB[i].Box.data(), HitBB[i].Box.size());
+            vw_Matrix33CalcPoints(CurrentRotationMat, HitBB[i].Box.data(), HitBB[i].Box.data(), HitBB[i].Box.size());
         }
     }
 
     vw_Matrix33CalcPoint(OBB.Location, OldInvRotationMat);
     vw_Matrix33CalcPoint(OBB.Location, CurrentRotationMat);
-    for (int j = 0; j < 8; j++) {
-        vw_Matrix33CalcPoint(OBB.Box[j], OldInvRotationMat);
-        vw_Matrix33CalcPoint(OBB.Box[j], CurrentRotationMat);
-    }
-
-    float MinX = 10000.0f;
-    float MaxX = -10000.0f;
-    float MinY = 10000.0f;
-    float MaxY = -10000.0f;
-    float MinZ = 10000.0f;
-    float MaxZ = -10000.0f;
-    for (int j = 0; j < 8; j++) {
-        if (MinX > OBB.Box[j].x + OBB.Location.x) {
-            MinX = OBB.Box[j].x + OBB.Location.x;
-        }
-        if (MinY > OBB.Box[j].y + OBB.Location.y) {
-            MinY = OBB.Box[j].y + OBB.Location.y;
-        }
-        if (MinZ > OBB.Box[j].z + OBB.Location.z) {
-            MinZ = OBB.Box[j].z + OBB.Location.z;
-        }
-        if (MaxX < OBB.Box[j].x + OBB.Location.x) {
-            MaxX = OBB.Box[j].x + OBB.Location.x;
-        }
-        if (MaxY < OBB.Box[j].y + OBB.Location.y) {
-            MaxY = OBB.Box[j].y + OBB.Location.y;
-        }
-        if (MaxZ < OBB.Box[j].z + OBB.Location.z) {
-            MaxZ = OBB.Box[j].z + OBB.Location.z;
-        }
-    }
-    AABB[0] = sVECTOR3D{MaxX, MaxY, MaxZ};
-    AABB[1] = sVECTOR3D{MinX, MaxY, MaxZ};
-    AABB[2] = sVECTOR3D{MinX, MaxY, MinZ};
-    AABB[3] = sVECTOR3D{MaxX, MaxY, MinZ};
-    AABB[4] = sVECTOR3D{MaxX, MinY, MaxZ};
-    AABB[5] = sVECTOR3D{MinX, MinY, MaxZ};
-    AABB[6] = sVECTOR3D{MinX, MinY, MinZ};
-    AABB[7] = sVECTOR3D{MaxX, MinY, MinZ};
+    vw_Matrix33CalcPoints(OldInvRotationMat, OBB.Box.data(), OBB.Box.data(), OBB.Box.size());
+    vw_Matrix33CalcPoints(CurrentRotationMat, OBB.Box.data(), OBB.Box.data(), OBB.Box.size());
 
+    sVECTOR3D Min, Max;
+    vw_PointsAABB(OBB.Box.data(), OBB.Box.size(), Min, Max);
+    SetBoxCorners(AABB, Min + OBB.Location, Max + OBB.Location);
 }
 
 /*
@@ -457,6 +426,26 @@ void SetObjectsBBRenderMode(eRenderBoundingBoxes Mode)
     BBRenderMode = Mode;
 }
 
+/*
+ * Start new simulation tick (should be called before objects update).
+ */
+void StartObject3DSimulationTick()
+{
+    SimulationTick++;
+    if (SimulationTick == 0) {
+        SimulationTick = 1;
+    }
+}
+
+/*
+ * Set rendering interpolation factor between previous and current simulation ticks.
+ */
+void SetObject3DInterpolationFactor(float Factor)
+{
+    vw_Clamp(Factor, 0.0f, 1.0f);
+    InterpolationFactor = Factor;
+}
+
 /*
  * Fill status draw array for line.
  */
@@ -512,6 +501,65 @@ static void DrawObjectStatus(const sVECTOR3D &Location, float Width, const sRGBC
     vw_PopMatrix();
 }
 
+/*
+ * Calculate translation and rotation matrix, same as glTranslate() + glRotate() for z, y, x axes do.
+ */
+static void CalculateTransformMatrix(float (&Matrix)[16], const sVECTOR3D &Location, const sVECTOR3D &Rotation)
+{
+    vw_Matrix44CreateRotate(Matrix, Rotation);
+    vw_Matrix44Translate(Matrix, Location);
+}
+
+/*
+ * Calculate world matrices for rendering, if transformation was changed.
+ */
+void cObject3D::UpdateDrawMatrices(const sVECTOR3D &DrawLocation)
+{
+    bool ObjectChanged{!DrawMatrixValid
+                       || (DrawMatrixLocation != DrawLocation)
+                       || (DrawMatrixRotation != Rotation)};
+    if (ObjectChanged) {
+        CalculateTransformMatrix(DrawMatrix, DrawLocation, Rotation);
+        DrawMatrixLocation = DrawLocation;
+        DrawMatrixRotation = Rotation;
+        DrawMatrixValid = true;
+    }
+
+    if (ChunksDrawMatrix.size() != Chunks.size()) {
+        ChunksDrawMatrix.clear();
+        ChunksDrawMatrix.resize(Chunks.size());
+    }
+
+    for (unsigned i = 0; i < Chunks.size(); i++) {
+        sChunkDrawMatrix &tmpMatrix = ChunksDrawMatrix[i];
+
+        bool ChunkChanged{!tmpMatrix.Valid
+                          || (tmpMatrix.Location != Chunks[i].Location)
+                          || (tmpMatrix.Rotation != Chunks[i].Rotation)
+                          || (tmpMatrix.NeedGeometryAnimation != Chunks[i].NeedGeometryAnimation)
+                          || (Chunks[i].NeedGeometryAnimation
+                              && (tmpMatrix.GeometryAnimation != Chunks[i].GeometryAnimation))};
+        if (ChunkChanged) {
+            CalculateTransformMatrix(tmpMatrix.LocalMatrix, Chunks[i].Location, Chunks[i].Rotation);
+            if (Chunks[i].NeedGeometryAnimation) {
+                float tmpGeometryAnimation[16];
+                vw_Matrix44CreateRotate(tmpGeometryAnimation, Chunks[i].GeometryAnimation);
+                vw_Matrix44Mult(tmpMatrix.LocalMatrix, tmpGeometryAnimation);
+            }
+            tmpMatrix.Location = Chunks[i].Location;
+            tmpMatrix.Rotation = Chunks[i].Rotation;
+            tmpMatrix.GeometryAnimation = Chunks[i].GeometryAnimation;
+            tmpMatrix.NeedGeometryAnimation = Chunks[i].NeedGeometryAnimation;
+            tmpMatrix.Valid = true;
+        }
+
+        if (ObjectChanged || ChunkChanged) {
+            memcpy(tmpMatrix.WorldMatrix, DrawMatrix, sizeof(DrawMatrix));
+            vw_Matrix44Mult(tmpMatrix.WorldMatrix, tmpMatrix.LocalMatrix);
+        }
+    }
+}
+
 /*
  * Draw.
  */
@@ -521,15 +569,22 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
         return;
     }
 
+    // AABB used for frustum culling
+    UpdateBounds();
+
+    sVECTOR3D DrawLocation{GetDrawLocation()};
+    UpdateDrawMatrices(DrawLocation);
+
     bool NeedOnePieceDraw{false};
-    if (PromptDrawDist2 >= 0.0f) {
+    // one piece rendering use shared 3D model's global arrays and buffers
+    if (PromptDrawDist2 >= 0.0f && Model3D) {
         sVECTOR3D CurrentCameraLocation;
         vw_GetCameraLocation(&CurrentCameraLocation);
-        float PromptDrawRealDist2 = (Location.x - CurrentCameraLocation.x) * (Location.x - CurrentCameraLocation.x) +
-                                    (Location.y - CurrentCameraLocation.y) * (Location.y - CurrentCameraLocation.y) +
-                                    (Location.z - CurrentCameraLocation.z) * (Location.z - CurrentCameraLocation.z);
+        float PromptDrawRealDist2 = (DrawLocation.x - CurrentCameraLocation.x) * (DrawLocation.x - CurrentCameraLocation.x) +
+                                    (DrawLocation.y - CurrentCameraLocation.y) * (DrawLocation.y - CurrentCameraLocation.y) +
+                                    (DrawLocation.z - CurrentCameraLocation.z) * (DrawLocation.z - CurrentCameraLocation.z);
 
-        int LightsCount = vw_CalculateAllPointLightsAttenuation(Location, Radius * Radius, nullptr);
+        int LightsCount = vw_CalculateAllPointLightsAttenuation(DrawLocation, Radius * Radius);
 
         if (PromptDrawRealDist2 > PromptDrawDist2) {
             if (LightsCount <= GameConfig().MaxPointLights) {
@@ -552,22 +607,18 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
     // make sure, we call this one _before_ any camera/frustum checks, since not visible
     // for us 3D model could also drop the shadow on visible for us part of scene
     if (VertexOnlyPass) {
-        vw_PushMatrix();
-
-        vw_Translate(Location);
-        vw_Rotate(Rotation.z, 0.0f, 0.0f, 1.0f);
-        vw_Rotate(Rotation.y, 0.0f, 1.0f, 0.0f);
-        vw_Rotate(Rotation.x, 1.0f, 0.0f, 0.0f);
-
         if (NeedOnePieceDraw) {
-            unsigned DrawVertexCount{GlobalIndexArrayCount};
+            unsigned DrawVertexCount{Model3D->GlobalIndexArrayCount};
             if (!DrawVertexCount) {
-                DrawVertexCount = GlobalVertexArrayCount;
+                DrawVertexCount = Model3D->GlobalVertexArrayCount;
             }
 
-            vw_Draw3D(ePrimitiveType::TRIANGLES, DrawVertexCount, RI_3f_XYZ, GlobalVertexArray.get(),
-                      Chunks[0].VertexStride * sizeof(float), GlobalVBO, 0,
-                      GlobalIndexArray.get(), GlobalIBO, GlobalVAO);
+            vw_PushMatrix();
+            vw_MultMatrix(DrawMatrix);
+            vw_Draw3D(ePrimitiveType::TRIANGLES, DrawVertexCount, RI_3f_XYZ, Model3D->GlobalVertexArray.get(),
+                      Model3D->Chunks[0].VertexStride * sizeof(float), Model3D->GlobalVBO, 0,
+                      Model3D->GlobalIndexArray.get(), Model3D->GlobalIBO, Model3D->GlobalVAO);
+            vw_PopMatrix();
         } else {
 
             if (ShaderType == 2) {
@@ -579,19 +630,10 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
                 }
             }
 
-            for (auto &tmpChunk : Chunks) {
+            for (unsigned i = 0; i < Chunks.size(); i++) {
+                const sChunk3D &tmpChunk = Model3D->Chunks[i];
                 vw_PushMatrix();
-
-                vw_Translate(tmpChunk.Location);
-                vw_Rotate(tmpChunk.Rotation.z, 0.0f, 0.0f, 1.0f);
-                vw_Rotate(tmpChunk.Rotation.y, 0.0f, 1.0f, 0.0f);
-                vw_Rotate(tmpChunk.Rotation.x, 1.0f, 0.0f, 0.0f);
-
-                if (tmpChunk.NeedGeometryAnimation) {
-                    vw_Rotate(tmpChunk.GeometryAnimation.z, 0.0f, 0.0f, 1.0f);
-                    vw_Rotate(tmpChunk.GeometryAnimation.y, 0.0f, 1.0f, 0.0f);
-                    vw_Rotate(tmpChunk.GeometryAnimation.x, 1.0f, 0.0f, 0.0f);
-                }
+                vw_MultMatrix(ChunksDrawMatrix[i].WorldMatrix);
 
                 vw_Draw3D(ePrimitiveType::TRIANGLES, tmpChunk.VertexQuantity, RI_3f_XYZ, tmpChunk.VertexArray.get(),
                           tmpChunk.VertexStride * sizeof(float), tmpChunk.VBO,
@@ -605,11 +647,10 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
             }
         }
 
-        vw_PopMatrix();
         return;
     }
 
-    if (!vw_BoxInFrustum(Location + AABB[6], Location + AABB[0])) {
+    if (!vw_BoxInFrustum(DrawLocation + AABB[6], DrawLocation + AABB[0])) {
         if (DeleteAfterLeaveScene == eDeleteAfterLeaveScene::showed) {
             DeleteAfterLeaveScene = eDeleteAfterLeaveScene::need_delete;
         }
@@ -629,13 +670,6 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
     float Matrix[16];
     vw_GetMatrix(eMatrixPname::MODELVIEW, Matrix);
 
-    vw_PushMatrix();
-
-    vw_Translate(Location);
-    vw_Rotate(Rotation.z, 0.0f, 0.0f, 1.0f);
-    vw_Rotate(Rotation.y, 0.0f, 1.0f, 0.0f);
-    vw_Rotate(Rotation.x, 1.0f, 0.0f, 0.0f);
-
     bool N1 = false;
     for (auto &tmpChunk : Chunks) {
         if (tmpChunk.DrawType == eModel3DDrawType::Blend) {
@@ -671,7 +705,7 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
             vw_BindTexture(3, CurrentNormalMap);
         }
 
-        vw_CheckAndActivateAllLights(Location, Radius*Radius, 1, GameConfig().MaxPointLights, Matrix);
+        vw_CheckAndActivateAllLights(DrawLocation, Radius*Radius, 1, GameConfig().MaxPointLights, Matrix);
 
         if (GameConfig().UseGLSL120) {
             std::weak_ptr<cGLSL> CurrentObject3DGLSL{};
@@ -740,14 +774,17 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
             }
         }
 
-        unsigned DrawVertexCount{GlobalIndexArrayCount};
+        unsigned DrawVertexCount{Model3D->GlobalIndexArrayCount};
         if (!DrawVertexCount) {
-            DrawVertexCount = GlobalVertexArrayCount;
+            DrawVertexCount = Model3D->GlobalVertexArrayCount;
         }
 
-        vw_Draw3D(ePrimitiveType::TRIANGLES, DrawVertexCount, Chunks[0].VertexFormat, GlobalVertexArray.get(),
-                  Chunks[0].VertexStride * sizeof(float), GlobalVBO, 0,
-                  GlobalIndexArray.get(), GlobalIBO, GlobalVAO);
+        vw_PushMatrix();
+        vw_MultMatrix(DrawMatrix);
+        vw_Draw3D(ePrimitiveType::TRIANGLES, DrawVertexCount, Model3D->Chunks[0].VertexFormat, Model3D->GlobalVertexArray.get(),
+                  Model3D->Chunks[0].VertexStride * sizeof(float), Model3D->GlobalVBO, 0,
+                  Model3D->GlobalIndexArray.get(), Model3D->GlobalIBO, Model3D->GlobalVAO);
+        vw_PopMatrix();
 
         vw_DeActivateAllLights();
     } else {
@@ -847,7 +884,7 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
                     }
                 }
 
-                if (!vw_BoxInFrustum(Location + Min, Location + Max)) {
+                if (!vw_BoxInFrustum(DrawLocation + Min, DrawLocation + Max)) {
                     continue;
                 }
             }
@@ -884,22 +921,12 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
             }
 
             vw_PushMatrix();
-
-            vw_Translate(Chunks[i].Location);
-            vw_Rotate(Chunks[i].Rotation.z, 0.0f, 0.0f, 1.0f);
-            vw_Rotate(Chunks[i].Rotation.y, 0.0f, 1.0f, 0.0f);
-            vw_Rotate(Chunks[i].Rotation.x, 1.0f, 0.0f, 0.0f);
-
-            if (Chunks[i].NeedGeometryAnimation) {
-                vw_Rotate(Chunks[i].GeometryAnimation.z, 0.0f, 0.0f, 1.0f);
-                vw_Rotate(Chunks[i].GeometryAnimation.y, 0.0f, 1.0f, 0.0f);
-                vw_Rotate(Chunks[i].GeometryAnimation.x, 1.0f, 0.0f, 0.0f);
-            }
+            vw_MultMatrix(ChunksDrawMatrix[i].WorldMatrix);
 
             if (!HitBB.empty()) {
-                vw_CheckAndActivateAllLights(Location + HitBB[i].Location, HitBB[i].Radius2, 1, GameConfig().MaxPointLights, Matrix);
+                vw_CheckAndActivateAllLights(DrawLocation + HitBB[i].Location, HitBB[i].Radius2, 1, GameConfig().MaxPointLights, Matrix);
             } else {
-                vw_CheckAndActivateAllLights(Location, Radius * Radius, 1, GameConfig().MaxPointLights, Matrix);
+                vw_CheckAndActivateAllLights(DrawLocation, Radius * Radius, 1, GameConfig().MaxPointLights, Matrix);
             }
 
             // for planet's clouds
@@ -927,9 +954,10 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
                 }
             }
 
-            vw_Draw3D(ePrimitiveType::TRIANGLES, Chunks[i].VertexQuantity, Chunks[i].VertexFormat, Chunks[i].VertexArray.get(),
-                      Chunks[i].VertexStride * sizeof(float), Chunks[i].VBO,
-                      Chunks[i].RangeStart, Chunks[i].IndexArray.get(), Chunks[i].IBO, Chunks[i].VAO);
+            const sChunk3D &tmpChunk = Model3D->Chunks[i];
+            vw_Draw3D(ePrimitiveType::TRIANGLES, tmpChunk.VertexQuantity, tmpChunk.VertexFormat, tmpChunk.VertexArray.get(),
+                      tmpChunk.VertexStride * sizeof(float), tmpChunk.VBO,
+                      tmpChunk.RangeStart, tmpChunk.IndexArray.get(), tmpChunk.IBO, tmpChunk.VAO);
 
             if (Chunks[i].DrawType == eModel3DDrawType::Blend) {
                 vw_SetTextureAlphaTest(false, eCompareFunc::ALWAYS, 0);
@@ -966,16 +994,15 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
     if (!NeedCullFaces) {
         vw_CullFace(eCullFace::BACK);
     }
-    vw_PopMatrix();
 
 #ifndef NDEBUG
     // debug info, line number in script file
     if (!ScriptLineNumberUTF32.empty()) {
-        vw_DrawText3DUTF32(Location.x, Location.y + AABB[0].y, Location.z, ScriptLineNumberUTF32);
+        vw_DrawText3DUTF32(DrawLocation.x, DrawLocation.y + AABB[0].y, DrawLocation.z, ScriptLineNumberUTF32);
     }
 #endif // NDEBUG
 
-    DrawBoundingBoxes(Location, AABB, OBB, HitBB);
+    DrawBoundingBoxes(DrawLocation, AABB, OBB, HitBB);
 
     // TODO why we need ShowStatus if we could use ArmorInitialStatus < 0.0f for this?
     if (!ShowStatus
@@ -989,10 +1016,10 @@ void cObject3D::Draw(bool VertexOnlyPass, bool ShadowMap)
     // even if shield recharged - don't hide object's status any more
     ShowStatusAllTime = true;
 
-    DrawObjectStatus(sVECTOR3D{Location.x, Location.y + AABB[0].y + 0.7f, Location.z},
+    DrawObjectStatus(sVECTOR3D{DrawLocation.x, DrawLocation.y + AABB[0].y + 0.7f, DrawLocation.z},
                      Width, sRGBCOLOR{eRGBCOLOR::red}, ArmorCurrentStatus, ArmorInitialStatus);
     if (ShieldInitialStatus > 0.0f) {
-        DrawObjectStatus(sVECTOR3D{Location.x, Location.y + AABB[0].y + 1.75f, Location.z},
+        DrawObjectStatus(sVECTOR3D{DrawLocation.x, DrawLocation.y + AABB[0].y + 1.75f, DrawLocation.z},
                          Width, sRGBCOLOR{0.1f, 0.7f, 1.0f}, ShieldCurrentStatus, ShieldInitialStatus);
     }
     vw_BindTexture(0, 0);
@@ -71,6 +71,12 @@ inline bool ObjectsStatusFoe(eObjectStatus Object1, eObjectStatus Object2)
            ((Object2 == eObjectStatus::Enemy) && ((Object1 == eObjectStatus::Ally) || (Object1 == eObjectStatus::Player)));
 }
 
+// Object's status bit for collision layers masks.
+inline unsigned ObjectStatusBit(eObjectStatus Status)
+{
+    return 1u << static_cast<unsigned>(Status);
+}
+
 enum class eObjectType {
     none,
     EarthFighter,
@@ -177,7 +183,58 @@ inline cDamage operator * (const cDamage &Damage, float Value)
     return cDamage{Damage.Kinetic() * Value, Damage.EM() * Value};
 }
 
-class cObject3D : public sModel3D {
+// Chunk's state, that could be changed by object (chunk's geometry is shared, see cObject3D::Model3D).
+struct sChunkState {
+    sVECTOR3D Location{0.0f, 0.0f, 0.0f};
+    sVECTOR3D Rotation{0.0f, 0.0f, 0.0f};
+
+    // animation (rotation)
+    bool NeedGeometryAnimation{false};
+    sVECTOR3D GeometryAnimation{0.0f, 0.0f, 0.0f};
+
+    // animation (tile animation)
+    bool NeedTextureAnimation{false};
+    sVECTOR3D TextureAnimation{0.0f, 0.0f, 0.0f};
+
+    eModel3DDrawType DrawType{eModel3DDrawType::Normal};
+};
+
+// Cached chunk's world matrix for rendering.
+struct sChunkDrawMatrix {
+    // chunk's transformation, that was used for LocalMatrix calculation
+    sVECTOR3D Location{0.0f, 0.0f, 0.0f};
+    sVECTOR3D Rotation{0.0f, 0.0f, 0.0f};
+    sVECTOR3D GeometryAnimation{0.0f, 0.0f, 0.0f};
+    bool NeedGeometryAnimation{false};
+    bool Valid{false};
+
+    float LocalMatrix[16]{};
+    float WorldMatrix[16]{};
+};
+
+// Chunk's hit box in object's local space (without object's rotation), for bounds update.
+struct sChunkHitBB {
+    // hit box for chunk's base location and rotation (chunk's location and rotation on first change)
+    bounding_box BaseBox{};
+    sVECTOR3D BaseOffset{0.0f, 0.0f, 0.0f}; // hit box location, related to chunk's location
+    float BaseInvRotationMat[9]{};
+    // hit box for chunk's current location and rotation
+    bounding_box LocalBox{};
+    sVECTOR3D LocalLocation{0.0f, 0.0f, 0.0f};
+    // chunk was moved or rotated, LocalBox and LocalLocation should be recalculated
+    bool Dirty{false};
+};
+
+// Object's data for narrow phase collision detection, constant during simulation tick.
+struct sCollisionCache {
+    float InvRotationMat[9]{1.0f, 0.0f, 0.0f,
+                            0.0f, 1.0f, 0.0f,
+                            0.0f, 0.0f, 1.0f};
+    std::vector<sVECTOR3D> HitBBHalfSize{};
+    std::vector<sVECTOR3D> HitBBWorldLocation{}; // chunks' hit boxes centers in world space
+};
+
+class cObject3D {
 protected:
     // don't allow object of this class creation
     cObject3D() = default;
@@ -189,10 +246,19 @@ public:
     bool NeedAlphaTest{false};
     virtual bool Update(float Time);
 
+    // Set shared 3D model and initialize chunks' state by model's chunks, bounds are
+    // initialized only if model's metadata was initialized (see sModel3D::MetadataInitialization()).
+    void SetModel3D(const std::shared_ptr<const sModel3D> &NewModel3D);
     void SetChunkLocation(const sVECTOR3D &NewLocation, unsigned ChunkNum);
     void SetChunkRotation(const sVECTOR3D &NewRotation, unsigned ChunkNum);
     virtual void SetLocation(const sVECTOR3D &NewLocation);
     virtual void SetRotation(const sVECTOR3D &NewRotation);
+    // Update bounds (HitBB, OBB, AABB and size), if chunks were moved or rotated since last update.
+    void UpdateBounds();
+    // Update collision cache (inverse rotation, hit boxes half sizes and world centers), if outdated.
+    void UpdateCollisionCache();
+    // Location for rendering, interpolated between previous and current simulation ticks.
+    sVECTOR3D GetDrawLocation() const;
 
     // in-game object's status relatively to player
     eObjectStatus ObjectStatus{eObjectStatus::none};
@@ -211,10 +277,32 @@ public:
     sVECTOR3D OldRotationInv{0.0f, 0.0f, 0.0f};
     sVECTOR3D Location{0.0f, 0.0f, 0.0f};
     sVECTOR3D PrevLocation{0.0f, 0.0f, 0.0f};
+    // location before first SetLocation() call in simulation tick TickLocationStamp (rendering interpolation)
+    sVECTOR3D TickStartLocation{0.0f, 0.0f, 0.0f};
+    unsigned TickLocationStamp{0};
 
     float TimeLastUpdate{-1.0f};
     float TimeDelta{0.0f};
 
+    // shared 3D model (chunks' geometry, global vertex/index arrays and buffers for one piece rendering)
+    // note, all objects are released before 3D models, so, we could hold shared_ptr here
+    std::shared_ptr<const sModel3D> Model3D{};
+    // chunks' state, same order as Model3D's chunks
+    std::vector<sChunkState> Chunks{};
+
+    // Axis-Aligned Bounding Box, coordinates are related to object's location
+    bounding_box AABB{};
+    // Oriented Bounding Box, coordinates are related to object's center
+    sOBB OBB{};
+    // Hit Bounding Box, same as OBB, but for each chunk
+    std::vector<sHitBB> HitBB{};
+    // geometry center of all vertices, related to object's location (without object's rotation)
+    sVECTOR3D GeometryCenter{0.0f, 0.0f, 0.0f};
+    float Radius{0.0f}; // Radius, for fast collisions check
+    float Width{1.0f};
+    float Length{1.0f};
+    float Height{1.0f};
+
     std::vector<GLtexture> Texture{};
     std::vector<GLtexture> TextureIllum{};
     std::vector<GLtexture> NormalMap{};
@@ -245,6 +333,26 @@ public:
                                0.0f, 1.0f, 0.0f,
                                0.0f, 0.0f, 1.0f};
 
+    // world matrices for rendering, calculated on CPU and cached while transformation is unchanged
+    // (same matrices are used by shadow map and main passes)
+    void UpdateDrawMatrices(const sVECTOR3D &DrawLocation);
+    float DrawMatrix[16]{1.0f, 0.0f, 0.0f, 0.0f,
+                         0.0f, 1.0f, 0.0f, 0.0f,
+                         0.0f, 0.0f, 1.0f, 0.0f,
+                         0.0f, 0.0f, 0.0f, 1.0f};
+    sVECTOR3D DrawMatrixLocation{0.0f, 0.0f, 0.0f};
+    sVECTOR3D DrawMatrixRotation{0.0f, 0.0f, 0.0f};
+    bool DrawMatrixValid{false};
+    std::vector<sChunkDrawMatrix> ChunksDrawMatrix{};
+
+    // chunks were moved or rotated, bounds should be updated before usage, see UpdateBounds()
+    bool BoundsDirty{false};
+    std::vector<sChunkHitBB> ChunksHitBB{};
+
+    // collision cache is valid for simulation tick CollisionCacheStamp, 0 - outdated
+    sCollisionCache CollisionCache{};
+    unsigned CollisionCacheStamp{0};
+
     std::u32string ScriptLineNumberUTF32{}; // debug info, line number in script file
 
     std::list<sTimeSheet> TimeSheetList{};
@@ -266,6 +374,10 @@ enum class eRenderBoundingBoxes : int {
 
 // Set bounding boxes render mode.
 void SetObjectsBBRenderMode(eRenderBoundingBoxes Mode);
+// Start new simulation tick (should be called before objects update).
+void StartObject3DSimulationTick();
+// Set rendering interpolation factor between previous and current simulation ticks [0.0f, 1.0f].
+void SetObject3DInterpolationFactor(float Factor);
 
 
 /*
@@ -276,6 +388,13 @@ void SetObjectsBBRenderMode(eRenderBoundingBoxes Mode);
 void DrawAllObject3D(eDrawType DrawType);
 // Update all oblect3d.
 void UpdateAllObject3D(float Time);
+// Update objects in parallel chunks (see vw_ParallelFor()), with deferred commands call
+// after parallel phase, in chunks order.
+void ParallelUpdateObject3D(unsigned Count, unsigned ChunkSize,
+                            const std::function<void (unsigned Begin, unsigned End)> &Function);
+// Defer command with side effects for other objects (weapon fire, targeting, explosion creation, etc)
+// during parallel update, outside ParallelUpdateObject3D() command is called immediately.
+void DeferObject3DCommand(std::function<void ()> &&Command);
 // Release all oblect3d.
 void ReleaseAllObject3D();
 
@@ -286,10 +405,56 @@ void ReleaseAllObject3D();
 // Проверяем все объекты на столкновение
 void DetectCollisionAllObject3D();
 
+// Collision layers statistic (projectile-object pairs, provided by broad phase).
+struct sCollisionLayersStatistic {
+    unsigned long long CheckedProjectilePairs{0};
+    unsigned long long RejectedProjectilePairs{0}; // rejected by collision layers matrix
+};
+
+// Mask of projectile's statuses (see ObjectStatusBit()), that could collide with object (collision layers matrix).
+unsigned ProjectileCollisionMask(const cObject3D &Object);
+// Get collision layers statistic, accumulated since last ResetCollisionLayersStatistic() call.
+const sCollisionLayersStatistic &GetCollisionLayersStatistic();
+// Reset collision layers statistic.
+void ResetCollisionLayersStatistic();
+
+/*
+ * object3d_index
+ */
+
+// Objects spatial index groups (objects are indexed and provided in this order).
+enum class eObject3DIndexGroup {
+    Flare,
+    GroundObject,
+    SpaceShip,
+    SpaceObject
+};
+
+// Invalidate objects spatial index, index will be rebuilt on next query.
+void InvalidateObject3DIndex();
+// Cycle for each indexed object, that could overlap box (world space), in eObject3DIndexGroup order.
+// Note, object is locked during callback function call, so, it could be released in callback.
+void ForEachObject3DInBox(const sVECTOR3D &Min, const sVECTOR3D &Max,
+                          std::function<void (cObject3D &Object,
+                                              const std::weak_ptr<cObject3D> &ObjectPtr,
+                                              eObject3DIndexGroup Group)> function);
+// Cycle for each indexed object, that have location inside sphere (world space), in eObject3DIndexGroup order.
+// Note, object is locked during callback function call, so, it could be released in callback.
+void ForEachObject3DInSphere(const sVECTOR3D &Center, float Radius,
+                             std::function<void (cObject3D &Object,
+                                                 const std::weak_ptr<cObject3D> &ObjectPtr,
+                                                 eObject3DIndexGroup Group)> function);
+// Get objects spatial index query statistic, accumulated since last ResetObject3DIndexStatistic() call.
+const sUniformGridStatistic &GetObject3DIndexStatistic();
+// Reset objects spatial index query statistic.
+void ResetObject3DIndexStatistic();
+
 /*
  * object3d_functions
  */
 
+// Check for "mortal" objects type, that could be used for collision detection.
+bool NeedCheckCollision(eObjectType ObjectType);
 // Check for "mortal" objects, that could be used for collision detection.
 bool NeedCheckCollision(const cObject3D &Object3D);
 // Load 3D model data.
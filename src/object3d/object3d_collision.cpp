@@ -33,6 +33,7 @@
 #include "../assets/audio.h"
 #include "../game/camera.h"
 #include "../game/hud.h"
+#include "../ui/profiler.h"
 #include "space_ship/space_ship.h"
 #include "ground_object/ground_object.h"
 #include "projectile/projectile.h"
@@ -66,6 +67,19 @@ extern float ShildEnergyStatus;
 extern float ShildStartHitStatus;
 extern int PlayerDeadObjectPieceNum;
 
+namespace {
+
+constexpr unsigned ObjectStatusCount{static_cast<unsigned>(eObjectStatus::Player) + 1};
+constexpr unsigned ObjectTypeCount{static_cast<unsigned>(eObjectType::BigAsteroid) + 1};
+
+// collision layers matrix, [object's status][object's type] -> mask of projectile's statuses
+// (see ObjectStatusBit()), that could collide with object
+using projectile_collision_layers = std::array<std::array<unsigned, ObjectTypeCount>, ObjectStatusCount>;
+
+sCollisionLayersStatistic CollisionLayersStatistic{};
+
+} // unnamed namespace
+
 
 /*
  * Calculate bonus and experience for killed enemy.
@@ -246,7 +260,7 @@ static bool CheckDistanceBetweenPoints(const sVECTOR3D &Point1, const sVECTOR3D
  * Damage all near objects by shock wave.
  */
 static void DamageAllNearObjectsByShockWave(const cObject3D &DontTouchObject, const sVECTOR3D &Epicenter,
-        float Radius2, float Damage, eObjectStatus ExplosionStatus)
+        float Radius, float Damage, eObjectStatus ExplosionStatus)
 {
     // FIXME
     // we don't destroy projectiles (missiles/bombs/torpedos) since we could have an issue with
@@ -255,60 +269,71 @@ static void DamageAllNearObjectsByShockWave(const cObject3D &DontTouchObject, co
 
     // reduce shock wave damage to 75%, let bomb's/torpedo's hit damage more than shock wave
     Damage = Damage * 0.75f;
-    // we need take into account distance factor for damage calculation
-    float Distance2Factor;
-
-    ForEachSpaceObject([&] (cSpaceObject &tmpSpace, eSpaceCycle &SpaceCycleCommand) {
-        if (NeedCheckCollision(tmpSpace)
-            && ObjectsStatusFoe(ExplosionStatus, tmpSpace.ObjectStatus)
-            && &DontTouchObject != &tmpSpace
-            && CheckDistanceBetweenPoints(tmpSpace.Location, Epicenter, Radius2, Distance2Factor)) {
+    float Radius2 = Radius * Radius;
+
+    // note, index lock object during callback call, so, we could release it inside callback
+    ForEachObject3DInSphere(Epicenter, Radius, [&] (cObject3D &tmpObject,
+                                                    const std::weak_ptr<cObject3D> &ObjectPtr,
+                                                    eObject3DIndexGroup Group) {
+        if (Group == eObject3DIndexGroup::Flare
+            || !NeedCheckCollision(tmpObject)
+            || !ObjectsStatusFoe(ExplosionStatus, tmpObject.ObjectStatus)
+            || &DontTouchObject == &tmpObject) {
+            return;
+        }
+
+        // we need take into account distance factor for damage calculation
+        float Distance2Factor;
+        if (!CheckDistanceBetweenPoints(tmpObject.Location, Epicenter, Radius2, Distance2Factor)) {
+            return;
+        }
+
+        switch (Group) {
+        case eObject3DIndexGroup::SpaceObject: {
             // debris is a part of scene, don't let them all explode by only one shock wave
-            if (tmpSpace.ObjectType == eObjectType::SpaceDebris && vw_fRand() > 0.5f) {
-                return; // eSpaceCycle::Continue;
+            if (tmpObject.ObjectType == eObjectType::SpaceDebris && vw_fRand() > 0.5f) {
+                return;
             }
 
-            tmpSpace.ArmorCurrentStatus -= Damage * (1.0f - Distance2Factor);
+            tmpObject.ArmorCurrentStatus -= Damage * (1.0f - Distance2Factor);
 
-            if (tmpSpace.ArmorCurrentStatus <= 0.0f) {
-                AddBonusForKilledEnemy(tmpSpace, ExplosionStatus);
-                SetupSpaceExplosion(tmpSpace);
-                SpaceCycleCommand = eSpaceCycle::DeleteObjectAndContinue;
+            if (tmpObject.ArmorCurrentStatus <= 0.0f) {
+                AddBonusForKilledEnemy(tmpObject, ExplosionStatus);
+                SetupSpaceExplosion(static_cast<cSpaceObject&>(tmpObject));
+                std::weak_ptr<cSpaceObject> tmpSpace = std::static_pointer_cast<cSpaceObject>(ObjectPtr.lock());
+                ReleaseSpaceObject(tmpSpace);
             }
         }
-    });
-
-    ForEachSpaceShip([&] (cSpaceShip &tmpShip, eShipCycle &ShipCycleCommand) {
-        if (NeedCheckCollision(tmpShip)
-            && ObjectsStatusFoe(ExplosionStatus, tmpShip.ObjectStatus)
-            && &DontTouchObject != &tmpShip
-            && CheckDistanceBetweenPoints(tmpShip.Location, Epicenter, Radius2, Distance2Factor)) {
+        break;
 
-            tmpShip.ShieldCurrentStatus = 0.0f; // EMP with bomb/torpedo explosion should reduce shields to 0
-            tmpShip.ArmorCurrentStatus -= Damage * (1.0f - Distance2Factor);
+        case eObject3DIndexGroup::SpaceShip: {
+            tmpObject.ShieldCurrentStatus = 0.0f; // EMP with bomb/torpedo explosion should reduce shields to 0
+            tmpObject.ArmorCurrentStatus -= Damage * (1.0f - Distance2Factor);
 
-            if (tmpShip.ArmorCurrentStatus <= 0.0f && tmpShip.ObjectStatus != eObjectStatus::Player) {
-                AddBonusForKilledEnemy(tmpShip, ExplosionStatus);
-                SetupSpaceShipExplosion(tmpShip, -1);
-                ShipCycleCommand = eShipCycle::DeleteObjectAndContinue;
+            if (tmpObject.ArmorCurrentStatus <= 0.0f && tmpObject.ObjectStatus != eObjectStatus::Player) {
+                AddBonusForKilledEnemy(tmpObject, ExplosionStatus);
+                SetupSpaceShipExplosion(static_cast<cSpaceShip&>(tmpObject), -1);
+                std::weak_ptr<cSpaceShip> tmpShip = std::static_pointer_cast<cSpaceShip>(ObjectPtr.lock());
+                ReleaseSpaceShip(tmpShip);
             }
         }
-    });
-
-    ForEachGroundObject([&] (cGroundObject &tmpGround, eGroundCycle &GroundCycleCommand) {
-        if (NeedCheckCollision(tmpGround)
-            && ObjectsStatusFoe(ExplosionStatus, tmpGround.ObjectStatus)
-            && &DontTouchObject != &tmpGround
-            && CheckDistanceBetweenPoints(tmpGround.Location, Epicenter, Radius2, Distance2Factor)) {
+        break;
 
-            tmpGround.ArmorCurrentStatus -= Damage * (1.0f - Distance2Factor);
+        case eObject3DIndexGroup::GroundObject: {
+            tmpObject.ArmorCurrentStatus -= Damage * (1.0f - Distance2Factor);
 
-            if (tmpGround.ArmorCurrentStatus <= 0.0f) {
-                AddBonusForKilledEnemy(tmpGround, ExplosionStatus);
-                SetupGroundExplosion(tmpGround, -1);
-                GroundCycleCommand = eGroundCycle::DeleteObjectAndContinue;
+            if (tmpObject.ArmorCurrentStatus <= 0.0f) {
+                AddBonusForKilledEnemy(tmpObject, ExplosionStatus);
+                SetupGroundExplosion(static_cast<cGroundObject&>(tmpObject), -1);
+                std::weak_ptr<cGroundObject> tmpGround = std::static_pointer_cast<cGroundObject>(ObjectPtr.lock());
+                ReleaseGroundObject(tmpGround);
             }
         }
+        break;
+
+        case eObject3DIndexGroup::Flare:
+            break;
+        }
     });
 }
 
@@ -365,6 +390,52 @@ static bool InteractWithPlayerDeflector(eObjectStatus ObjectStatus, cProjectile
     return false;
 }
 
+/*
+ * Create collision layers matrix for projectiles.
+ * Projectile could collide with foe's objects, and with any "immortal" objects (planets,
+ * buildings, etc), that just stop projectile.
+ */
+static projectile_collision_layers CreateProjectileCollisionLayers()
+{
+    projectile_collision_layers Layers{};
+    for (unsigned ObjectStatus = 0; ObjectStatus < ObjectStatusCount; ObjectStatus++) {
+        for (unsigned ObjectType = 0; ObjectType < ObjectTypeCount; ObjectType++) {
+            for (unsigned ProjectileStatus = 0; ProjectileStatus < ObjectStatusCount; ProjectileStatus++) {
+                if (ObjectsStatusFoe(static_cast<eObjectStatus>(ObjectStatus), static_cast<eObjectStatus>(ProjectileStatus))
+                    || !NeedCheckCollision(static_cast<eObjectType>(ObjectType))) {
+                    Layers[ObjectStatus][ObjectType] |= ObjectStatusBit(static_cast<eObjectStatus>(ProjectileStatus));
+                }
+            }
+        }
+    }
+    return Layers;
+}
+
+/*
+ * Mask of projectile's statuses (see ObjectStatusBit()), that could collide with object (collision layers matrix).
+ */
+unsigned ProjectileCollisionMask(const cObject3D &Object)
+{
+    static const projectile_collision_layers Layers{CreateProjectileCollisionLayers()};
+    return Layers[static_cast<unsigned>(Object.ObjectStatus)][static_cast<unsigned>(Object.ObjectType)];
+}
+
+/*
+ * Get collision layers statistic, accumulated since last ResetCollisionLayersStatistic() call.
+ */
+const sCollisionLayersStatistic &GetCollisionLayersStatistic()
+{
+    return CollisionLayersStatistic;
+}
+
+/*
+ * Reset collision layers statistic.
+ */
+void ResetCollisionLayersStatistic()
+{
+    CollisionLayersStatistic = sCollisionLayersStatistic{};
+}
+
 /*
  * Detect projectile collision.
  */
@@ -372,9 +443,10 @@ static bool InteractWithPlayerDeflector(eObjectStatus ObjectStatus, cProjectile
 static bool DetectProjectileCollision(const cObject3D &Object, int &ObjectPieceNum, cProjectile &Projectile,
                                       cDamage &Damage, float ObjectSpeed)
 {
-    if (!ObjectsStatusFoe(Object.ObjectStatus, Projectile.ObjectStatus) && NeedCheckCollision(Object)) {
+    if (!(ProjectileCollisionMask(Object) & ObjectStatusBit(Projectile.ObjectStatus))) {
         return false;
     }
+    CollisionLayersStatistic.CheckedProjectilePairs++;
 
     if (Object.ObjectStatus == eObjectStatus::Player) {
         ObjectSpeed += GetCameraSpeed();
@@ -440,12 +512,12 @@ static bool DetectProjectileCollision(const cObject3D &Object, int &ObjectPieceN
                 switch (Projectile.Num) {
                 case 18: // torpedo
                 case 209: // pirate torpedo
-                    DamageAllNearObjectsByShockWave(Object, Projectile.Location, 75.0f * 75.0f,
+                    DamageAllNearObjectsByShockWave(Object, Projectile.Location, 75.0f,
                                                     Projectile.Damage.Kinetic(), Projectile.ObjectStatus);
                     break;
                 case 19: // bomb
                 case 210: // pirate bomb
-                    DamageAllNearObjectsByShockWave(Object, Projectile.Location, 150.0f * 150.0f,
+                    DamageAllNearObjectsByShockWave(Object, Projectile.Location, 150.0f,
                                                     Projectile.Damage.Kinetic(), Projectile.ObjectStatus);
                     break;
                 default:
@@ -490,13 +562,64 @@ static bool DetectProjectileCollision(const cObject3D &Object, int &ObjectPieceN
     return false;
 }
 
+/*
+ * Calculate object's broad phase box (world space) for projectile collision detection.
+ */
+static void GetObjectBroadPhaseBox(const cObject3D &Object, sVECTOR3D &Min, sVECTOR3D &Max)
+{
+    Min = sVECTOR3D{Object.Location.x - Object.Radius,
+                    Object.Location.y - Object.Radius,
+                    Object.Location.z - Object.Radius};
+    Max = sVECTOR3D{Object.Location.x + Object.Radius,
+                    Object.Location.y + Object.Radius,
+                    Object.Location.z + Object.Radius};
+}
+
+/*
+ * Calculate space ship's broad phase box (world space) for projectile collision detection.
+ */
+static void GetSpaceShipBroadPhaseBox(const cSpaceShip &SpaceShip, sVECTOR3D &Min, sVECTOR3D &Max)
+{
+    GetObjectBroadPhaseBox(SpaceShip, Min, Max);
+
+    // player's ship weapons also should be checked with projectiles
+    if (SpaceShip.ObjectStatus != eObjectStatus::Player) {
+        return;
+    }
+
+    sVECTOR3D WeaponMin;
+    sVECTOR3D WeaponMax;
+    for (auto &tmpWeaponSlot : SpaceShip.WeaponSlots) {
+        if (auto sharedWeapon = tmpWeaponSlot.Weapon.lock()) {
+            GetObjectBroadPhaseBox(*sharedWeapon, WeaponMin, WeaponMax);
+            Min = sVECTOR3D{std::min(Min.x, WeaponMin.x), std::min(Min.y, WeaponMin.y), std::min(Min.z, WeaponMin.z)};
+            Max = sVECTOR3D{std::max(Max.x, WeaponMax.x), std::max(Max.y, WeaponMax.y), std::max(Max.z, WeaponMax.z)};
+        }
+    }
+}
+
 /*
  * Collision detection for all 3D objects.
  */
 void DetectCollisionAllObject3D()
 {
+    PROFILER_ZONE("DetectCollisionAllObject3D");
+
+    // projectiles don't move during collision detection, build broad phase once
+    BuildProjectileBroadPhase();
+
+    // ground objects move and rotate chunks (turrets, wheels, etc), update their bounds once
+    ForEachGroundObject([] (cGroundObject &tmpGround) {
+        tmpGround.UpdateBounds();
+    });
+
     ForEachSpaceShip([] (cSpaceShip &tmpShip, eShipCycle &ShipCycleCommand) {
-        ForEachProjectile([&tmpShip, &ShipCycleCommand] (cProjectile &tmpProjectile, eProjectileCycle &ProjectileCycleCommand) {
+        sVECTOR3D Min;
+        sVECTOR3D Max;
+        GetSpaceShipBroadPhaseBox(tmpShip, Min, Max);
+
+        // note, player's ship weapons are checked with enemy projectiles only, that are included into ship's mask
+        unsigned RejectedProjectiles = ForEachProjectileInBox(Min, Max, ProjectileCollisionMask(tmpShip), [&tmpShip, &ShipCycleCommand] (cProjectile &tmpProjectile, eProjectileCycle &ProjectileCycleCommand) {
             cDamage Damage;
             int ObjectPieceNum;
 
@@ -614,6 +737,7 @@ void DetectCollisionAllObject3D()
                 }
             }
         });
+        CollisionLayersStatistic.RejectedProjectilePairs += RejectedProjectiles;
         if (ShipCycleCommand == eShipCycle::DeleteObjectAndContinue) {
             return;
         }
@@ -798,7 +922,11 @@ void DetectCollisionAllObject3D()
     });
 
     ForEachGroundObject([] (cGroundObject &tmpGround, eGroundCycle &GroundCycleCommand) {
-        ForEachProjectile([&tmpGround, &GroundCycleCommand] (cProjectile &tmpProjectile, eProjectileCycle &ProjectileCycleCommand) {
+        sVECTOR3D Min;
+        sVECTOR3D Max;
+        GetObjectBroadPhaseBox(tmpGround, Min, Max);
+
+        unsigned RejectedProjectiles = ForEachProjectileInBox(Min, Max, ProjectileCollisionMask(tmpGround), [&tmpGround, &GroundCycleCommand] (cProjectile &tmpProjectile, eProjectileCycle &ProjectileCycleCommand) {
             cDamage Damage;
             int ObjectPieceNum;
 
@@ -834,6 +962,7 @@ void DetectCollisionAllObject3D()
                 }
             }
         });
+        CollisionLayersStatistic.RejectedProjectilePairs += RejectedProjectiles;
         if (GroundCycleCommand == eGroundCycle::DeleteObjectAndContinue) {
             return;
         }
@@ -889,7 +1018,11 @@ void DetectCollisionAllObject3D()
     });
 
     ForEachSpaceObject([] (cSpaceObject &tmpSpace, eSpaceCycle &SpaceCycleCommand) {
-        ForEachProjectile([&tmpSpace, &SpaceCycleCommand] (cProjectile &tmpProjectile, eProjectileCycle &ProjectileCycleCommand) {
+        sVECTOR3D Min;
+        sVECTOR3D Max;
+        GetObjectBroadPhaseBox(tmpSpace, Min, Max);
+
+        unsigned RejectedProjectiles = ForEachProjectileInBox(Min, Max, ProjectileCollisionMask(tmpSpace), [&tmpSpace, &SpaceCycleCommand] (cProjectile &tmpProjectile, eProjectileCycle &ProjectileCycleCommand) {
             cDamage Damage;
             int ObjectPieceNum;
 
@@ -925,6 +1058,7 @@ void DetectCollisionAllObject3D()
                 }
             }
         });
+        CollisionLayersStatistic.RejectedProjectilePairs += RejectedProjectiles;
     });
 
     ForEachSpaceObjectPair([] (cSpaceObject &FirstObject, cSpaceObject &SecondObject, eSpacePairCycle &Command) {
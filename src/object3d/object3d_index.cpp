@@ -0,0 +1,190 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+// NOTE in case of new indexed objects type, make sure eObject3DIndexGroup updated
+
+#include "object3d.h"
+#include "space_ship/space_ship.h"
+#include "ground_object/ground_object.h"
+#include "space_object/space_object.h"
+#include "projectile/projectile.h"
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+namespace {
+
+// objects could be moved after index build in current simulation tick
+// (for example, space objects are updated after projectiles), this margin
+// should cover objects movement during one simulation tick
+constexpr float IndexMargin{10.0f};
+
+struct sIndexedObject {
+    std::weak_ptr<cObject3D> Object;
+    eObject3DIndexGroup Group;
+};
+
+// targeting queries could be big, use coarse level
+cUniformGrid IndexGrid{50.0f, true};
+// grid's box index -> object
+std::vector<sIndexedObject> IndexedObjects{};
+bool IndexValid{false};
+std::vector<unsigned> IndexCandidates{};
+
+} // unnamed namespace
+
+
+/*
+ * Add object into index.
+ */
+static void AddToIndex(const std::weak_ptr<cObject3D> &ObjectPtr, eObject3DIndexGroup Group,
+                       const sVECTOR3D &Min, const sVECTOR3D &Max)
+{
+    IndexGrid.Add(sVECTOR3D{Min.x - IndexMargin, Min.y - IndexMargin, Min.z - IndexMargin},
+                  sVECTOR3D{Max.x + IndexMargin, Max.y + IndexMargin, Max.z + IndexMargin});
+    IndexedObjects.push_back(sIndexedObject{ObjectPtr, Group});
+}
+
+/*
+ * Add object with AABB into index.
+ */
+static void AddToIndex(const cObject3D &Object, const std::weak_ptr<cObject3D> &ObjectPtr, eObject3DIndexGroup Group)
+{
+    // note, AABB[0] - max point, AABB[6] - min point, make sure, that object's location
+    // is inside box, since usually, object's location used for targeting
+    AddToIndex(ObjectPtr, Group,
+               sVECTOR3D{Object.Location.x + std::min(Object.AABB[6].x, 0.0f),
+                         Object.Location.y + std::min(Object.AABB[6].y, 0.0f),
+                         Object.Location.z + std::min(Object.AABB[6].z, 0.0f)},
+               sVECTOR3D{Object.Location.x + std::max(Object.AABB[0].x, 0.0f),
+                         Object.Location.y + std::max(Object.AABB[0].y, 0.0f),
+                         Object.Location.z + std::max(Object.AABB[0].z, 0.0f)});
+}
+
+/*
+ * Build objects spatial index.
+ */
+static void BuildObject3DIndex()
+{
+    IndexGrid.Clear();
+    IndexedObjects.clear();
+
+    // make sure, that objects are added in eObject3DIndexGroup order
+    ForEachProjectile([] (const cProjectile &tmpProjectile) {
+        if (tmpProjectile.ProjectileType == 3) { // flares
+            sVECTOR3D tmpRadius{tmpProjectile.Radius, tmpProjectile.Radius, tmpProjectile.Radius};
+            AddToIndex(GetProjectilePtr(tmpProjectile), eObject3DIndexGroup::Flare,
+                       tmpProjectile.Location - tmpRadius, tmpProjectile.Location + tmpRadius);
+        }
+    });
+    ForEachGroundObjectPtr([] (cGroundObject &tmpGround, const std::weak_ptr<cObject3D> &ObjectPtr) {
+        tmpGround.UpdateBounds();
+        AddToIndex(tmpGround, ObjectPtr, eObject3DIndexGroup::GroundObject);
+    });
+    ForEachSpaceShipPtr([] (const cSpaceShip &tmpShip, const std::weak_ptr<cObject3D> &ObjectPtr) {
+        AddToIndex(tmpShip, ObjectPtr, eObject3DIndexGroup::SpaceShip);
+    });
+    ForEachSpaceObjectPtr([] (const cSpaceObject &tmpSpace, const std::weak_ptr<cObject3D> &ObjectPtr) {
+        AddToIndex(tmpSpace, ObjectPtr, eObject3DIndexGroup::SpaceObject);
+    });
+
+    IndexGrid.Build();
+    IndexValid = true;
+}
+
+/*
+ * Invalidate objects spatial index, index will be rebuilt on next query.
+ */
+void InvalidateObject3DIndex()
+{
+    IndexValid = false;
+}
+
+/*
+ * Cycle for each indexed object, that could overlap box (world space).
+ * Note, object is locked during callback function call, so, it could be released in callback.
+ */
+void ForEachObject3DInBox(const sVECTOR3D &Min, const sVECTOR3D &Max,
+                          std::function<void (cObject3D &Object,
+                                              const std::weak_ptr<cObject3D> &ObjectPtr,
+                                              eObject3DIndexGroup Group)> function)
+{
+    if (!IndexValid) {
+        BuildObject3DIndex();
+    }
+
+    // since grid's boxes were added in groups order, sorted result provide same order
+    IndexGrid.Query(Min, Max, IndexCandidates);
+    for (auto &tmpIndex : IndexCandidates) {
+        const sIndexedObject &tmpObject = IndexedObjects[tmpIndex];
+        // object could be already released
+        if (auto sharedObject = tmpObject.Object.lock()) {
+            function(*sharedObject, tmpObject.Object, tmpObject.Group);
+        }
+    }
+}
+
+/*
+ * Cycle for each indexed object, that have location inside sphere (world space).
+ * Note, object is locked during callback function call, so, it could be released in callback.
+ */
+void ForEachObject3DInSphere(const sVECTOR3D &Center, float Radius,
+                             std::function<void (cObject3D &Object,
+                                                 const std::weak_ptr<cObject3D> &ObjectPtr,
+                                                 eObject3DIndexGroup Group)> function)
+{
+    float Radius2 = Radius * Radius;
+
+    ForEachObject3DInBox(sVECTOR3D{Center.x - Radius, Center.y - Radius, Center.z - Radius},
+                         sVECTOR3D{Center.x + Radius, Center.y + Radius, Center.z + Radius},
+                         [&] (cObject3D &Object, const std::weak_ptr<cObject3D> &ObjectPtr, eObject3DIndexGroup Group) {
+        sVECTOR3D tmpDistance = Object.Location - Center;
+        if (tmpDistance.x * tmpDistance.x + tmpDistance.y * tmpDistance.y + tmpDistance.z * tmpDistance.z <= Radius2) {
+            function(Object, ObjectPtr, Group);
+        }
+    });
+}
+
+/*
+ * Get objects spatial index query statistic, accumulated since last ResetObject3DIndexStatistic() call.
+ */
+const sUniformGridStatistic &GetObject3DIndexStatistic()
+{
+    return IndexGrid.Statistic();
+}
+
+/*
+ * Reset objects spatial index query statistic.
+ */
+void ResetObject3DIndexStatistic()
+{
+    IndexGrid.ResetStatistic();
+}
+
+} // astromenace namespace
+} // viewizard namespace
@@ -32,6 +32,7 @@
 #include "../game.h"
 #include "../config/config.h"
 #include "../assets/texture.h"
+#include "../ui/profiler.h"
 #include "space_ship/space_ship.h"
 #include "ground_object/ground_object.h"
 #include "space_object/space_object.h"
@@ -50,6 +51,12 @@ namespace {
 float DrawBuffer[16]; // RI_2f_XY | RI_2f_TEX = (2 + 2) * 4 vertices = 16
 unsigned int DrawBufferCurrentPosition{0};
 
+// deferred commands buffers for parallel update, one buffer per chunk, so, we don't need
+// any locks and could call commands in objects order, note, we don't release buffers memory
+std::vector<std::vector<std::function<void ()>>> CommandBuffers{};
+// current thread's chunk buffer, nullptr outside parallel update
+thread_local std::vector<std::function<void ()>> *CurrentCommandBuffer{nullptr};
+
 } // unnamed namespace
 
 /*
@@ -108,6 +115,11 @@ static void ApplyBrightness()
  */
 void DrawAllObject3D(eDrawType DrawType)
 {
+    PROFILER_ZONE("DrawAllObject3D");
+
+    // lights could be moved during update, make sure bins are actual
+    vw_UpdatePointLightsBins();
+
     vw_DepthTest(true, eCompareFunc::LEQUAL);
 
     bool ShadowMap{false};
@@ -154,11 +166,63 @@ void DrawAllObject3D(eDrawType DrawType)
     ApplyBrightness();
 }
 
+/*
+ * Update objects in parallel chunks, with deferred commands call after parallel phase.
+ */
+void ParallelUpdateObject3D(unsigned Count, unsigned ChunkSize,
+                            const std::function<void (unsigned Begin, unsigned End)> &Function)
+{
+    if (!ChunkSize) {
+        ChunkSize = 1;
+    }
+    unsigned ChunksCount = (Count + ChunkSize - 1) / ChunkSize;
+    if (CommandBuffers.size() < ChunksCount) {
+        CommandBuffers.resize(ChunksCount);
+    }
+
+    // note, vw_ParallelFor() could call Function for whole range at once,
+    // in this case all commands will be stored into first chunk's buffer
+    vw_ParallelFor(Count, ChunkSize, [&Function, ChunkSize] (unsigned Begin, unsigned End) {
+        CurrentCommandBuffer = &CommandBuffers[Begin / ChunkSize];
+        Function(Begin, End);
+        CurrentCommandBuffer = nullptr;
+    });
+
+    // call deferred commands in chunks order, that is the same as objects order
+    for (unsigned i = 0; i < ChunksCount; i++) {
+        for (auto &tmpCommand : CommandBuffers[i]) {
+            tmpCommand();
+        }
+        CommandBuffers[i].clear();
+    }
+}
+
+/*
+ * Defer command with side effects for other objects during parallel update.
+ */
+void DeferObject3DCommand(std::function<void ()> &&Command)
+{
+    if (!CurrentCommandBuffer) {
+        Command();
+        return;
+    }
+
+    CurrentCommandBuffer->emplace_back(std::move(Command));
+}
+
 /*
  * Update all oblect3d.
  */
 void UpdateAllObject3D(float Time)
 {
+    PROFILER_ZONE("UpdateAllObject3D");
+
+    StartObject3DSimulationTick();
+    InvalidateObject3DIndex();
+    // space ships, ground objects and projectiles are updated in parallel, all weapon fire,
+    // targeting and explosions creation are deferred and called in objects order after each
+    // group update (see ParallelUpdateObject3D()), weapons and space objects create particle
+    // systems during update, so, they are updated one by one
     UpdateAllSpaceShip(Time);
     UpdateAllGroundObjects(Time);
     // make sure this called after SpaceShip and GroundObject, since we need
@@ -167,6 +231,9 @@ void UpdateAllObject3D(float Time)
     UpdateAllProjectile(Time);
     UpdateAllSpaceObject(Time);
     UpdateAllExplosion(Time);
+    // all objects were moved, make sure index will be rebuilt for missiles targeting
+    // and explosions' shockwave queries
+    InvalidateObject3DIndex();
 }
 
 /*
@@ -180,6 +247,7 @@ void ReleaseAllObject3D()
     ReleaseAllProjectiles();
     ReleaseAllSpaceObjects();
     ReleaseAllExplosions();
+    InvalidateObject3DIndex();
 }
 
 } // astromenace namespace
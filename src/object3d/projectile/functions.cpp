@@ -42,6 +42,45 @@ constexpr float RadToDeg = 180.0f / 3.14159f; // convert radian to degree
 } // unnamed namespace
 
 
+/*
+ * Calculate box, that contain half of the ball (ball's part ahead of Direction).
+ * Note, Direction should be normalized.
+ */
+static void GetHalfBallBox(const sVECTOR3D &Center, const sVECTOR3D &Direction, float Radius,
+                           sVECTOR3D &Min, sVECTOR3D &Max)
+{
+    // for each axis, half-ball reach full radius in direction's side only,
+    // on the other side it limited by the edge of the base circle
+    auto AxisRange = [Radius] (float CenterCoord, float DirectionCoord, float &MinCoord, float &MaxCoord) {
+        float tmpEdge = Radius * vw_sqrtf(std::max(1.0f - DirectionCoord * DirectionCoord, 0.0f));
+        MinCoord = CenterCoord - ((DirectionCoord > 0.0f) ? tmpEdge : Radius);
+        MaxCoord = CenterCoord + ((DirectionCoord < 0.0f) ? tmpEdge : Radius);
+    };
+
+    AxisRange(Center.x, Direction.x, Min.x, Max.x);
+    AxisRange(Center.y, Direction.y, Min.y, Max.y);
+    AxisRange(Center.z, Direction.z, Min.z, Max.z);
+}
+
+/*
+ * Get targeting priority factor for objects group (see FindTargetAndInterceptCourse()).
+ */
+static float GroupDistanceFactor(eObject3DIndexGroup Group)
+{
+    switch (Group) {
+    case eObject3DIndexGroup::Flare:
+        return 1.0f;
+    case eObject3DIndexGroup::GroundObject:
+        return 3.0f;
+    case eObject3DIndexGroup::SpaceShip:
+        return 6.0f;
+    case eObject3DIndexGroup::SpaceObject:
+        return 10.0f;
+    }
+
+    return 1.0f;
+}
+
 /*
  * Find missile target and target intercept course for missile.
  */
@@ -127,52 +166,53 @@ FindTargetAndInterceptCourse(eObjectStatus MissileObjectStatus, const sVECTOR3D
         return true;
     };
 
-    ForEachProjectile([&] (const cProjectile &tmpProjectile) {
-        if (tmpProjectile.ProjectileType == 3 // flares
-            && NeedCheckCollision(tmpProjectile)
-            && ObjectsStatusFoe(MissileObjectStatus, tmpProjectile.ObjectStatus)
-            && CheckObjectLocation(tmpProjectile.Location)) {
-            LockedTarget = GetProjectilePtr(tmpProjectile);
+    // missile's "targeting" zone is limited by half-space ahead of missile and by sphere with
+    // max possible distance to target, query index only for objects in this half-ball's box
+    float SearchRadius = std::min(MaxMissileFlyDistance, vw_sqrtf(tmpDistanceToLockedTarget2));
+    sVECTOR3D SearchMin, SearchMax;
+    GetHalfBallBox(MissileLocation, Orientation, SearchRadius, SearchMin, SearchMax);
+
+    // note, index provide objects in groups order (flares, ground objects, space ships, space objects)
+    eObject3DIndexGroup CurrentGroup{eObject3DIndexGroup::Flare};
+    ForEachObject3DInBox(SearchMin, SearchMax, [&] (cObject3D &tmpObject,
+                                                    const std::weak_ptr<cObject3D> &ObjectPtr,
+                                                    eObject3DIndexGroup Group) {
+        if (Group != CurrentGroup) {
+            CurrentGroup = Group;
+            if (!LockedTarget.expired()) {
+                tmpDistanceFactorByObjectType = GroupDistanceFactor(Group);
+            }
         }
-    });
 
-    if (!LockedTarget.expired()) {
-        tmpDistanceFactorByObjectType = 3.0f;
-    }
-    ForEachGroundObject([&] (const cGroundObject &tmpGround) {
-        if (!NeedCheckCollision(tmpGround) || !ObjectsStatusFoe(MissileObjectStatus, tmpGround.ObjectStatus)) {
+        if (!NeedCheckCollision(tmpObject) || !ObjectsStatusFoe(MissileObjectStatus, tmpObject.ObjectStatus)) {
             return;
         }
 
-        sVECTOR3D TargetLocation = tmpGround.GeometryCenter;
-        vw_Matrix33CalcPoint(TargetLocation, tmpGround.CurrentRotationMat);
-        TargetLocation += tmpGround.Location;
-
-        if (CheckObjectLocation(TargetLocation)) {
-            LockedTarget = GetGroundObjectPtr(tmpGround);
-        }
-    });
-
-    if (!LockedTarget.expired()) {
-        tmpDistanceFactorByObjectType = 6.0f;
-    }
-    ForEachSpaceShip([&] (const cSpaceShip &tmpShip) {
-        if (NeedCheckCollision(tmpShip)
-            && ObjectsStatusFoe(MissileObjectStatus, tmpShip.ObjectStatus)
-            && CheckObjectLocation(tmpShip.Location)) {
-            LockedTarget = GetSpaceShipPtr(tmpShip);
+        switch (Group) {
+        case eObject3DIndexGroup::Flare:
+        case eObject3DIndexGroup::SpaceShip:
+            if (CheckObjectLocation(tmpObject.Location)) {
+                LockedTarget = ObjectPtr;
+            }
+            break;
+
+        case eObject3DIndexGroup::GroundObject: {
+            sVECTOR3D TargetLocation = tmpObject.GeometryCenter;
+            vw_Matrix33CalcPoint(TargetLocation, tmpObject.CurrentRotationMat);
+            TargetLocation += tmpObject.Location;
+
+            if (CheckObjectLocation(TargetLocation)) {
+                LockedTarget = ObjectPtr;
+            }
         }
-    });
-
-    if (!LockedTarget.expired()) {
-        tmpDistanceFactorByObjectType = 10.0f;
-    }
-    ForEachSpaceObject([&] (const cSpaceObject &tmpSpace) {
-        if (NeedCheckCollision(tmpSpace)
-            && ObjectsStatusFoe(MissileObjectStatus, tmpSpace.ObjectStatus)
-            && tmpSpace.ObjectType != eObjectType::SpaceDebris
-            && CheckObjectLocation(tmpSpace.Location)) {
-            LockedTarget = GetSpaceObjectPtr(tmpSpace);
+        break;
+
+        case eObject3DIndexGroup::SpaceObject:
+            if (tmpObject.ObjectType != eObjectType::SpaceDebris
+                && CheckObjectLocation(tmpObject.Location)) {
+                LockedTarget = ObjectPtr;
+            }
+            break;
         }
     });
 
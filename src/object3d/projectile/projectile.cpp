@@ -33,10 +33,6 @@
 
 // TODO codestyle should be fixed
 
-// NOTE we use ReleaseProjectile() in weapon code for beam, since we use beam weapon for
-//      player and motherships only (rare enough). If enemy will have beam weapon, revise
-//      weapon code and/or projectile STL container (std::list is using now).
-
 /*
 
 Note, all enemy's projectiles and missiles without penalty should be about 30% faster
@@ -49,6 +45,7 @@ will not kill their speed and maneuverability and we will have nice difficulty m
 #include "functions.h"
 #include "../explosion/explosion.h"
 #include "../../assets/texture.h"
+#include <limits> // need this one for std::numeric_limits only
 
 // NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
 namespace viewizard {
@@ -169,7 +166,304 @@ const std::vector<sProjectileData> PresetPirateProjectileData{
     {1.2f, 200, 0,  4, 0, -1, 1}
 };
 
-std::list<std::shared_ptr<cProjectile>> ProjectileList{};
+// pool's page size (slots quantity)
+constexpr unsigned PoolPageSize{256};
+// marker for released slot in pool's active slots array
+constexpr unsigned ReleasedSlot{~0u};
+
+/*
+ * Allocator for shared_ptr's control blocks, keep released blocks for reuse.
+ */
+template <typename T>
+struct sControlBlockAllocator {
+    using value_type = T;
+
+    sControlBlockAllocator() = default;
+    template <typename U>
+    sControlBlockAllocator(const sControlBlockAllocator<U> &)
+    {}
+
+    T *allocate(std::size_t n)
+    {
+        std::vector<void *> &Blocks = FreeBlocks();
+        if ((n == 1) && !Blocks.empty()) {
+            void *Block = Blocks.back();
+            Blocks.pop_back();
+            return static_cast<T *>(Block);
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, std::size_t n)
+    {
+        if (n == 1) {
+            FreeBlocks().push_back(p);
+            return;
+        }
+        ::operator delete(p);
+    }
+
+    // note, we never release this one, since control block could be released by
+    // weak_ptr destructor during static objects destruction
+    static std::vector<void *> &FreeBlocks()
+    {
+        static std::vector<void *> *Blocks = new std::vector<void *>;
+        return *Blocks;
+    }
+};
+
+template <typename T, typename U>
+inline bool operator == (const sControlBlockAllocator<T> &, const sControlBlockAllocator<U> &)
+{
+    return true;
+}
+
+template <typename T, typename U>
+inline bool operator != (const sControlBlockAllocator<T> &, const sControlBlockAllocator<U> &)
+{
+    return false;
+}
+
+} // unnamed namespace
+
+/*
+ * Projectiles pool.
+ * All projectiles are stored in pages with stable memory location, released slots are reused (free list),
+ * so, fire-heavy scenes don't need memory allocation for each shot. Hot data (location, previous location,
+ * radius, type) are kept in contiguous arrays (SoA) indexed by slot, for fast linear access in broad phase.
+ * Active slots array keep same order as std::list with emplace_front() had (iterate it from the end),
+ * released slots are marked and removed by Compact() call, when no one iterate active slots array.
+ */
+class cProjectilePool {
+public:
+    // Create projectile.
+    std::weak_ptr<cProjectile> Create(const int ProjectileNum);
+    // Release projectile by index in active slots array.
+    void Release(size_t Index);
+    // Release projectile, if it was not released yet.
+    void Release(const cProjectile &Object);
+    // Release all projectiles.
+    void ReleaseAll();
+    // Remove released slots from active slots array.
+    void Compact();
+    // Update hot data for projectile.
+    void UpdateHotData(const cProjectile &Object);
+
+    // Active slots array size (including released slots).
+    size_t Size() const
+    {
+        return Active_.size();
+    }
+    // Slot by index in active slots array, ReleasedSlot if released.
+    unsigned Slot(size_t Index) const
+    {
+        return Active_[Index];
+    }
+    // Projectile by slot.
+    cProjectile &Object(unsigned Slot)
+    {
+        return *Owners_[Slot];
+    }
+    // Get weak_ptr by projectile.
+    std::weak_ptr<cProjectile> Ptr(const cProjectile &Object) const
+    {
+        return Owners_[Object.PoolSlot_];
+    }
+    // Slot's generation, changed on each slot release.
+    unsigned Generation(unsigned Slot) const
+    {
+        return Generation_[Slot];
+    }
+
+    // hot data (SoA)
+    const sVECTOR3D &HotLocation(unsigned Slot) const
+    {
+        return HotLocation_[Slot];
+    }
+    const sVECTOR3D &HotPrevLocation(unsigned Slot) const
+    {
+        return HotPrevLocation_[Slot];
+    }
+    float HotRadius(unsigned Slot) const
+    {
+        return HotRadius_[Slot];
+    }
+    int HotType(unsigned Slot) const
+    {
+        return HotType_[Slot];
+    }
+
+private:
+    using sStorage = std::aligned_storage<sizeof(cProjectile), alignof(cProjectile)>::type;
+
+    // note, pages should be declared first, since they should be destroyed last
+    std::vector<std::unique_ptr<sStorage[]>> Pages_{};
+    std::vector<unsigned> FreeSlots_{};
+    std::vector<unsigned> Generation_{};
+    std::vector<size_t> ActiveIndex_{};
+    std::vector<unsigned> Active_{};
+    size_t ReleasedCount_{0};
+
+    std::vector<sVECTOR3D> HotLocation_{};
+    std::vector<sVECTOR3D> HotPrevLocation_{};
+    std::vector<float> HotRadius_{};
+    std::vector<int> HotType_{};
+
+    std::vector<std::shared_ptr<cProjectile>> Owners_{};
+};
+
+/*
+ * Create projectile.
+ */
+std::weak_ptr<cProjectile> cProjectilePool::Create(const int ProjectileNum)
+{
+    if (FreeSlots_.empty()) {
+        unsigned FirstSlot = static_cast<unsigned>(Pages_.size()) * PoolPageSize;
+        Pages_.emplace_back(new sStorage[PoolPageSize]);
+
+        size_t NewSize = FirstSlot + PoolPageSize;
+        Generation_.resize(NewSize, 0);
+        ActiveIndex_.resize(NewSize, 0);
+        HotLocation_.resize(NewSize);
+        HotPrevLocation_.resize(NewSize);
+        HotRadius_.resize(NewSize, 0.0f);
+        HotType_.resize(NewSize, 0);
+        Owners_.resize(NewSize);
+
+        // in reverse order, so, first slot will be used first
+        for (unsigned i = PoolPageSize; i > 0; i--) {
+            FreeSlots_.push_back(FirstSlot + i - 1);
+        }
+    }
+
+    unsigned Slot = FreeSlots_.back();
+    FreeSlots_.pop_back();
+
+    cProjectile *Object = new (&Pages_[Slot / PoolPageSize][Slot % PoolPageSize]) cProjectile{ProjectileNum};
+    Object->PoolSlot_ = Slot;
+    Owners_[Slot] = std::shared_ptr<cProjectile>{Object, [this](cProjectile *p) {
+            unsigned ReleasedObjectSlot = p->PoolSlot_;
+            p->~cProjectile();
+            FreeSlots_.push_back(ReleasedObjectSlot);
+        }, sControlBlockAllocator<cProjectile>{}};
+
+    ActiveIndex_[Slot] = Active_.size();
+    Active_.push_back(Slot);
+    UpdateHotData(*Object);
+
+    return Owners_[Slot];
+}
+
+/*
+ * Release projectile by index in active slots array.
+ */
+void cProjectilePool::Release(size_t Index)
+{
+    unsigned Slot = Active_[Index];
+    Active_[Index] = ReleasedSlot;
+    ReleasedCount_++;
+    Generation_[Slot]++;
+    // note, slot will be returned into free list by deleter
+    Owners_[Slot].reset();
+}
+
+/*
+ * Release projectile, if it was not released yet.
+ */
+void cProjectilePool::Release(const cProjectile &Object)
+{
+    // note, released projectile still could be alive, if someone hold shared_ptr
+    if (Owners_[Object.PoolSlot_].get() != &Object) {
+        return;
+    }
+
+    Release(ActiveIndex_[Object.PoolSlot_]);
+}
+
+/*
+ * Release all projectiles.
+ */
+void cProjectilePool::ReleaseAll()
+{
+    for (size_t i = 0; i < Active_.size(); i++) {
+        if (Active_[i] != ReleasedSlot) {
+            Release(i);
+        }
+    }
+    Active_.clear();
+    ReleasedCount_ = 0;
+}
+
+/*
+ * Remove released slots from active slots array.
+ */
+void cProjectilePool::Compact()
+{
+    if (!ReleasedCount_) {
+        return;
+    }
+
+    size_t NewSize{0};
+    for (size_t i = 0; i < Active_.size(); i++) {
+        if (Active_[i] != ReleasedSlot) {
+            ActiveIndex_[Active_[i]] = NewSize;
+            Active_[NewSize++] = Active_[i];
+        }
+    }
+    Active_.resize(NewSize);
+    ReleasedCount_ = 0;
+}
+
+/*
+ * Update hot data for projectile.
+ */
+void cProjectilePool::UpdateHotData(const cProjectile &Object)
+{
+    // could be called from cProjectile constructor, before slot assignment
+    if (Object.PoolSlot_ >= HotLocation_.size()) {
+        return;
+    }
+
+    HotLocation_[Object.PoolSlot_] = Object.Location;
+    HotPrevLocation_[Object.PoolSlot_] = Object.PrevLocation;
+    HotRadius_[Object.PoolSlot_] = Object.Radius;
+    HotType_[Object.PoolSlot_] = Object.ProjectileType;
+}
+
+namespace {
+
+// target -> incoming projectiles registry (see cProjectile::SetTarget()),
+// note, target's pointer used as key only, target could be already released,
+// should be declared before projectiles pool, since pool's objects use it on release
+std::unordered_map<const cObject3D*, std::vector<cProjectile*>> IncomingProjectiles{};
+
+cProjectilePool ProjectilePool{};
+
+// collision broad phase, see BuildProjectileBroadPhase()
+struct sBroadPhaseProjectile {
+    unsigned Slot;
+    unsigned Generation;
+};
+cUniformGrid BroadPhaseGrid{20.0f};
+// grid's box index -> projectile
+std::vector<sBroadPhaseProjectile> BroadPhaseProjectiles{};
+// active slots array size on broad phase build, all projectiles after this index was created later
+size_t BroadPhaseActiveSize{0};
+bool BroadPhaseValid{false};
+std::vector<unsigned> BroadPhaseCandidates{};
+
+// projectiles pairs broad phase, see ForEachProjectilePair()
+cSortAndSweep PairsSweep{};
+// sort and sweep's index -> index in active slots array
+std::vector<size_t> PairsSweepActiveIndex{};
+std::vector<std::pair<unsigned, unsigned>> PairsSweepPairs{};
+
+// projectiles update status for parallel update, by reversed index in active slots array,
+// note, we don't use std::vector<bool>, since different threads could write into the same
+// memory location in this case
+std::vector<uint8_t> UpdateProjectilesStatus{};
+// projectiles per parallel update job
+constexpr unsigned UpdateProjectilesChunkSize{32};
 
 } // unnamed namespace
 
@@ -179,10 +473,7 @@ std::list<std::shared_ptr<cProjectile>> ProjectileList{};
  */
 std::weak_ptr<cProjectile> CreateProjectile(const int ProjectileNum)
 {
-    // NOTE emplace_front() return reference to the inserted element (since C++17)
-    //      this two lines could be combined
-    ProjectileList.emplace_front(new cProjectile{ProjectileNum}, [](cProjectile *p) {delete p;});
-    return ProjectileList.front();
+    return ProjectilePool.Create(ProjectileNum);
 }
 
 /*
@@ -190,14 +481,28 @@ std::weak_ptr<cProjectile> CreateProjectile(const int ProjectileNum)
  */
 void UpdateAllProjectile(float Time)
 {
-    // NOTE use std::erase_if here (since C++20)
-    for (auto iter = ProjectileList.begin(); iter != ProjectileList.end();) {
-        if (!iter->get()->Update(Time)) {
-            iter = ProjectileList.erase(iter);
-        } else {
-            ++iter;
+    // note, projectiles could be created by deferred commands, don't update them
+    size_t Size = ProjectilePool.Size();
+    UpdateProjectilesStatus.resize(Size);
+
+    // newest projectiles first, same order, as in DrawAllProjectiles()
+    ParallelUpdateObject3D(static_cast<unsigned>(Size), UpdateProjectilesChunkSize,
+                           [&Time, &Size] (unsigned Begin, unsigned End) {
+        for (unsigned i = Begin; i < End; i++) {
+            unsigned Slot = ProjectilePool.Slot(Size - 1 - i);
+            UpdateProjectilesStatus[i] = (Slot == ReleasedSlot) || ProjectilePool.Object(Slot).Update(Time);
+        }
+    });
+
+    // release dead projectiles only after deferred commands call, since commands could use them
+    for (size_t i = 0; i < Size; i++) {
+        if (!UpdateProjectilesStatus[i]) {
+            ProjectilePool.Release(Size - 1 - i);
         }
     }
+
+    BroadPhaseValid = false;
+    ProjectilePool.Compact();
 }
 
 /*
@@ -205,8 +510,11 @@ void UpdateAllProjectile(float Time)
  */
 void DrawAllProjectiles(bool VertexOnlyPass, unsigned int ShadowMap)
 {
-    for (auto &tmpProjectile : ProjectileList) {
-        tmpProjectile->Draw(VertexOnlyPass, ShadowMap);
+    for (size_t i = ProjectilePool.Size(); i > 0; i--) {
+        unsigned Slot = ProjectilePool.Slot(i - 1);
+        if (Slot != ReleasedSlot) {
+            ProjectilePool.Object(Slot).Draw(VertexOnlyPass, ShadowMap);
+        }
     }
 }
 
@@ -220,13 +528,7 @@ void ReleaseProjectile(std::weak_ptr<cProjectile> &Object)
         return;
     }
 
-    for (auto iter = ProjectileList.begin(); iter != ProjectileList.end();) {
-        if (iter->get() == sharedObject.get()) {
-            ProjectileList.erase(iter);
-            return;
-        }
-        ++iter;
-    }
+    ProjectilePool.Release(*sharedObject);
 }
 
 /*
@@ -234,7 +536,8 @@ void ReleaseProjectile(std::weak_ptr<cProjectile> &Object)
  */
 void ReleaseAllProjectiles()
 {
-    ProjectileList.clear();
+    BroadPhaseValid = false;
+    ProjectilePool.ReleaseAll();
 }
 
 /*
@@ -243,8 +546,11 @@ void ReleaseAllProjectiles()
  */
 void ForEachProjectile(std::function<void (cProjectile &Object)> function)
 {
-    for (auto &tmpProjectile : ProjectileList) {
-        function(*tmpProjectile);
+    for (size_t i = ProjectilePool.Size(); i > 0; i--) {
+        unsigned Slot = ProjectilePool.Slot(i - 1);
+        if (Slot != ReleasedSlot) {
+            function(ProjectilePool.Object(Slot));
+        }
     }
 }
 
@@ -254,22 +560,25 @@ void ForEachProjectile(std::function<void (cProjectile &Object)> function)
  */
 void ForEachProjectile(std::function<void (cProjectile &Object, eProjectileCycle &Command)> function)
 {
-    // NOTE use std::erase_if here (since C++20)
-    for (auto iter = ProjectileList.begin(); iter != ProjectileList.end();) {
+    for (size_t i = ProjectilePool.Size(); i > 0; i--) {
+        unsigned Slot = ProjectilePool.Slot(i - 1);
+        if (Slot == ReleasedSlot) {
+            continue;
+        }
+
         eProjectileCycle Command{eProjectileCycle::Continue};
-        function(*iter->get(), Command);
+        function(ProjectilePool.Object(Slot), Command);
 
         switch (Command) {
         case eProjectileCycle::Continue:
-            ++iter;
             break;
         case eProjectileCycle::Break:
             return;
         case eProjectileCycle::DeleteObjectAndContinue:
-            iter = ProjectileList.erase(iter);
+            ProjectilePool.Release(i - 1);
             break;
         case eProjectileCycle::DeleteObjectAndBreak:
-            ProjectileList.erase(iter);
+            ProjectilePool.Release(i - 1);
             return;
         }
     }
@@ -283,34 +592,49 @@ void ForEachProjectilePair(std::function<void (cProjectile &FirstObject,
                            cProjectile &SecondObject,
                            eProjectilePairCycle &Command)> function)
 {
-    for (auto iterFirst = ProjectileList.begin(); iterFirst != ProjectileList.end();) {
-        eProjectilePairCycle Command{eProjectilePairCycle::Continue};
+    // sort and sweep along Z axis, only pairs with overlapped intervals are checked
+    PairsSweep.Begin();
+    PairsSweepActiveIndex.clear();
+    for (size_t i = ProjectilePool.Size(); i > 0; i--) {
+        unsigned Slot = ProjectilePool.Slot(i - 1);
+        if (Slot == ReleasedSlot) {
+            continue;
+        }
 
-        for (auto iterSecond = std::next(iterFirst, 1); iterSecond != ProjectileList.end();) {
-            Command = eProjectilePairCycle::Continue;
-            function(*iterFirst->get(), *iterSecond->get(), Command);
+        float Min{-std::numeric_limits<float>::infinity()};
+        float Max{std::numeric_limits<float>::infinity()};
+        // beam use OBB related tests only, since we have only few beams on the scene,
+        // just include them into all pairs
+        if (ProjectilePool.HotType(Slot) != 2) {
+            vw_SphereSphereIntervalZ(ProjectilePool.HotRadius(Slot), ProjectilePool.HotLocation(Slot),
+                                     ProjectilePool.HotPrevLocation(Slot), Min, Max);
+        }
+        PairsSweep.Add(&ProjectilePool.Object(Slot), static_cast<unsigned>(PairsSweepActiveIndex.size()), Min, Max);
+        PairsSweepActiveIndex.push_back(i - 1);
+    }
+    PairsSweep.End();
+    PairsSweep.Pairs(PairsSweepPairs);
+
+    // same pairs order as ForEachProjectile() cycle inside ForEachProjectile() cycle have
+    for (auto &tmpPair : PairsSweepPairs) {
+        size_t First = PairsSweepActiveIndex[tmpPair.first];
+        size_t Second = PairsSweepActiveIndex[tmpPair.second];
+        unsigned FirstSlot = ProjectilePool.Slot(First);
+        unsigned SecondSlot = ProjectilePool.Slot(Second);
+        if (FirstSlot == ReleasedSlot || SecondSlot == ReleasedSlot) {
+            continue;
+        }
 
-            // NOTE (?) use std::erase_if here (since C++20)
-            if (Command == eProjectilePairCycle::DeleteSecondObjectAndContinue
-                || Command == eProjectilePairCycle::DeleteBothObjectsAndContinue) {
-                iterSecond = ProjectileList.erase(iterSecond);
-            } else {
-                ++iterSecond;
-            }
+        eProjectilePairCycle Command{eProjectilePairCycle::Continue};
+        function(ProjectilePool.Object(FirstSlot), ProjectilePool.Object(SecondSlot), Command);
 
-            // break second cycle
-            if (Command == eProjectilePairCycle::DeleteFirstObjectAndContinue
-                || Command == eProjectilePairCycle::DeleteBothObjectsAndContinue) {
-                break;
-            }
+        if (Command == eProjectilePairCycle::DeleteSecondObjectAndContinue
+            || Command == eProjectilePairCycle::DeleteBothObjectsAndContinue) {
+            ProjectilePool.Release(Second);
         }
-
-        // NOTE (?) use std::erase_if here (since C++20)
         if (Command == eProjectilePairCycle::DeleteFirstObjectAndContinue
             || Command == eProjectilePairCycle::DeleteBothObjectsAndContinue) {
-            iterFirst = ProjectileList.erase(iterFirst);
-        } else {
-            ++iterFirst;
+            ProjectilePool.Release(First);
         }
     }
 }
@@ -320,13 +644,196 @@ void ForEachProjectilePair(std::function<void (cProjectile &FirstObject,
  */
 std::weak_ptr<cObject3D> GetProjectilePtr(const cProjectile &Object)
 {
-    for (auto &tmpProjectile : ProjectileList) {
-        if (tmpProjectile.get() == &Object) {
-            return tmpProjectile;
+    return ProjectilePool.Ptr(Object);
+}
+
+/*
+ * Reset target for all projectiles (homing missiles/mines), that targeted on object.
+ * Return true, if object was targeted by at least one projectile.
+ */
+bool ResetProjectilesTarget(const cObject3D &Object)
+{
+    auto iter = IncomingProjectiles.find(&Object);
+    if (iter == IncomingProjectiles.end()) {
+        return false;
+    }
+
+    bool Targeted{false};
+    for (auto *tmpProjectile : iter->second) {
+        // previous object with same address could be released, but projectile still
+        // have expired target, so, we check the target, but reset registry in any case
+        if (tmpProjectile->Target_.lock().get() == &Object) {
+            Targeted = true;
+            tmpProjectile->Target_.reset();
+        }
+        tmpProjectile->RegisteredTarget_ = nullptr;
+    }
+    IncomingProjectiles.erase(iter);
+
+    return Targeted;
+}
+
+/*
+ * Check, is object targeted by homing missile (homing mines are not counted).
+ */
+bool IsTargetedByHomingMissile(const cObject3D &Object)
+{
+    auto iter = IncomingProjectiles.find(&Object);
+    if (iter == IncomingProjectiles.end()) {
+        return false;
+    }
+
+    for (auto *tmpProjectile : iter->second) {
+        if ((tmpProjectile->Num < 26 || tmpProjectile->Num > 29)
+            && tmpProjectile->Target_.lock().get() == &Object) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Build collision broad phase for all projectiles.
+ */
+void BuildProjectileBroadPhase()
+{
+    BroadPhaseGrid.Clear();
+    BroadPhaseProjectiles.clear();
+
+    for (size_t i = ProjectilePool.Size(); i > 0; i--) {
+        unsigned Slot = ProjectilePool.Slot(i - 1);
+        if (Slot == ReleasedSlot) {
+            continue;
+        }
+
+        // beam use AABB-AABB and OBB related tests with object's previous location (see DetectProjectileCollision()),
+        // since we have only few beams on the scene, just include them into all checks
+        if (ProjectilePool.HotType(Slot) == 2) {
+            BroadPhaseGrid.Add(sVECTOR3D{-std::numeric_limits<float>::infinity(),
+                                         -std::numeric_limits<float>::infinity(),
+                                         -std::numeric_limits<float>::infinity()},
+                               sVECTOR3D{std::numeric_limits<float>::infinity(),
+                                         std::numeric_limits<float>::infinity(),
+                                         std::numeric_limits<float>::infinity()});
+            BroadPhaseProjectiles.push_back(sBroadPhaseProjectile{Slot, ProjectilePool.Generation(Slot)});
+            continue;
+        }
+
+        // all projectile's checks in DetectProjectileCollision() start from vw_SphereSphereCollision(),
+        // that detect collision with projectile's sphere in current location, or collision point inside
+        // the sphere, that built on line segment between previous and current location (as diameter)
+        const sVECTOR3D &Location = ProjectilePool.HotLocation(Slot);
+        const sVECTOR3D &PrevLocation = ProjectilePool.HotPrevLocation(Slot);
+        sVECTOR3D Mid{(Location + PrevLocation) / 2.0f};
+        float HalfLength{(Location - PrevLocation).Length() / 2.0f};
+
+        // small safety margin for floating point rounding
+        float Radius{ProjectilePool.HotRadius(Slot) + 1.0f};
+        HalfLength += 1.0f;
+
+        BroadPhaseGrid.Add(sVECTOR3D{std::min(Location.x - Radius, Mid.x - HalfLength),
+                                     std::min(Location.y - Radius, Mid.y - HalfLength),
+                                     std::min(Location.z - Radius, Mid.z - HalfLength)},
+                           sVECTOR3D{std::max(Location.x + Radius, Mid.x + HalfLength),
+                                     std::max(Location.y + Radius, Mid.y + HalfLength),
+                                     std::max(Location.z + Radius, Mid.z + HalfLength)});
+        BroadPhaseProjectiles.push_back(sBroadPhaseProjectile{Slot, ProjectilePool.Generation(Slot)});
+    }
+
+    BroadPhaseGrid.Build();
+    BroadPhaseActiveSize = ProjectilePool.Size();
+    BroadPhaseValid = true;
+}
+
+/*
+ * Managed cycle for each projectile, that could overlap box (world space) and have status from StatusMask.
+ * Return number of projectiles, skipped by StatusMask.
+ * Note, caller must guarantee, that 'Object' will not released in callback function call.
+ */
+unsigned ForEachProjectileInBox(const sVECTOR3D &Min, const sVECTOR3D &Max, unsigned StatusMask,
+                                std::function<void (cProjectile &Object, eProjectileCycle &Command)> function)
+{
+    // note, projectile's status could be changed during collision detection (deflector),
+    // so, we check status on each call and don't cache it in broad phase
+    unsigned Skipped{0};
+
+    if (!BroadPhaseValid) {
+        ForEachProjectile([&] (cProjectile &Object, eProjectileCycle &Command) {
+            if (!(StatusMask & ObjectStatusBit(Object.ObjectStatus))) {
+                Skipped++;
+                return;
+            }
+            function(Object, Command);
+        });
+        return Skipped;
+    }
+
+    // projectiles, created after broad phase build, are located at the end of active slots array
+    // and should be processed first (see cProjectilePool), we don't know their location, so,
+    // they are always included
+    for (size_t i = ProjectilePool.Size(); i > BroadPhaseActiveSize; i--) {
+        unsigned Slot = ProjectilePool.Slot(i - 1);
+        if (Slot == ReleasedSlot) {
+            continue;
+        }
+
+        cProjectile &Object = ProjectilePool.Object(Slot);
+        if (!(StatusMask & ObjectStatusBit(Object.ObjectStatus))) {
+            Skipped++;
+            continue;
+        }
+
+        eProjectileCycle Command{eProjectileCycle::Continue};
+        function(Object, Command);
+
+        switch (Command) {
+        case eProjectileCycle::Continue:
+            break;
+        case eProjectileCycle::Break:
+            return Skipped;
+        case eProjectileCycle::DeleteObjectAndContinue:
+            ProjectilePool.Release(i - 1);
+            break;
+        case eProjectileCycle::DeleteObjectAndBreak:
+            ProjectilePool.Release(i - 1);
+            return Skipped;
+        }
+    }
+
+    // since grid's boxes were added in cycle's order, sorted result provide same order
+    BroadPhaseGrid.Query(Min, Max, BroadPhaseCandidates);
+    for (auto &tmpIndex : BroadPhaseCandidates) {
+        const sBroadPhaseProjectile &tmpProjectile = BroadPhaseProjectiles[tmpIndex];
+        // released, slot could be already reused by another projectile
+        if (ProjectilePool.Generation(tmpProjectile.Slot) != tmpProjectile.Generation) {
+            continue;
+        }
+
+        cProjectile &Object = ProjectilePool.Object(tmpProjectile.Slot);
+        if (!(StatusMask & ObjectStatusBit(Object.ObjectStatus))) {
+            Skipped++;
+            continue;
+        }
+
+        eProjectileCycle Command{eProjectileCycle::Continue};
+        function(Object, Command);
+
+        switch (Command) {
+        case eProjectileCycle::Continue:
+            break;
+        case eProjectileCycle::Break:
+            return Skipped;
+        case eProjectileCycle::DeleteObjectAndContinue:
+            ProjectilePool.Release(Object);
+            break;
+        case eProjectileCycle::DeleteObjectAndBreak:
+            ProjectilePool.Release(Object);
+            return Skipped;
         }
     }
 
-    return std::weak_ptr<cObject3D>{};
+    return Skipped;
 }
 
 /*
@@ -1954,6 +2461,8 @@ cProjectile::cProjectile(const int ProjectileNum)
  */
 cProjectile::~cProjectile()
 {
+    SetTarget(std::weak_ptr<cObject3D>{});
+
     for (unsigned int i = 0; i < GraphicFX.size(); i++) {
         auto sharedGFX = GraphicFX[i].lock();
         if (!sharedGFX) {
@@ -2051,12 +2560,43 @@ void cProjectile::SetRotation(const sVECTOR3D &NewRotation)
     }
 }
 
+/*
+ * Set target and update target -> incoming projectiles registry.
+ */
+void cProjectile::SetTarget(const std::weak_ptr<cObject3D> &NewTarget)
+{
+    Target_ = NewTarget;
+
+    const cObject3D *NewRegisteredTarget = Target_.lock().get();
+    if (NewRegisteredTarget == RegisteredTarget_) {
+        return;
+    }
+
+    if (RegisteredTarget_) {
+        auto iter = IncomingProjectiles.find(RegisteredTarget_);
+        if (iter != IncomingProjectiles.end()) {
+            auto &tmpProjectiles = iter->second;
+            tmpProjectiles.erase(std::remove(tmpProjectiles.begin(), tmpProjectiles.end(), this),
+                                 tmpProjectiles.end());
+            if (tmpProjectiles.empty()) {
+                IncomingProjectiles.erase(iter);
+            }
+        }
+    }
+
+    RegisteredTarget_ = NewRegisteredTarget;
+    if (RegisteredTarget_) {
+        IncomingProjectiles[RegisteredTarget_].push_back(this);
+    }
+}
+
 /*
  * Set location.
  */
 void cProjectile::SetLocation(const sVECTOR3D &NewLocation)
 {
     cObject3D::SetLocation(NewLocation);
+    ProjectilePool.UpdateHotData(*this);
 
     if (GraphicFX.empty()) {
         return;
@@ -2347,27 +2887,10 @@ void cProjectile::SetLocation(const sVECTOR3D &NewLocation)
 }
 
 /*
- * Update.
+ * Homing missiles and mines targeting.
  */
-bool cProjectile::Update(float Time)
+void cProjectile::UpdateTargeting()
 {
-    if (!cObject3D::Update(Time)) {
-        if (ProjectileType == 2) {
-            return true;
-        }
-        CreateBulletExplosion(nullptr, *this, -Num, Location, Speed);
-        return false;
-    }
-
-    if (TimeDelta == 0.0f) {
-        return true;
-    }
-
-    Speed = SpeedStart * (Lifetime / Age) + SpeedEnd * ((Age - Lifetime) / Age);
-
-    sVECTOR3D Velocity = Orientation ^ (Speed * TimeDelta);
-    SetLocation(Location + Velocity);
-
     float CurrentPenalty{1.0f};
     if (ObjectStatus == eObjectStatus::Enemy) {
         CurrentPenalty = static_cast<float>(GameEnemyWeaponPenalty);
@@ -2375,90 +2898,7 @@ bool cProjectile::Update(float Time)
 
     float RotationSpeed;
 
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // Если что-то надо делать со снарядом (наводить к примеру)
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     switch (Num) {
-    // Plasma
-    case 9:
-    case 109:
-        if (auto sharedGFX = GraphicFX[1].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
-                                                                 sharedGFX->Angle.y,
-                                                                 sharedGFX->Angle.z});
-        }
-        if (auto sharedGFX = GraphicFX[2].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
-                                                                 sharedGFX->Angle.y,
-                                                                 sharedGFX->Angle.z});
-        }
-        break;
-    case 10:
-    case 108:
-    case 213:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
-                                                                 sharedGFX->Angle.y,
-                                                                 sharedGFX->Angle.z});
-        }
-        if (auto sharedGFX = GraphicFX[1].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
-                                                                 sharedGFX->Angle.y,
-                                                                 sharedGFX->Angle.z});
-        }
-        break;
-
-    // Maser
-    case 11:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 3.0f});
-            if (Lifetime <= sharedGFX->Life / 1.5f) {
-                sharedGFX->IsSuppressed = true;
-            }
-        }
-        break;
-    case 12:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 4.0f});
-            if (Lifetime <= sharedGFX->Life / 1.5f) {
-                sharedGFX->IsSuppressed = true;
-            }
-        }
-        if (auto sharedGFX = GraphicFX[1].lock()) {
-            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, -360.0f * TimeDelta * 2.0f});
-            if (Lifetime <= sharedGFX->Life / 1.5f) {
-                sharedGFX->IsSuppressed = true;
-            }
-        }
-        break;
-
-    // Antimatter
-    case 13:
-    case 208:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x,
-                                                                 sharedGFX->Angle.y - 360.0f * TimeDelta * 2.0f,
-                                                                 sharedGFX->Angle.z});
-        }
-        break;
-
-    // Laser
-    case 14:
-    case 110:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            if (Lifetime <= sharedGFX->Life / 1.5f) {
-                sharedGFX->IsSuppressed = true;
-            }
-        }
-        break;
-
-    // Gauss
-    case 15:
-        if (auto sharedGFX = GraphicFX[0].lock()) {
-            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 6.0f});
-        }
-        break;
-
     // missile
     case 16:
         RotationSpeed = 50.0f;
@@ -2502,18 +2942,18 @@ missile:
                 EffectiveRange = Lifetime * Speed;
             }
 
-            if (Target.expired()) {
-                Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
-                                                      CurrentRotationMat, NeedAngle, EffectiveRange);
+            if (Target_.expired()) {
+                SetTarget(FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
+                                                       CurrentRotationMat, NeedAngle, EffectiveRange));
             } else {
-                if (CheckMissileTarget(Target, Location, CurrentRotationMat)) {
-                    if (!CorrectTargetInterceptCourse(Location, Rotation, CurrentRotationMat, Target, NeedAngle)) {
-                        Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
-                                                              CurrentRotationMat, NeedAngle, EffectiveRange);
+                if (CheckMissileTarget(Target_, Location, CurrentRotationMat)) {
+                    if (!CorrectTargetInterceptCourse(Location, Rotation, CurrentRotationMat, Target_, NeedAngle)) {
+                        SetTarget(FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
+                                                               CurrentRotationMat, NeedAngle, EffectiveRange));
                     }
                 } else {
-                    Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
-                                                          CurrentRotationMat, NeedAngle, EffectiveRange);
+                    SetTarget(FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
+                                                           CurrentRotationMat, NeedAngle, EffectiveRange));
                 }
             }
 
@@ -2552,24 +2992,6 @@ missile:
             SetRotation(NeedAngle - Rotation);
         }
         break;
-
-    // pirate, mine 1
-    case 214:
-        MineIData += TimeDelta;
-        if (MineIData >= 0.1f) {
-            if (!TextureIllum[0]) {
-                TextureIllum[0] = GetPreloadedTextureAsset("models/mine/mine1i.tga");
-            } else {
-                TextureIllum[0] = 0;
-            }
-            MineIData = 0.0f;
-        }
-        Chunks[0].Rotation.y += 90.0f * TimeDelta;
-        while (Chunks[0].Rotation.y > 360.0f) {
-            Chunks[0].Rotation.y -= 360.0f;
-        }
-        // wip, disabled for now
-        break;
     // alien, energy mine 1
     case 106: {
         std::weak_ptr<cObject3D> tmpTarget = GetClosestTargetToMine(ObjectStatus, Location);
@@ -2598,31 +3020,14 @@ missile:
         }
     }
     break;
-    // pirate, mine 2
-    case 215:
-        MineIData += TimeDelta;
-        if (MineIData >= 0.1f) {
-            if (!TextureIllum[0]) {
-                TextureIllum[0] = GetPreloadedTextureAsset("models/mine/mine2i.tga");
-            } else {
-                TextureIllum[0] = 0;
-            }
-            MineIData = 0.0f;
-        }
-        Chunks[0].Rotation.y += 90.0f * TimeDelta;
-        while (Chunks[0].Rotation.y > 360.0f) {
-            Chunks[0].Rotation.y -= 360.0f;
-        }
-        // wip, disabled for now
-        break;
     // alien, energy mine 2
     case 107:
         RotationSpeed = 180.0f;
         {
             sVECTOR3D NeedAngle = Rotation;
             // устанавливаем в Target на что наведен этот снаряд
-            Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
-                                                  CurrentRotationMat, NeedAngle, 1000000);
+            SetTarget(FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
+                                                   CurrentRotationMat, NeedAngle, 1000000));
 
 
             // учитываем скорость поворота по вертикали
@@ -2650,7 +3055,7 @@ missile:
 
 
             // если есть цель, поднимаемся на ее уровень
-            auto sharedTarget = Target.lock();
+            auto sharedTarget = Target_.lock();
             if (sharedTarget) {
                 float MineSpeed = 5.0f;
 
@@ -2682,33 +3087,17 @@ missile:
             }
 
             // сбрасываем установку, чтобы не было голосового предупреждения
-            Target.reset();
+            SetTarget(std::weak_ptr<cObject3D>{});
         }
         break;
 
-
-
     case 216:
-        MineIData += TimeDelta;
-        if (MineIData >= 0.1f) {
-            if (!TextureIllum[0]) {
-                TextureIllum[0] = GetPreloadedTextureAsset("models/mine/mine3i.tga");
-            } else {
-                TextureIllum[0] = 0;
-            }
-            MineIData = 0.0f;
-        }
-        Chunks[0].Rotation.y += 120.0f * TimeDelta;
-        while (Chunks[0].Rotation.y > 360.0f) {
-            Chunks[0].Rotation.y -= 360.0f;
-        }
-
         RotationSpeed = 180.0f;
         {
             sVECTOR3D NeedAngle = Rotation;
             // устанавливаем в Target на что наведен этот снаряд
-            Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
-                                                  CurrentRotationMat, NeedAngle, 1000000);
+            SetTarget(FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
+                                                   CurrentRotationMat, NeedAngle, 1000000));
 
 
             // учитываем скорость поворота по вертикали
@@ -2733,7 +3122,7 @@ missile:
 
             SetRotation(NeedAngle - Rotation);
 
-            auto sharedTarget = Target.lock();
+            auto sharedTarget = Target_.lock();
             if (sharedTarget) {
                 float MineSpeed = 5.0f;
                 sVECTOR3D NeedPoint = sharedTarget->Location;
@@ -2776,30 +3165,15 @@ missile:
                     MineNextFireTime = MineReloadTime;
                 }
             }
-            Target.reset();
+            SetTarget(std::weak_ptr<cObject3D>{});
         }
         break;
-
     case 217:
-        MineIData += TimeDelta;
-        if (MineIData >= 0.1f) {
-            if (!TextureIllum[0]) {
-                TextureIllum[0] = GetPreloadedTextureAsset("models/mine/mine4i.tga");
-            } else {
-                TextureIllum[0] = 0;
-            }
-            MineIData = 0.0f;
-        }
-        Chunks[0].Rotation.y += 90.0f * TimeDelta;
-        while (Chunks[0].Rotation.y > 360.0f) {
-            Chunks[0].Rotation.y -= 360.0f;
-        }
-
         RotationSpeed = 180.0f;
         {
             sVECTOR3D NeedAngle = Rotation;
-            Target = FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
-                                                  CurrentRotationMat, NeedAngle, 1000000);
+            SetTarget(FindTargetAndInterceptCourse(ObjectStatus, Location, Rotation,
+                                                   CurrentRotationMat, NeedAngle, 1000000));
 
             if (Rotation.y < NeedAngle.y) {
                 float NeedAngle_y = Rotation.y + RotationSpeed * TimeDelta;
@@ -2820,7 +3194,7 @@ missile:
             NeedAngle.x = Rotation.x;
             SetRotation(NeedAngle - Rotation);
 
-            auto sharedTarget = Target.lock();
+            auto sharedTarget = Target_.lock();
             if (sharedTarget) {
                 float MineSpeed = 5.0f;
                 sVECTOR3D NeedPoint = sharedTarget->Location;
@@ -2861,8 +3235,208 @@ missile:
                     MineNextFireTime = MineReloadTime;
                 }
             }
-            Target.reset();
+            SetTarget(std::weak_ptr<cObject3D>{});
+        }
+        break;
+    }
+}
+
+/*
+ * Update.
+ */
+bool cProjectile::Update(float Time)
+{
+    if (!cObject3D::Update(Time)) {
+        if (ProjectileType == 2) {
+            return true;
+        }
+        // note, projectile will be released after deferred commands call
+        DeferObject3DCommand([this] () {CreateBulletExplosion(nullptr, *this, -Num, Location, Speed);});
+        return false;
+    }
+
+    if (TimeDelta == 0.0f) {
+        return true;
+    }
+
+    Speed = SpeedStart * (Lifetime / Age) + SpeedEnd * ((Age - Lifetime) / Age);
+
+    sVECTOR3D Velocity = Orientation ^ (Speed * TimeDelta);
+    SetLocation(Location + Velocity);
+
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // Если что-то надо делать со снарядом (наводить к примеру)
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    switch (Num) {
+    // Plasma
+    case 9:
+    case 109:
+        if (auto sharedGFX = GraphicFX[1].lock()) {
+            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
+                                                                 sharedGFX->Angle.y,
+                                                                 sharedGFX->Angle.z});
+        }
+        if (auto sharedGFX = GraphicFX[2].lock()) {
+            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
+                                                                 sharedGFX->Angle.y,
+                                                                 sharedGFX->Angle.z});
+        }
+        break;
+    case 10:
+    case 108:
+    case 213:
+        if (auto sharedGFX = GraphicFX[0].lock()) {
+            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
+                                                                 sharedGFX->Angle.y,
+                                                                 sharedGFX->Angle.z});
+        }
+        if (auto sharedGFX = GraphicFX[1].lock()) {
+            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x - 360.0f * TimeDelta,
+                                                                 sharedGFX->Angle.y,
+                                                                 sharedGFX->Angle.z});
+        }
+        break;
+
+    // Maser
+    case 11:
+        if (auto sharedGFX = GraphicFX[0].lock()) {
+            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 3.0f});
+            if (Lifetime <= sharedGFX->Life / 1.5f) {
+                sharedGFX->IsSuppressed = true;
+            }
+        }
+        break;
+    case 12:
+        if (auto sharedGFX = GraphicFX[0].lock()) {
+            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 4.0f});
+            if (Lifetime <= sharedGFX->Life / 1.5f) {
+                sharedGFX->IsSuppressed = true;
+            }
+        }
+        if (auto sharedGFX = GraphicFX[1].lock()) {
+            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, -360.0f * TimeDelta * 2.0f});
+            if (Lifetime <= sharedGFX->Life / 1.5f) {
+                sharedGFX->IsSuppressed = true;
+            }
+        }
+        break;
+
+    // Antimatter
+    case 13:
+    case 208:
+        if (auto sharedGFX = GraphicFX[0].lock()) {
+            sharedGFX->RotateSystemAndParticlesByAngle(sVECTOR3D{sharedGFX->Angle.x,
+                                                                 sharedGFX->Angle.y - 360.0f * TimeDelta * 2.0f,
+                                                                 sharedGFX->Angle.z});
+        }
+        break;
+
+    // Laser
+    case 14:
+    case 110:
+        if (auto sharedGFX = GraphicFX[0].lock()) {
+            if (Lifetime <= sharedGFX->Life / 1.5f) {
+                sharedGFX->IsSuppressed = true;
+            }
+        }
+        break;
+
+    // Gauss
+    case 15:
+        if (auto sharedGFX = GraphicFX[0].lock()) {
+            sharedGFX->RotateParticlesByAngle(sVECTOR3D{0.0f, 0.0f, 360.0f * TimeDelta * 6.0f});
+        }
+        break;
+
+    // missile
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    // ракеты пришельцев
+    case 102:
+    case 104:
+    // ракеты пиратов
+    case 205:
+    case 206:
+    case 209:
+    case 210:
+    // alien, energy mine 1
+    case 106:
+    // alien, energy mine 2
+    case 107:
+        // targeting read other objects and change target -> incoming projectiles registry,
+        // should be deferred during objects parallel update (see DeferObject3DCommand())
+        DeferObject3DCommand([this] () {UpdateTargeting();});
+        break;
+
+    // pirate, mine 1
+    case 214:
+        MineIData += TimeDelta;
+        if (MineIData >= 0.1f) {
+            if (!TextureIllum[0]) {
+                TextureIllum[0] = GetPreloadedTextureAsset("models/mine/mine1i.tga");
+            } else {
+                TextureIllum[0] = 0;
+            }
+            MineIData = 0.0f;
+        }
+        Chunks[0].Rotation.y += 90.0f * TimeDelta;
+        while (Chunks[0].Rotation.y > 360.0f) {
+            Chunks[0].Rotation.y -= 360.0f;
+        }
+        // wip, disabled for now
+        break;
+    // pirate, mine 2
+    case 215:
+        MineIData += TimeDelta;
+        if (MineIData >= 0.1f) {
+            if (!TextureIllum[0]) {
+                TextureIllum[0] = GetPreloadedTextureAsset("models/mine/mine2i.tga");
+            } else {
+                TextureIllum[0] = 0;
+            }
+            MineIData = 0.0f;
+        }
+        Chunks[0].Rotation.y += 90.0f * TimeDelta;
+        while (Chunks[0].Rotation.y > 360.0f) {
+            Chunks[0].Rotation.y -= 360.0f;
+        }
+        // wip, disabled for now
+        break;
+
+    case 216:
+        MineIData += TimeDelta;
+        if (MineIData >= 0.1f) {
+            if (!TextureIllum[0]) {
+                TextureIllum[0] = GetPreloadedTextureAsset("models/mine/mine3i.tga");
+            } else {
+                TextureIllum[0] = 0;
+            }
+            MineIData = 0.0f;
+        }
+        Chunks[0].Rotation.y += 120.0f * TimeDelta;
+        while (Chunks[0].Rotation.y > 360.0f) {
+            Chunks[0].Rotation.y -= 360.0f;
+        }
+        DeferObject3DCommand([this] () {UpdateTargeting();});
+        break;
+
+    case 217:
+        MineIData += TimeDelta;
+        if (MineIData >= 0.1f) {
+            if (!TextureIllum[0]) {
+                TextureIllum[0] = GetPreloadedTextureAsset("models/mine/mine4i.tga");
+            } else {
+                TextureIllum[0] = 0;
+            }
+            MineIData = 0.0f;
+        }
+        Chunks[0].Rotation.y += 90.0f * TimeDelta;
+        while (Chunks[0].Rotation.y > 360.0f) {
+            Chunks[0].Rotation.y -= 360.0f;
         }
+        DeferObject3DCommand([this] () {UpdateTargeting();});
         break;
     }
 
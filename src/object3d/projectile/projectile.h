@@ -55,8 +55,12 @@ enum class eProjectilePairCycle {
     DeleteBothObjectsAndContinue
 };
 
+class cProjectilePool;
+
 class cProjectile final : public cObject3D {
-    friend std::weak_ptr<cProjectile> CreateProjectile(const int ProjectileNum);
+    friend class cProjectilePool;
+    friend bool ResetProjectilesTarget(const cObject3D &Object);
+    friend bool IsTargetedByHomingMissile(const cObject3D &Object);
 
 private:
     // Don't allow direct new/delete usage in code, only CreateProjectile()
@@ -64,7 +68,24 @@ private:
     explicit cProjectile(const int ProjectileNum);
     ~cProjectile();
 
+    // slot in projectiles pool, see cProjectilePool
+    unsigned PoolSlot_{~0u};
+
+    // Set target and update target -> incoming projectiles registry.
+    void SetTarget(const std::weak_ptr<cObject3D> &NewTarget);
+    // Homing missiles and mines targeting, could be deferred (see DeferObject3DCommand()).
+    void UpdateTargeting();
+
+    // target for homing missile/mine, should be changed by SetTarget() only
+    std::weak_ptr<cObject3D> Target_{};
+    // object, this projectile registered for in target -> incoming projectiles registry
+    // note, used as registry key only, object could be already released
+    const cObject3D *RegisteredTarget_{nullptr};
+
 public:
+    cProjectile(cProjectile const&) = delete;
+    void operator = (cProjectile const&) = delete;
+
     virtual bool Update(float Time) override;
     virtual void SetRotation(const sVECTOR3D &NewRotation) override;
     virtual void SetLocation(const sVECTOR3D &NewLocation) override;
@@ -80,9 +101,6 @@ public:
     // 4 - mine with 3d model
     int ProjectileType{0};
 
-    // target for himing missile/mine
-    std::weak_ptr<cObject3D> Target{};
-
     // projectile center for beam, since we need correct it with weapon rotation
     sVECTOR3D ProjectileCenter{0.0f, 0.0f, 0.0f};
 
@@ -129,6 +147,20 @@ void ForEachProjectilePair(std::function<void (cProjectile &FirstObject,
                            eProjectilePairCycle &Command)> function);
 // Get object ptr by reference.
 std::weak_ptr<cObject3D> GetProjectilePtr(const cProjectile &Object);
+// Reset target for all projectiles (homing missiles/mines), that targeted on object.
+// Return true, if object was targeted by at least one projectile.
+bool ResetProjectilesTarget(const cObject3D &Object);
+// Check, is object targeted by homing missile (homing mines are not counted).
+bool IsTargetedByHomingMissile(const cObject3D &Object);
+// Build collision broad phase for all projectiles (swept sphere box, beams are included into all boxes).
+// Note, broad phase is valid till next UpdateAllProjectile() or ReleaseAllProjectiles() call.
+void BuildProjectileBroadPhase();
+// Managed cycle for each projectile, that could overlap box (world space), same order as ForEachProjectile() have.
+// Projectiles, created after BuildProjectileBroadPhase() call, are always included. Projectiles with status,
+// that is not in StatusMask (see ObjectStatusBit()), are skipped. Return number of skipped projectiles.
+// Note, caller must guarantee, that 'Object' will not released in callback function call.
+unsigned ForEachProjectileInBox(const sVECTOR3D &Min, const sVECTOR3D &Max, unsigned StatusMask,
+                                std::function<void (cProjectile &Object, eProjectileCycle &Command)> function);
 
 // Get projectile fly range.
 float GetProjectileRange(int Num);
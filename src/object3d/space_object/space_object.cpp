@@ -39,6 +39,15 @@ namespace {
 // all space object list
 std::list<std::shared_ptr<cSpaceObject>> SpaceObjectList{};
 
+// objects pairs broad phase
+struct sSweepObject {
+    std::list<std::shared_ptr<cSpaceObject>>::iterator Iter;
+    bool Released;
+};
+cSortAndSweep SpaceObjectSweep{};
+std::vector<sSweepObject> SpaceObjectSweepObjects{};
+std::vector<std::pair<unsigned, unsigned>> SpaceObjectSweepPairs{};
+
 } // unnamed namespace
 
 
@@ -210,34 +219,39 @@ void ForEachSpaceObjectPair(std::function<void (cSpaceObject &FirstObject,
                             cSpaceObject &SecondObject,
                             eSpacePairCycle &Command)> function)
 {
-    for (auto iterFirst = SpaceObjectList.begin(); iterFirst != SpaceObjectList.end();) {
-        eSpacePairCycle Command{eSpacePairCycle::Continue};
-
-        for (auto iterSecond = std::next(iterFirst, 1); iterSecond != SpaceObjectList.end();) {
-            Command = eSpacePairCycle::Continue;
-            function(*iterFirst->get(), *iterSecond->get(), Command);
+    // sort and sweep along Z axis, only pairs with overlapped intervals are checked
+    SpaceObjectSweep.Begin();
+    SpaceObjectSweepObjects.clear();
+    for (auto iter = SpaceObjectList.begin(); iter != SpaceObjectList.end(); ++iter) {
+        float Min;
+        float Max;
+        vw_SphereSphereIntervalZ((*iter)->Radius, (*iter)->Location, (*iter)->PrevLocation, Min, Max);
+        SpaceObjectSweep.Add(iter->get(), static_cast<unsigned>(SpaceObjectSweepObjects.size()), Min, Max);
+        SpaceObjectSweepObjects.push_back(sSweepObject{iter, false});
+    }
+    SpaceObjectSweep.End();
+    SpaceObjectSweep.Pairs(SpaceObjectSweepPairs);
+
+    // same pairs order as i<j cycles for objects list have
+    for (auto &tmpPair : SpaceObjectSweepPairs) {
+        sSweepObject &First = SpaceObjectSweepObjects[tmpPair.first];
+        sSweepObject &Second = SpaceObjectSweepObjects[tmpPair.second];
+        if (First.Released || Second.Released) {
+            continue;
+        }
 
-            // NOTE (?) use std::erase_if here (since C++20)
-            if (Command == eSpacePairCycle::DeleteSecondObjectAndContinue
-                || Command == eSpacePairCycle::DeleteBothObjectsAndContinue) {
-                iterSecond = SpaceObjectList.erase(iterSecond);
-            } else {
-                ++iterSecond;
-            }
+        eSpacePairCycle Command{eSpacePairCycle::Continue};
+        function(*First.Iter->get(), *Second.Iter->get(), Command);
 
-            // break second cycle
-            if (Command == eSpacePairCycle::DeleteFirstObjectAndContinue
-                || Command == eSpacePairCycle::DeleteBothObjectsAndContinue) {
-                break;
-            }
+        if (Command == eSpacePairCycle::DeleteSecondObjectAndContinue
+            || Command == eSpacePairCycle::DeleteBothObjectsAndContinue) {
+            SpaceObjectList.erase(Second.Iter);
+            Second.Released = true;
         }
-
-        // NOTE (?) use std::erase_if here (since C++20)
         if (Command == eSpacePairCycle::DeleteFirstObjectAndContinue
             || Command == eSpacePairCycle::DeleteBothObjectsAndContinue) {
-            iterFirst = SpaceObjectList.erase(iterFirst);
-        } else {
-            ++iterFirst;
+            SpaceObjectList.erase(First.Iter);
+            First.Released = true;
         }
     }
 }
@@ -256,6 +270,17 @@ std::weak_ptr<cObject3D> GetSpaceObjectPtr(const cSpaceObject &Object)
     return std::weak_ptr<cObject3D>{};
 }
 
+/*
+ * Cycle for each space object with object's ptr.
+ * Note, caller must guarantee, that 'Object' will not released in callback function call.
+ */
+void ForEachSpaceObjectPtr(std::function<void (cSpaceObject &Object, const std::weak_ptr<cObject3D> &ObjectPtr)> function)
+{
+    for (auto &tmpSpace : SpaceObjectList) {
+        function(*tmpSpace, tmpSpace);
+    }
+}
+
 /*
  * Constructor.
  */
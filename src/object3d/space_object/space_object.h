@@ -175,6 +175,9 @@ void ForEachSpaceObjectPair(std::function<void (cSpaceObject &FirstObject,
                             eSpacePairCycle &Command)> function);
 // Get object ptr by reference.
 std::weak_ptr<cObject3D> GetSpaceObjectPtr(const cSpaceObject &Object);
+// Cycle for each space object with object's ptr (same order as ForEachSpaceObject() have).
+// Note, caller must guarantee, that 'Object' will not released in callback function call.
+void ForEachSpaceObjectPtr(std::function<void (cSpaceObject &Object, const std::weak_ptr<cObject3D> &ObjectPtr)> function);
 
 } // astromenace namespace
 } // viewizard namespace
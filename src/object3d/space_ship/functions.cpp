@@ -151,8 +151,9 @@ void GetWeaponOnTargetOrientation(eObjectStatus WeaponStatus, const sVECTOR3D &W
     if (TargetLocked) {
         tmpDistanceFactorByObjectType = 5.0f;
     }
-    ForEachGroundObject([&] (const cGroundObject &tmpGround) {
+    ForEachGroundObject([&] (cGroundObject &tmpGround) {
         if (NeedCheckCollision(tmpGround) && ObjectsStatusFoe(WeaponStatus, tmpGround.ObjectStatus)) {
+            tmpGround.UpdateBounds();
             FindTargetCalculateAngles(tmpGround.Location, tmpGround.Orientation, tmpGround.GeometryCenter,
                                       tmpGround.CurrentRotationMat, tmpGround.Speed, tmpGround.Radius);
         }
@@ -47,6 +47,22 @@ namespace {
 // all ship list
 std::list<std::shared_ptr<cSpaceShip>> ShipList{};
 
+// objects pairs broad phase
+struct sSweepObject {
+    std::list<std::shared_ptr<cSpaceShip>>::iterator Iter;
+    bool Released;
+};
+cSortAndSweep ShipSweep{};
+std::vector<sSweepObject> ShipSweepObjects{};
+std::vector<std::pair<unsigned, unsigned>> ShipSweepPairs{};
+
+// ships for parallel update and update status, note, we don't use std::vector<bool>,
+// since different threads could write into the same memory location in this case
+std::vector<cSpaceShip*> UpdateSpaceShips{};
+std::vector<uint8_t> UpdateSpaceShipsStatus{};
+// ships per parallel update job
+constexpr unsigned UpdateSpaceShipsChunkSize{4};
+
 } // unnamed namespace
 
 // FIXME should be fixed, don't allow global scope interaction for local variables
@@ -117,9 +133,24 @@ std::weak_ptr<cSpaceShip> CreatePirateShip(const int SpaceShipNum)
  */
 void UpdateAllSpaceShip(float Time)
 {
+    UpdateSpaceShips.clear();
+    for (auto &tmpShip : ShipList) {
+        UpdateSpaceShips.push_back(tmpShip.get());
+    }
+    UpdateSpaceShipsStatus.resize(UpdateSpaceShips.size());
+
+    // all interactions with other objects are deferred (see DeferObject3DCommand())
+    ParallelUpdateObject3D(static_cast<unsigned>(UpdateSpaceShips.size()), UpdateSpaceShipsChunkSize,
+                           [&Time] (unsigned Begin, unsigned End) {
+        for (unsigned i = Begin; i < End; i++) {
+            UpdateSpaceShipsStatus[i] = UpdateSpaceShips[i]->Update(Time);
+        }
+    });
+
     // NOTE use std::erase_if here (since C++20)
-    for (auto iter = ShipList.begin(); iter != ShipList.end();) {
-        if (!iter->get()->Update(Time)) {
+    unsigned i{0};
+    for (auto iter = ShipList.begin(); iter != ShipList.end(); i++) {
+        if (!UpdateSpaceShipsStatus[i]) {
             iter = ShipList.erase(iter);
         } else {
             ++iter;
@@ -210,34 +241,39 @@ void ForEachSpaceShipPair(std::function<void (cSpaceShip &FirstObject,
                           cSpaceShip &SecondObject,
                           eShipPairCycle &Command)> function)
 {
-    for (auto iterFirst = ShipList.begin(); iterFirst != ShipList.end();) {
-        eShipPairCycle Command{eShipPairCycle::Continue};
+    // sort and sweep along Z axis, only pairs with overlapped intervals are checked
+    ShipSweep.Begin();
+    ShipSweepObjects.clear();
+    for (auto iter = ShipList.begin(); iter != ShipList.end(); ++iter) {
+        float Min;
+        float Max;
+        vw_SphereSphereIntervalZ((*iter)->Radius, (*iter)->Location, (*iter)->PrevLocation, Min, Max);
+        ShipSweep.Add(iter->get(), static_cast<unsigned>(ShipSweepObjects.size()), Min, Max);
+        ShipSweepObjects.push_back(sSweepObject{iter, false});
+    }
+    ShipSweep.End();
+    ShipSweep.Pairs(ShipSweepPairs);
 
-        for (auto iterSecond = std::next(iterFirst, 1); iterSecond != ShipList.end();) {
-            Command = eShipPairCycle::Continue;
-            function(*iterFirst->get(), *iterSecond->get(), Command);
+    // same pairs order as i<j cycles for objects list have
+    for (auto &tmpPair : ShipSweepPairs) {
+        sSweepObject &First = ShipSweepObjects[tmpPair.first];
+        sSweepObject &Second = ShipSweepObjects[tmpPair.second];
+        if (First.Released || Second.Released) {
+            continue;
+        }
 
-            // NOTE (?) use std::erase_if here (since C++20)
-            if (Command == eShipPairCycle::DeleteSecondObjectAndContinue
-                || Command == eShipPairCycle::DeleteBothObjectsAndContinue) {
-                iterSecond = ShipList.erase(iterSecond);
-            } else {
-                ++iterSecond;
-            }
+        eShipPairCycle Command{eShipPairCycle::Continue};
+        function(*First.Iter->get(), *Second.Iter->get(), Command);
 
-            // break second cycle
-            if (Command == eShipPairCycle::DeleteFirstObjectAndContinue
-                || Command == eShipPairCycle::DeleteBothObjectsAndContinue) {
-                break;
-            }
+        if (Command == eShipPairCycle::DeleteSecondObjectAndContinue
+            || Command == eShipPairCycle::DeleteBothObjectsAndContinue) {
+            ShipList.erase(Second.Iter);
+            Second.Released = true;
         }
-
-        // NOTE (?) use std::erase_if here (since C++20)
         if (Command == eShipPairCycle::DeleteFirstObjectAndContinue
             || Command == eShipPairCycle::DeleteBothObjectsAndContinue) {
-            iterFirst = ShipList.erase(iterFirst);
-        } else {
-            ++iterFirst;
+            ShipList.erase(First.Iter);
+            First.Released = true;
         }
     }
 }
@@ -256,6 +292,17 @@ std::weak_ptr<cObject3D> GetSpaceShipPtr(const cSpaceShip &Object)
     return std::weak_ptr<cObject3D>{};
 }
 
+/*
+ * Cycle for each space ship with object's ptr.
+ * Note, caller must guarantee, that 'Object' will not released in callback function call.
+ */
+void ForEachSpaceShipPtr(std::function<void (cSpaceShip &Object, const std::weak_ptr<cObject3D> &ObjectPtr)> function)
+{
+    for (auto &tmpShip : ShipList) {
+        function(*tmpShip, tmpShip);
+    }
+}
+
 /*
  * Destructor.
  */
@@ -547,23 +594,17 @@ bool cSpaceShip::Update(float Time)
     }
 
     if (!FlareWeaponSlots.empty()) {
-        bool NeedFlare{false};
-        ForEachProjectile([&] (cProjectile &Projectile) {
-            // homing missile or homing mine targeted on this ship
-            auto sharedTarget = Projectile.Target.lock();
-            if (sharedTarget.get() == this) {
-                NeedFlare = true;
-                Projectile.Target.reset(); // reset target, since we will fire flares
-            }
-        });
-
-        if (NeedFlare) {
-            for (auto &tmpFlareWeaponSlot : FlareWeaponSlots) {
-                if (auto sharedWeapon = tmpFlareWeaponSlot.Weapon.lock()) {
-                    sharedWeapon->WeaponFire(Time);
+        // homing missile or homing mine targeted on this ship,
+        // reset their target, since we will fire flares
+        DeferObject3DCommand([this, Time] () {
+            if (ResetProjectilesTarget(*this)) {
+                for (auto &tmpFlareWeaponSlot : FlareWeaponSlots) {
+                    if (auto sharedWeapon = tmpFlareWeaponSlot.Weapon.lock()) {
+                        sharedWeapon->WeaponFire(Time);
+                    }
                 }
             }
-        }
+        });
     }
 
     if (ObjectStatus == eObjectStatus::Player) {
@@ -969,7 +1010,7 @@ bool cSpaceShip::Update(float Time)
             for (auto &tmpWeaponSlot : WeaponSlots) {
                 if (tmpWeaponSlot.SetFire) {
                     if (auto sharedWeapon = tmpWeaponSlot.Weapon.lock()) {
-                        sharedWeapon->WeaponFire(Time);
+                        DeferWeaponFire(sharedWeapon, Time);
                     }
                 }
             }
@@ -1003,7 +1044,7 @@ bool cSpaceShip::Update(float Time)
                     && WeaponGroupCurrentFireNum == static_cast<int>(i)
                     && WeaponGroupCurrentFireDelay <= 0.0f) {
                     if (auto sharedWeapon = WeaponSlots[i].Weapon.lock()) {
-                        sharedWeapon->WeaponFire(Time);
+                        DeferWeaponFire(sharedWeapon, Time);
                     }
 
                     WeaponGroupCurrentFireDelay = PrimTime / (PrimCount * PrimCount);
@@ -1032,7 +1073,7 @@ bool cSpaceShip::Update(float Time)
             for (auto &tmpBossWeaponSlot : BossWeaponSlots) {
                 if (tmpBossWeaponSlot.SetFire) {
                     if (auto sharedWeapon = tmpBossWeaponSlot.Weapon.lock()) {
-                        sharedWeapon->WeaponFire(Time);
+                        DeferWeaponFire(sharedWeapon, Time);
                     }
                 }
             }
@@ -1066,7 +1107,7 @@ bool cSpaceShip::Update(float Time)
                     && BossWeaponGroupCurrentFireNum == static_cast<int>(i)
                     && BossWeaponGroupCurrentFireDelay <= 0.0f) {
                     if (auto sharedWeapon = BossWeaponSlots[i].Weapon.lock()) {
-                        sharedWeapon->WeaponFire(Time);
+                        DeferWeaponFire(sharedWeapon, Time);
                     }
 
                     BossWeaponGroupCurrentFireDelay = PrimTime / (PrimCount * PrimCount);
@@ -1149,6 +1190,17 @@ bool cSpaceShip::Update(float Time)
         }
     }
 
+    // targeting read other objects, should be deferred during objects parallel update
+    DeferObject3DCommand([this] () {UpdateWeaponsTargeting();});
+
+    return true;
+}
+
+/*
+ * Weapons targeting.
+ */
+void cSpaceShip::UpdateWeaponsTargeting()
+{
     bool NeedFire{false};
     if (!WeaponSlots.empty()) {
         for (auto &tmpWeaponSlot : WeaponSlots) {
@@ -1404,8 +1456,6 @@ bool cSpaceShip::Update(float Time)
             }
         }
     }
-
-    return true;
 }
 
 } // astromenace namespace
@@ -88,6 +88,10 @@ protected:
     cSpaceShip() = default;
     ~cSpaceShip();
 
+private:
+    // Weapons targeting, could be deferred (see DeferObject3DCommand()).
+    void UpdateWeaponsTargeting();
+
 public:
     virtual bool Update(float Time) override;
     virtual void SetLocation(const sVECTOR3D &NewLocation) override;
@@ -232,6 +236,9 @@ void ForEachSpaceShipPair(std::function<void (cSpaceShip &FirstObject,
                           eShipPairCycle &Command)> function);
 // Get object ptr by reference.
 std::weak_ptr<cObject3D> GetSpaceShipPtr(const cSpaceShip &Object);
+// Cycle for each space ship with object's ptr (same order as ForEachSpaceShip() have).
+// Note, caller must guarantee, that 'Object' will not released in callback function call.
+void ForEachSpaceShipPtr(std::function<void (cSpaceShip &Object, const std::weak_ptr<cObject3D> &ObjectPtr)> function);
 
 // Setup engines.
 void SetEarthSpaceFighterEngine(std::weak_ptr<cSpaceShip> &SpaceShip, const int EngineType);
@@ -228,15 +228,31 @@ void ReleaseWeapon(std::weak_ptr<cWeapon> &Object)
  */
 void ReleaseWeaponLazy(std::weak_ptr<cWeapon> &Object)
 {
-    auto sharedObject = Object.lock();
-    if (!sharedObject) {
-        return;
-    }
+    // weapon is a separate object, should be deferred during objects parallel update
+    DeferObject3DCommand([Object] () {
+        auto sharedObject = Object.lock();
+        if (!sharedObject) {
+            return;
+        }
 
-    // make sure, that the DeleteAfterLeaveScene is disabled,
-    // in order to prevent possible Lifetime counter reset
-    sharedObject->DeleteAfterLeaveScene = eDeleteAfterLeaveScene::disabled;
-    sharedObject->Lifetime = 0.0f;
+        // make sure, that the DeleteAfterLeaveScene is disabled,
+        // in order to prevent possible Lifetime counter reset
+        sharedObject->DeleteAfterLeaveScene = eDeleteAfterLeaveScene::disabled;
+        sharedObject->Lifetime = 0.0f;
+    });
+}
+
+/*
+ * Fire, could be deferred during objects parallel update.
+ */
+void DeferWeaponFire(const std::weak_ptr<cWeapon> &Object, float Time)
+{
+    // fire creates projectiles and plays sfx
+    DeferObject3DCommand([Object, Time] () {
+        if (auto sharedObject = Object.lock()) {
+            sharedObject->WeaponFire(Time);
+        }
+    });
 }
 
 /*
@@ -1167,8 +1183,13 @@ void cWeapon::SetLocation(const sVECTOR3D &NewLocation)
         sharedLaserMaser->SetLocation(Location + FireLocation + sharedLaserMaser->ProjectileCenter);
     }
 
-    if (vw_IsSoundAvailable(LaserMaserSoundNum)) {
-        vw_SetSoundLocation(LaserMaserSoundNum, Location.x, Location.y, Location.z);
+    if (LaserMaserSoundNum) {
+        // sound location change should be deferred during objects parallel update
+        DeferObject3DCommand([this] () {
+            if (vw_IsSoundAvailable(LaserMaserSoundNum)) {
+                vw_SetSoundLocation(LaserMaserSoundNum, Location.x, Location.y, Location.z);
+            }
+        });
     }
 }
 
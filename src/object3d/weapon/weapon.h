@@ -113,6 +113,8 @@ void DrawAllWeapons(bool VertexOnlyPass, unsigned int ShadowMap);
 void ReleaseWeapon(std::weak_ptr<cWeapon> &Object);
 // Release particular weapon object during update cycle.
 void ReleaseWeaponLazy(std::weak_ptr<cWeapon> &Object);
+// Fire, could be deferred during objects parallel update (see DeferObject3DCommand()).
+void DeferWeaponFire(const std::weak_ptr<cWeapon> &Object, float Time);
 // Release all objects.
 void ReleaseAllWeapons();
 
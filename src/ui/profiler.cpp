@@ -0,0 +1,334 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+#include "profiler.h"
+#include <sstream>
+#include <iomanip>
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+namespace {
+
+// zones colors, zone's color is ZonesColors[ZoneNumber % ZonesColors.size()]
+const std::array<sRGBCOLOR, 8> ZonesColors{{sRGBCOLOR{1.0f, 0.3f, 0.3f},
+                                            sRGBCOLOR{0.3f, 1.0f, 0.3f},
+                                            sRGBCOLOR{0.3f, 0.5f, 1.0f},
+                                            sRGBCOLOR{1.0f, 1.0f, 0.3f},
+                                            sRGBCOLOR{1.0f, 0.3f, 1.0f},
+                                            sRGBCOLOR{0.3f, 1.0f, 1.0f},
+                                            sRGBCOLOR{1.0f, 0.6f, 0.2f},
+                                            sRGBCOLOR{0.7f, 0.7f, 0.7f}}};
+// pixels per millisecond
+constexpr float FlameBarScale{12.0f};
+constexpr float FlameBarRowHeight{6.0f};
+constexpr float HistoryBarWidth{2.0f};
+constexpr float HistoryScale{3.0f};
+// 60 fps frame time, in milliseconds
+constexpr float TargetFrameTime{1000.0f / 60.0f};
+constexpr float OverlayTransp{0.8f};
+
+// RI_2f_XY | RI_4f_COLOR = (2 + 4) * 6 vertices * rectangles
+std::vector<float> DrawBuffer{};
+
+} // unnamed namespace
+
+
+/*
+ * Add rectangle to draw buffer.
+ */
+static void AddRectangle(float X, float Y, float Width, float Height, const sRGBCOLOR &Color)
+{
+    auto AddVertex = [&Color] (float VertexX, float VertexY) {
+        DrawBuffer.push_back(VertexX);
+        DrawBuffer.push_back(VertexY);
+        DrawBuffer.push_back(Color.r);
+        DrawBuffer.push_back(Color.g);
+        DrawBuffer.push_back(Color.b);
+        DrawBuffer.push_back(OverlayTransp);
+    };
+
+    AddVertex(X, Y);
+    AddVertex(X, Y + Height);
+    AddVertex(X + Width, Y);
+    AddVertex(X + Width, Y);
+    AddVertex(X, Y + Height);
+    AddVertex(X + Width, Y + Height);
+}
+
+/*
+ * Draw all rectangles from draw buffer.
+ */
+static void DrawRectangles()
+{
+    if (DrawBuffer.empty()) {
+        return;
+    }
+
+    vw_SetTextureBlend(true, eTextureBlendFactor::SRC_ALPHA, eTextureBlendFactor::ONE_MINUS_SRC_ALPHA);
+    vw_Draw3D(ePrimitiveType::TRIANGLES, static_cast<GLsizei>(DrawBuffer.size() / 6),
+              RI_2f_XY | RI_4f_COLOR, DrawBuffer.data(), 6 * sizeof(DrawBuffer[0]));
+    vw_SetTextureBlend(false, eTextureBlendFactor::ONE, eTextureBlendFactor::ZERO);
+
+    DrawBuffer.clear();
+}
+
+/*
+ * Time in milliseconds from Start.
+ */
+static inline float MillisecondsFrom(const std::chrono::steady_clock::time_point &Start)
+{
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - Start).count();
+}
+
+/*
+ * Begin zone, return zone's record number.
+ */
+unsigned cProfiler::BeginZone(const char *Name)
+{
+    if (!Enabled_) {
+        return ProfilerRecordsPerFrame;
+    }
+
+    unsigned tmpDepth = CurrentDepth_++;
+    sFrame &tmpFrame = Frames_[CurrentFrame_];
+    if (tmpFrame.RecordsCount >= ProfilerRecordsPerFrame) {
+        return ProfilerRecordsPerFrame;
+    }
+
+    // we have just few zones, linear search by pointer is fast enough here
+    auto iter = std::find(Zones_.begin(), Zones_.end(), Name);
+    if (iter == Zones_.end()) {
+        if (Zones_.size() >= ProfilerZonesCount) {
+            return ProfilerRecordsPerFrame;
+        }
+        iter = Zones_.insert(Zones_.end(), Name);
+    }
+
+    sRecord &tmpRecord = tmpFrame.Records[tmpFrame.RecordsCount];
+    tmpRecord.Zone = static_cast<unsigned>(std::distance(Zones_.begin(), iter));
+    tmpRecord.Depth = tmpDepth;
+    tmpRecord.Start = MillisecondsFrom(FrameStart_);
+    tmpRecord.Duration = 0.0f;
+    return tmpFrame.RecordsCount++;
+}
+
+/*
+ * End zone.
+ */
+void cProfiler::EndZone(unsigned Record)
+{
+    if (!Enabled_) {
+        return;
+    }
+
+    if (CurrentDepth_ > 0) {
+        CurrentDepth_--;
+    }
+    if (Record >= ProfilerRecordsPerFrame) {
+        return;
+    }
+
+    sRecord &tmpRecord = Frames_[CurrentFrame_].Records[Record];
+    tmpRecord.Duration = MillisecondsFrom(FrameStart_) - tmpRecord.Start;
+}
+
+/*
+ * Reset profiler.
+ */
+void cProfiler::Reset()
+{
+    for (auto &tmpFrame : Frames_) {
+        tmpFrame.Duration = 0.0f;
+        tmpFrame.RecordsCount = 0;
+    }
+    CurrentFrame_ = 0;
+    FinishedFrames_ = 0;
+    CurrentDepth_ = 0;
+    FrameStart_ = std::chrono::steady_clock::now();
+}
+
+/*
+ * Switch profiler show/hide status.
+ */
+void cProfiler::Switch()
+{
+    Enabled_ = !Enabled_;
+
+    if (Enabled_) {
+        Reset();
+    }
+}
+
+/*
+ * Check keyboard.
+ */
+void cProfiler::CheckKeyboard()
+{
+    if (!vw_GetKeyStatus(SDLK_F3)) {
+        return;
+    }
+
+    vw_SetKeyStatus(SDLK_F3, false);
+    Switch();
+}
+
+/*
+ * Draw last finished frame zones hierarchy as flame bar.
+ */
+void cProfiler::DrawFlameBar(float X, float Y)
+{
+    const sFrame &tmpFrame = Frames_[(CurrentFrame_ + ProfilerFramesCount - 1) % ProfilerFramesCount];
+
+    AddRectangle(X, Y, tmpFrame.Duration * FlameBarScale, FlameBarRowHeight, sRGBCOLOR{0.2f, 0.2f, 0.2f});
+    for (unsigned i = 0; i < tmpFrame.RecordsCount; i++) {
+        const sRecord &tmpRecord = tmpFrame.Records[i];
+        AddRectangle(X + tmpRecord.Start * FlameBarScale,
+                     Y + (tmpRecord.Depth + 1) * FlameBarRowHeight,
+                     tmpRecord.Duration * FlameBarScale, FlameBarRowHeight,
+                     ZonesColors[tmpRecord.Zone % ZonesColors.size()]);
+    }
+    // target frame time mark
+    AddRectangle(X + TargetFrameTime * FlameBarScale, Y, 1.0f, FlameBarRowHeight * 5.0f, sRGBCOLOR{eRGBCOLOR::white});
+}
+
+/*
+ * Draw finished frames history, with top level zones.
+ */
+void cProfiler::DrawFramesHistory(float X, float Y)
+{
+    // oldest frame first
+    for (unsigned i = 0; i < ProfilerFramesCount - 1; i++) {
+        const sFrame &tmpFrame = Frames_[(CurrentFrame_ + 1 + i) % ProfilerFramesCount];
+        float BarX = X + i * HistoryBarWidth;
+
+        AddRectangle(BarX, Y - tmpFrame.Duration * HistoryScale, HistoryBarWidth,
+                     tmpFrame.Duration * HistoryScale, sRGBCOLOR{0.2f, 0.2f, 0.2f});
+        float BarY{Y};
+        for (unsigned j = 0; j < tmpFrame.RecordsCount; j++) {
+            const sRecord &tmpRecord = tmpFrame.Records[j];
+            if (tmpRecord.Depth) {
+                continue;
+            }
+            BarY -= tmpRecord.Duration * HistoryScale;
+            AddRectangle(BarX, BarY, HistoryBarWidth, tmpRecord.Duration * HistoryScale,
+                         ZonesColors[tmpRecord.Zone % ZonesColors.size()]);
+        }
+    }
+    // target frame time mark
+    AddRectangle(X, Y - TargetFrameTime * HistoryScale, (ProfilerFramesCount - 1) * HistoryBarWidth, 1.0f,
+                 sRGBCOLOR{eRGBCOLOR::white});
+}
+
+/*
+ * Draw average and maximum time per frame for each zone.
+ */
+void cProfiler::DrawZonesStatistic(int X, int Y)
+{
+    if (!FinishedFrames_) {
+        return;
+    }
+
+    // zones could be called few times per frame (or not called at all), so, we need sum per frame
+    std::array<float, ProfilerZonesCount> FrameTime{};
+    std::array<float, ProfilerZonesCount> TotalTime{};
+    std::array<float, ProfilerZonesCount> MaxTime{};
+    std::array<unsigned, ProfilerZonesCount> ZoneDepth{};
+    float FrameTotal{0.0f};
+    float FrameMax{0.0f};
+
+    for (unsigned i = 0; i < FinishedFrames_; i++) {
+        const sFrame &tmpFrame = Frames_[(CurrentFrame_ + ProfilerFramesCount - 1 - i) % ProfilerFramesCount];
+        FrameTime.fill(0.0f);
+        for (unsigned j = 0; j < tmpFrame.RecordsCount; j++) {
+            FrameTime[tmpFrame.Records[j].Zone] += tmpFrame.Records[j].Duration;
+            ZoneDepth[tmpFrame.Records[j].Zone] = tmpFrame.Records[j].Depth;
+        }
+        for (unsigned j = 0; j < Zones_.size(); j++) {
+            TotalTime[j] += FrameTime[j];
+            MaxTime[j] = std::max(MaxTime[j], FrameTime[j]);
+        }
+        FrameTotal += tmpFrame.Duration;
+        FrameMax = std::max(FrameMax, tmpFrame.Duration);
+    }
+
+    auto DrawLine = [&] (const std::string &Name, unsigned Depth, float Average, float Maximum,
+                         const sRGBCOLOR &Color) {
+        std::ostringstream tmpStream;
+        tmpStream << std::string(Depth * 2, ' ') << Name << "  "
+                  << std::fixed << std::setprecision(2) << Average << " / " << Maximum << " ms";
+        vw_DrawText(X, Y, 0, 0, 0.8f, Color, OverlayTransp, tmpStream.str());
+        Y += 16;
+    };
+
+    DrawLine("frame (avg / max)", 0, FrameTotal / FinishedFrames_, FrameMax, sRGBCOLOR{eRGBCOLOR::white});
+    for (unsigned i = 0; i < Zones_.size(); i++) {
+        DrawLine(Zones_[i], ZoneDepth[i], TotalTime[i] / FinishedFrames_, MaxTime[i],
+                 ZonesColors[i % ZonesColors.size()]);
+    }
+}
+
+/*
+ * Draw profiler overlay.
+ * Note, caller should setup 2D mode rendering first.
+ */
+void cProfiler::Draw()
+{
+    if (!Enabled_) {
+        return;
+    }
+
+    DrawFlameBar(6.0f, 30.0f);
+    DrawFramesHistory(6.0f, 170.0f);
+    vw_BindTexture(0, 0);
+    DrawRectangles();
+
+    DrawZonesStatistic(6, 180);
+}
+
+/*
+ * Finish current frame and start new one.
+ */
+void cProfiler::Update()
+{
+    if (Enabled_) {
+        Frames_[CurrentFrame_].Duration = MillisecondsFrom(FrameStart_);
+        CurrentFrame_ = (CurrentFrame_ + 1) % ProfilerFramesCount;
+        Frames_[CurrentFrame_].Duration = 0.0f;
+        Frames_[CurrentFrame_].RecordsCount = 0;
+        // note, current frame is not finished yet
+        FinishedFrames_ = std::min(FinishedFrames_ + 1, ProfilerFramesCount - 1);
+        CurrentDepth_ = 0;
+    }
+    FrameStart_ = std::chrono::steady_clock::now();
+
+    CheckKeyboard();
+}
+
+} // astromenace namespace
+} // viewizard namespace
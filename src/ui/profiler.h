@@ -0,0 +1,133 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+#ifndef UI_PROFILER_H
+#define UI_PROFILER_H
+
+#include "../core/core.h"
+#include <chrono>
+
+// NOTE switch to nested namespace definition (namespace A::B::C { ... }) (since C++17)
+namespace viewizard {
+namespace astromenace {
+
+/*
+Per-frame CPU profiler. Code blocks are marked by PROFILER_ZONE(), zones could be nested.
+Profiler keep zones timings for last ProfilerFramesCount frames in ring buffer, overlay
+(F3 key) show zones hierarchy for last frame (flame bar), frames history with top level
+zones and average/maximum time for each zone.
+Note, while profiler is hidden, zones don't collect anything.
+*/
+
+// frames in profiler's ring buffer
+constexpr unsigned ProfilerFramesCount{120};
+// maximum zones records per frame, all records above this limit are ignored
+constexpr unsigned ProfilerRecordsPerFrame{64};
+// maximum different zones
+constexpr unsigned ProfilerZonesCount{32};
+
+class cProfiler {
+private:
+    cProfiler() = default;
+    ~cProfiler() = default;
+
+    void CheckKeyboard();
+    void DrawFlameBar(float X, float Y);
+    void DrawFramesHistory(float X, float Y);
+    void DrawZonesStatistic(int X, int Y);
+
+    struct sRecord {
+        unsigned Zone{0};
+        unsigned Depth{0};
+        float Start{0.0f};      // in milliseconds, from frame start
+        float Duration{0.0f};   // in milliseconds
+    };
+
+    struct sFrame {
+        float Duration{0.0f};   // in milliseconds
+        unsigned RecordsCount{0};
+        std::array<sRecord, ProfilerRecordsPerFrame> Records{};
+    };
+
+    bool Enabled_{false};
+    // registered zones names (we use pointers to string literals as zones id)
+    std::vector<const char*> Zones_{};
+    // ring buffer, CurrentFrame_ is collecting records now, all other frames are finished
+    std::array<sFrame, ProfilerFramesCount> Frames_{};
+    unsigned CurrentFrame_{0};
+    unsigned FinishedFrames_{0};
+    unsigned CurrentDepth_{0};
+    std::chrono::steady_clock::time_point FrameStart_{};
+
+public:
+    cProfiler(cProfiler const&) = delete;
+    void operator = (cProfiler const&) = delete;
+
+    static cProfiler &GetInstance()
+    {
+        static cProfiler Instance;
+        return Instance;
+    }
+
+    // Return zone's record number, or ProfilerRecordsPerFrame if record was not created.
+    unsigned BeginZone(const char *Name);
+    void EndZone(unsigned Record);
+
+    void Switch();
+    void Reset();
+    void Draw();
+    // Finish current frame, should be called one time per frame.
+    void Update();
+};
+
+// Profiler zone (RAII), record zone's time from construction till destruction.
+class cProfilerZone {
+public:
+    explicit cProfilerZone(const char *Name) :
+        Record_{cProfiler::GetInstance().BeginZone(Name)}
+    {}
+    ~cProfilerZone()
+    {
+        cProfiler::GetInstance().EndZone(Record_);
+    }
+
+    cProfilerZone(cProfilerZone const&) = delete;
+    void operator = (cProfilerZone const&) = delete;
+
+private:
+    unsigned Record_{0};
+};
+
+#define PROFILER_ZONE_CONCAT_(A, B) A##B
+#define PROFILER_ZONE_CONCAT(A, B) PROFILER_ZONE_CONCAT_(A, B)
+// Profile code from this line till the end of the scope, Name should be string literal.
+#define PROFILER_ZONE(Name) cProfilerZone PROFILER_ZONE_CONCAT(tmpProfilerZone, __LINE__){Name}
+
+} // astromenace namespace
+} // viewizard namespace
+
+#endif // UI_PROFILER_H
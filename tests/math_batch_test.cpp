@@ -0,0 +1,222 @@
+/****************************************************************************
+
+    AstroMenace
+    Hardcore 3D space scroll-shooter with spaceship upgrade possibilities.
+    Copyright (c) 2006-2019 Mikhail Kurinnoi, Viewizard
+
+
+    AstroMenace is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    AstroMenace is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with AstroMenace. If not, see <https://www.gnu.org/licenses/>.
+
+
+    Website: https://viewizard.com/
+    Project: https://github.com/viewizard/astromenace
+    E-mail: viewizard@viewizard.com
+
+*****************************************************************************/
+
+// NOTE batch functions (src/core/math/batch.cpp) are compared with scalar functions,
+//      test is built twice, with SSE (if available) and with scalar code only,
+//      points counts cover both 4 points iterations and the rest points
+
+#include "../src/core/math/math.h"
+
+using namespace viewizard;
+
+namespace {
+
+constexpr unsigned MaxPointsCount{19};
+constexpr unsigned Iterations{100};
+
+unsigned FailedChecks{0};
+
+} // unnamed namespace
+
+
+/*
+ * Random float in [-Range, Range].
+ */
+static float RandomFloat(float Range)
+{
+    return Range * (2.0f * static_cast<float>(rand()) / static_cast<float>(RAND_MAX) - 1.0f);
+}
+
+/*
+ * Random point with coordinates in [-Range, Range].
+ */
+static sVECTOR3D RandomPoint(float Range)
+{
+    return sVECTOR3D{RandomFloat(Range), RandomFloat(Range), RandomFloat(Range)};
+}
+
+/*
+ * Check, that batch result is the same as scalar result.
+ * Note, we allow small error, since compiler could contract scalar code into FMA.
+ */
+static void CheckPoint(const char *Test, unsigned Count, const sVECTOR3D &Batch, const sVECTOR3D &Scalar)
+{
+    auto Equal = [] (float A, float B) {
+        return std::fabs(A - B) <= 1e-5f * std::max(1.0f, std::fabs(B));
+    };
+
+    if (Equal(Batch.x, Scalar.x) && Equal(Batch.y, Scalar.y) && Equal(Batch.z, Scalar.z)) {
+        return;
+    }
+
+    FailedChecks++;
+    std::cerr << __func__ << "(): " << Test << " failed for " << Count << " points: "
+              << Batch.x << " " << Batch.y << " " << Batch.z << " != "
+              << Scalar.x << " " << Scalar.y << " " << Scalar.z << "\n";
+}
+
+/*
+ * Test vw_Matrix33CalcPoints() for points array (AoS), both separate and same source/destination.
+ */
+static void TestMatrix33CalcPoints(unsigned Count)
+{
+    float Matrix33[9];
+    vw_Matrix33CreateRotate(Matrix33, RandomPoint(180.0f));
+
+    std::vector<sVECTOR3D> Src(Count);
+    for (auto &tmpPoint : Src) {
+        tmpPoint = RandomPoint(1000.0f);
+    }
+    std::vector<sVECTOR3D> Dst(Count);
+    std::vector<sVECTOR3D> InPlace{Src};
+
+    vw_Matrix33CalcPoints(Matrix33, Src.data(), Dst.data(), Count);
+    vw_Matrix33CalcPoints(Matrix33, InPlace.data(), InPlace.data(), Count);
+
+    for (unsigned i = 0; i < Count; i++) {
+        sVECTOR3D Scalar{Src[i]};
+        vw_Matrix33CalcPoint(Scalar, Matrix33);
+        CheckPoint("vw_Matrix33CalcPoints (AoS)", Count, Dst[i], Scalar);
+        CheckPoint("vw_Matrix33CalcPoints (AoS, in place)", Count, InPlace[i], Scalar);
+    }
+}
+
+/*
+ * Test vw_Matrix33CalcPoints() for separate coordinates arrays (SoA).
+ */
+static void TestMatrix33CalcPointsSoA(unsigned Count)
+{
+    float Matrix33[9];
+    vw_Matrix33CreateRotate(Matrix33, RandomPoint(180.0f));
+
+    std::vector<sVECTOR3D> Src(Count);
+    std::vector<float> PointsX(Count);
+    std::vector<float> PointsY(Count);
+    std::vector<float> PointsZ(Count);
+    for (unsigned i = 0; i < Count; i++) {
+        Src[i] = RandomPoint(1000.0f);
+        PointsX[i] = Src[i].x;
+        PointsY[i] = Src[i].y;
+        PointsZ[i] = Src[i].z;
+    }
+
+    vw_Matrix33CalcPoints(Matrix33, PointsX.data(), PointsY.data(), PointsZ.data(), Count);
+
+    for (unsigned i = 0; i < Count; i++) {
+        sVECTOR3D Scalar{Src[i]};
+        vw_Matrix33CalcPoint(Scalar, Matrix33);
+        CheckPoint("vw_Matrix33CalcPoints (SoA)", Count, sVECTOR3D{PointsX[i], PointsY[i], PointsZ[i]}, Scalar);
+    }
+}
+
+/*
+ * Test vw_Matrix44CalcPoints(), both separate and same source/destination.
+ */
+static void TestMatrix44CalcPoints(unsigned Count)
+{
+    float Matrix44[16];
+    vw_Matrix44CreateRotate(Matrix44, RandomPoint(180.0f));
+    vw_Matrix44Translate(Matrix44, RandomPoint(100.0f));
+
+    std::vector<sVECTOR3D> Src(Count);
+    for (auto &tmpPoint : Src) {
+        tmpPoint = RandomPoint(1000.0f);
+    }
+    std::vector<sVECTOR3D> Dst(Count);
+    std::vector<sVECTOR3D> InPlace{Src};
+
+    vw_Matrix44CalcPoints(Matrix44, Src.data(), Dst.data(), Count);
+    vw_Matrix44CalcPoints(Matrix44, InPlace.data(), InPlace.data(), Count);
+
+    for (unsigned i = 0; i < Count; i++) {
+        sVECTOR3D Scalar{Src[i]};
+        vw_Matrix44CalcPoint(Scalar, Matrix44);
+        CheckPoint("vw_Matrix44CalcPoints", Count, Dst[i], Scalar);
+        CheckPoint("vw_Matrix44CalcPoints (in place)", Count, InPlace[i], Scalar);
+    }
+}
+
+/*
+ * Test vw_PointsAABB().
+ */
+static void TestPointsAABB(unsigned Count)
+{
+    if (!Count) {
+        return;
+    }
+
+    std::vector<sVECTOR3D> Points(Count);
+    for (auto &tmpPoint : Points) {
+        tmpPoint = RandomPoint(1000.0f);
+    }
+
+    sVECTOR3D Min, Max;
+    vw_PointsAABB(Points.data(), Count, Min, Max);
+
+    sVECTOR3D ScalarMin{Points[0]};
+    sVECTOR3D ScalarMax{Points[0]};
+    for (auto &tmpPoint : Points) {
+        ScalarMin.x = std::min(ScalarMin.x, tmpPoint.x);
+        ScalarMin.y = std::min(ScalarMin.y, tmpPoint.y);
+        ScalarMin.z = std::min(ScalarMin.z, tmpPoint.z);
+        ScalarMax.x = std::max(ScalarMax.x, tmpPoint.x);
+        ScalarMax.y = std::max(ScalarMax.y, tmpPoint.y);
+        ScalarMax.z = std::max(ScalarMax.z, tmpPoint.z);
+    }
+    CheckPoint("vw_PointsAABB (min)", Count, Min, ScalarMin);
+    CheckPoint("vw_PointsAABB (max)", Count, Max, ScalarMax);
+}
+
+/*
+ * Main.
+ */
+int main()
+{
+    srand(1);
+
+    for (unsigned i = 0; i < Iterations; i++) {
+        for (unsigned Count = 0; Count <= MaxPointsCount; Count++) {
+            TestMatrix33CalcPoints(Count);
+            TestMatrix33CalcPointsSoA(Count);
+            TestMatrix44CalcPoints(Count);
+            TestPointsAABB(Count);
+        }
+    }
+
+#ifdef __SSE__
+    std::cout << "SSE code tested.\n";
+#else
+    std::cout << "Scalar code tested.\n";
+#endif // __SSE__
+
+    if (FailedChecks) {
+        std::cerr << __func__ << "(): " << "failed checks: " << FailedChecks << "\n";
+        return 1;
+    }
+
+    return 0;
+}